@@ -0,0 +1,122 @@
+#include <utility/io/read.hpp>
+#include <utility/io/temporary_file.hpp>
+
+#include <burst/algorithm/external_radix_sort.hpp>
+#include <burst/execution/parallel_policy.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+/*!
+    \brief
+        Замер пропускной способности внешней сортировки
+
+    \details
+        Данные заранее записываются во временный файл, и каждое испытание сортирует этот файл
+        в другой временный файл. Замеряется всё время сортировки, включая чтение, запись серий,
+        слияние и запись результата, поэтому пропускная способность получается сквозной.
+ */
+void
+    test_external_sort
+    (
+        const std::vector<std::int64_t> & numbers,
+        std::size_t attempts,
+        std::size_t memory_budget,
+        std::size_t thread_count,
+        const std::string & directory
+    )
+{
+    using namespace std::chrono;
+
+    utility::temporary_file input(directory + "/input");
+    input.write(reinterpret_cast<const char *>(numbers.data()),
+        static_cast<std::streamsize>(numbers.size() * sizeof(std::int64_t)));
+    input.flush();
+
+    const auto make_run = utility::temporary_files(directory);
+    auto best_time = clock_type::duration::max();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        input.clear();
+        input.seekg(0);
+        utility::temporary_file output(directory + "/output");
+
+        auto attempt_start_time = clock_type::now();
+        if (thread_count > 1)
+        {
+            burst::external_radix_sort<std::int64_t>(burst::par(thread_count), input, output, memory_budget, make_run);
+        }
+        else
+        {
+            burst::external_radix_sort<std::int64_t>(input, output, memory_budget, make_run);
+        }
+        output.flush();
+        best_time = std::min(best_time, clock_type::now() - attempt_start_time);
+    }
+
+    const auto seconds = duration_cast<duration<double>>(best_time).count();
+    const auto gigabytes = static_cast<double>(numbers.size() * sizeof(std::int64_t)) / 1e9;
+    std::cout
+        << "memory " << memory_budget
+        << " threads " << thread_count
+        << " time " << seconds
+        << " GB/s " << gigabytes / seconds
+        << std::endl;
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("attempts", bpo::value<std::size_t>()->default_value(3),
+            "Количество испытаний")
+        ("memory", bpo::value<std::vector<std::size_t>>()->multitoken()
+                ->default_value(std::vector<std::size_t>{std::size_t{1} << 26}, "67108864"),
+            "Бюджеты памяти в байтах")
+        ("threads", bpo::value<std::size_t>()->default_value(1),
+            "Количество потоков для сортировки блоков")
+        ("tmpdir", bpo::value<std::string>()->default_value("/tmp"),
+            "Директория для временных файлов");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            std::vector<std::int64_t> numbers;
+            utility::read(std::cin, numbers);
+
+            const auto attempts = vm["attempts"].as<std::size_t>();
+            const auto thread_count = vm["threads"].as<std::size_t>();
+            const auto & directory = vm["tmpdir"].as<std::string>();
+            for (const auto memory_budget: vm["memory"].as<std::vector<std::size_t>>())
+            {
+                test_external_sort(numbers, attempts, memory_budget, thread_count, directory);
+            }
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -0,0 +1,111 @@
+#include <utility/io/read.hpp>
+
+#include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/integer/to_ordered_integral.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+/*!
+    \brief
+        Замер подсчёта счётчиков поразрядной сортировки
+
+    \details
+        Замеряется только первый проход поразрядной сортировки — подсчёт значений всех байтов
+        всех чисел. Обычный подсчёт сравнивается с подсчётом с чередованием копий счётчиков.
+        Разница заметнее всего на данных, у которых много совпадающих байтов, например, на
+        небольших числах или на числах из узкого диапазона (см. опции `--min` и `--max`
+        генератора `rangegen`).
+ */
+template <typename Count>
+void test_histogram (const std::string & name, Count count, const std::vector<std::int64_t> & numbers, std::size_t attempts)
+{
+    using namespace std::chrono;
+    using counter_type = std::int32_t;
+    constexpr auto radix_count = sizeof(std::int64_t);
+
+    auto best_time = clock_type::duration::max();
+    auto checksum = std::int64_t{0};
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        burst::detail::radix_counters<counter_type, radix_count, 256> counters;
+
+        auto attempt_start_time = clock_type::now();
+        count(numbers.begin(), numbers.end(), counters.data());
+        best_time = std::min(best_time, clock_type::now() - attempt_start_time);
+
+        checksum += *std::max_element(counters.data()[0], counters.data()[0] + 256);
+    }
+
+    const auto seconds = duration_cast<duration<double>>(best_time).count();
+    const auto bytes = static_cast<double>(numbers.size() * sizeof(std::int64_t));
+    std::cout
+        << name
+        << " time " << seconds
+        << " bytes/ns " << bytes / seconds / 1e9
+        << " checksum " << checksum
+        << std::endl;
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("attempts", bpo::value<std::size_t>()->default_value(10),
+            "Количество испытаний");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            std::vector<std::int64_t> numbers;
+            utility::read(std::cin, numbers);
+
+            const auto attempts = vm["attempts"].as<std::size_t>();
+            const auto map = burst::compose(burst::shift_to_unsigned, burst::to_ordered_integral);
+            const auto radices = std::make_index_sequence<sizeof(std::int64_t)>{};
+
+            test_histogram("plain",
+                [& map, & radices] (auto first, auto last, auto counters)
+                {
+                    burst::detail::count_plain_impl(first, last, map, burst::low_byte, counters, radices);
+                },
+                numbers, attempts);
+            test_histogram("interleaved",
+                [& map, & radices] (auto first, auto last, auto counters)
+                {
+                    burst::detail::count_interleaved_impl(first, last, map, burst::low_byte, counters, radices);
+                },
+                numbers, attempts);
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -1,12 +1,18 @@
 #include <utility/io/read.hpp>
 
 #include <burst/algorithm/radix_sort.hpp>
+#include <burst/algorithm/radix_sort_inplace.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/functional/low_bits.hpp>
 #include <burst/string/u8s.hpp>
 #include <burst/integer/to_ordered_integral.hpp>
 
+#include <boost/asio/thread_pool.hpp>
 #include <boost/program_options.hpp>
 #include <boost/sort/spreadsort/spreadsort.hpp>
 
+#include <sys/resource.h>
+
 #include <algorithm>
 #include <chrono>
 #include <iostream>
@@ -19,21 +25,37 @@
 using burst::literals::operator ""_u8s;
 
 const auto burst_radix_sort_call_name = std::string("burst::radix_sort");
+const auto burst_radix_sort_11_call_name = std::string("burst::radix_sort(low_bits<11>)");
+const auto burst_radix_sort_16_call_name = std::string("burst::radix_sort(low_bits<16>)");
+const auto burst_radix_sort_auto_call_name = std::string("burst::radix_sort(adaptive_radix)");
+const auto burst_radix_sort_wc_call_name = std::string("burst::radix_sort(write_combining)");
 const auto burst_radix_sort_par_max_call_name = std::string("burst::radix_sort(par(max))");
+const auto burst_radix_sort_par_max_wc_call_name = std::string("burst::radix_sort(par(max), write_combining)");
+const auto burst_radix_sort_par_pool_call_name = std::string("burst::radix_sort(par(pool, max))");
 const auto burst_radix_sort_par_2_call_name = std::string("burst::radix_sort(par(2))");
 const auto burst_radix_sort_par_4_call_name = std::string("burst::radix_sort(par(4))");
 const auto burst_radix_sort_par_8_call_name = std::string("burst::radix_sort(par(8))");
 const auto burst_radix_sort_par_16_call_name = std::string("burst::radix_sort(par(16))");
+const auto burst_radix_sort_inplace_call_name = std::string("burst::radix_sort_inplace");
+const auto burst_radix_sort_inplace_par_max_call_name = std::string("burst::radix_sort_inplace(par(max))");
 const auto std_sort_call_name = std::string("std::sort");
 const auto std_stable_sort_call_name = std::string("std::stable_sort");
 const auto boost_spreadsort_call_name = std::string("boost::spreadsort");
 
 const auto burst_radix_sort_title = std::string("radix");
+const auto burst_radix_sort_11_title = std::string("radix11");
+const auto burst_radix_sort_16_title = std::string("radix16");
+const auto burst_radix_sort_auto_title = std::string("radixauto");
+const auto burst_radix_sort_wc_title = std::string("radixwc");
 const auto burst_radix_sort_par_max_title = std::string("par");
+const auto burst_radix_sort_par_max_wc_title = std::string("parwc");
+const auto burst_radix_sort_par_pool_title = std::string("parpool");
 const auto burst_radix_sort_par_2_title = std::string("par2");
 const auto burst_radix_sort_par_4_title = std::string("par4");
 const auto burst_radix_sort_par_8_title = std::string("par8");
 const auto burst_radix_sort_par_16_title = std::string("par16");
+const auto burst_radix_sort_inplace_title = std::string("inplace");
+const auto burst_radix_sort_inplace_par_max_title = std::string("inplacepar");
 const auto std_sort_title = std::string("std");
 const auto std_stable_sort_title = std::string("stable");
 const auto boost_spreadsort_title = std::string("boost");
@@ -48,6 +70,24 @@ const auto default_algorithms_set =
         boost_spreadsort_title
     };
 
+// Алгоритмы, которым нужен буфер размера сортируемого массива.
+const auto buffered_algorithms_set =
+    std::vector<std::string>
+    {
+        burst_radix_sort_title,
+        burst_radix_sort_11_title,
+        burst_radix_sort_16_title,
+        burst_radix_sort_auto_title,
+        burst_radix_sort_wc_title,
+        burst_radix_sort_par_max_title,
+        burst_radix_sort_par_max_wc_title,
+        burst_radix_sort_par_pool_title,
+        burst_radix_sort_par_2_title,
+        burst_radix_sort_par_4_title,
+        burst_radix_sort_par_8_title,
+        burst_radix_sort_par_16_title
+    };
+
 using clock_type = std::chrono::steady_clock;
 
 template <typename Sort, typename Container, typename UnaryFunction1, typename UnaryFunction2>
@@ -93,19 +133,64 @@ void
     std::vector<Value> numbers;
     utility::read(std::cin, numbers);
 
-    std::vector<Value> buffer(numbers.size());
+    // Буфер заводится только тогда, когда он действительно нужен, чтобы не искажать замеры
+    // пикового потребления памяти алгоритмами, работающими на месте.
+    const auto needs_buffer =
+        std::any_of(to_bench.begin(), to_bench.end(),
+            [] (const auto & title)
+            {
+                return
+                    std::find(buffered_algorithms_set.begin(), buffered_algorithms_set.end(), title)
+                        != buffered_algorithms_set.end();
+            });
+    std::vector<Value> buffer(needs_buffer ? numbers.size() : 0);
 
     auto radix_sort =
         [& buffer] (auto && ... args)
         {
             return burst::radix_sort(std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral);
         };
+    auto radix_sort_11 =
+        [& buffer] (auto && ... args)
+        {
+            return burst::radix_sort(std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral, burst::low_bits<11>);
+        };
+    auto radix_sort_16 =
+        [& buffer] (auto && ... args)
+        {
+            return burst::radix_sort(std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral, burst::low_bits<16>);
+        };
+    auto radix_sort_auto =
+        [& buffer] (auto && ... args)
+        {
+            return burst::radix_sort(std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral, burst::adaptive_radix);
+        };
+    auto radix_sort_wc =
+        [& buffer] (auto && ... args)
+        {
+            return burst::radix_sort(std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral, burst::low_byte, burst::write_combining);
+        };
     auto radix_sort_par_max =
         [& buffer] (auto && ... args)
         {
             const auto par = burst::par(std::max(std::thread::hardware_concurrency(), 2u));
             return burst::radix_sort(par, std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral);
         };
+    auto radix_sort_par_max_wc =
+        [& buffer] (auto && ... args)
+        {
+            const auto par = burst::par(std::max(std::thread::hardware_concurrency(), 2u));
+            return burst::radix_sort(par, std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral, burst::low_byte, burst::write_combining);
+        };
+    // Пул создаётся один раз, поэтому время его запуска и остановки не входит в замеры.
+    const auto pool_thread_count = std::max(std::thread::hardware_concurrency(), 2u);
+    boost::asio::thread_pool pool(pool_thread_count);
+    auto radix_sort_par_pool =
+        [& buffer, & pool, pool_thread_count] (auto && ... args)
+        {
+            const auto par = burst::par(pool, pool_thread_count);
+            return burst::radix_sort(par, std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral);
+        };
     auto radix_sort_par_2 =
         [& buffer] (auto && ... args)
         {
@@ -126,6 +211,17 @@ void
         {
             return burst::radix_sort(burst::par(16), std::forward<decltype(args)>(args)..., buffer.begin(), burst::to_ordered_integral);
         };
+    auto radix_sort_inplace =
+        [] (auto && ... args)
+        {
+            return burst::radix_sort_inplace(std::forward<decltype(args)>(args)..., burst::to_ordered_integral);
+        };
+    auto radix_sort_inplace_par_max =
+        [] (auto && ... args)
+        {
+            const auto par = burst::par(std::max(std::thread::hardware_concurrency(), 2u));
+            return burst::radix_sort_inplace(par, std::forward<decltype(args)>(args)..., burst::to_ordered_integral);
+        };
     auto std_sort =
         [] (auto && ... args)
         {
@@ -148,11 +244,19 @@ void
         std::unordered_map<std::string, std::pair<std::string, sort_call_type>>
         {
             {burst_radix_sort_title, {burst_radix_sort_call_name, radix_sort}},
+            {burst_radix_sort_11_title, {burst_radix_sort_11_call_name, radix_sort_11}},
+            {burst_radix_sort_16_title, {burst_radix_sort_16_call_name, radix_sort_16}},
+            {burst_radix_sort_auto_title, {burst_radix_sort_auto_call_name, radix_sort_auto}},
+            {burst_radix_sort_wc_title, {burst_radix_sort_wc_call_name, radix_sort_wc}},
             {burst_radix_sort_par_max_title, {burst_radix_sort_par_max_call_name, radix_sort_par_max}},
+            {burst_radix_sort_par_max_wc_title, {burst_radix_sort_par_max_wc_call_name, radix_sort_par_max_wc}},
+            {burst_radix_sort_par_pool_title, {burst_radix_sort_par_pool_call_name, radix_sort_par_pool}},
             {burst_radix_sort_par_2_title, {burst_radix_sort_par_2_call_name, radix_sort_par_2}},
             {burst_radix_sort_par_4_title, {burst_radix_sort_par_4_call_name, radix_sort_par_4}},
             {burst_radix_sort_par_8_title, {burst_radix_sort_par_8_call_name, radix_sort_par_8}},
             {burst_radix_sort_par_16_title, {burst_radix_sort_par_16_call_name, radix_sort_par_16}},
+            {burst_radix_sort_inplace_title, {burst_radix_sort_inplace_call_name, radix_sort_inplace}},
+            {burst_radix_sort_inplace_par_max_title, {burst_radix_sort_inplace_par_max_call_name, radix_sort_inplace_par_max}},
             {std_sort_title, {std_sort_call_name, std_sort}},
             {std_stable_sort_title, {std_stable_sort_call_name, std_stable_sort}},
             {boost_spreadsort_title, {boost_spreadsort_call_name, boost_spreadsort}}
@@ -455,7 +559,11 @@ int main (int argc, const char * argv[])
         ("algo", bpo::value<std::vector<std::string>>()->multitoken()
             ->default_value(default_algorithms_set, "radix par std stable boost"),
             "Набор тестируемых алгоритмов.\n"
-            "Допустимые значения: radix, std, stable, boost, par, par2, par4, par8, par16");
+            "Допустимые значения: radix, radix11, radix16, radixauto, radixwc, std, stable, boost, "
+            "par, parwc, parpool, par2, par4, par8, par16, inplace, inplacepar")
+        ("memory", "Вывести пиковый объём резидентной памяти процесса (в килобайтах).\n"
+            "Пик считается для всего процесса, поэтому для сравнения алгоритмов по памяти "
+            "каждый из них нужно запускать отдельно");
 
     try
     {
@@ -477,6 +585,13 @@ int main (int argc, const char * argv[])
 
             auto test = dispatch_call(value_type, statistic, prepare_type);
             test(algorithm_set, attempts);
+
+            if (vm.count("memory"))
+            {
+                rusage usage{};
+                getrusage(RUSAGE_SELF, &usage);
+                std::cout << "max_rss " << usage.ru_maxrss << std::endl;
+            }
         }
     }
     catch (bpo::error & e)
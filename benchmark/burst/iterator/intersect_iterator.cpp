@@ -1,14 +1,27 @@
 #include <utility/io/read_many.hpp>
 
+#include <burst/algorithm/intersect_into.hpp>
 #include <burst/range/intersect.hpp>
+#include <burst/range/skip_policy.hpp>
 
+#include <boost/program_options.hpp>
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
 #include <vector>
 
+using clock_type = std::chrono::steady_clock;
+
 template <typename Container>
 void test_on_the_fly_intersect (const Container & values)
 {
@@ -31,6 +44,20 @@ void test_on_the_fly_intersect (const Container & values)
     std::cout << std::endl;
 }
 
+template <typename Container>
+void test_intersect_into (const Container & values)
+{
+    typename Container::value_type intersected;
+
+    clock_t intersect_time = clock();
+    burst::intersect_into(values, std::back_inserter(intersected));
+    intersect_time = clock() - intersect_time;
+
+    std::cout << "burst::intersect_into: " << intersected.size() << std::endl;
+    std::cout << "\t" << static_cast<double>(intersect_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
 template <typename Container>
 void test_std_intersect (const Container & values)
 {
@@ -51,11 +78,159 @@ void test_std_intersect (const Container & values)
     std::cout << std::endl;
 }
 
-int main ()
+template <typename Integer>
+std::vector<Integer> random_sorted_vector (std::size_t size, Integer max_value, std::default_random_engine & engine)
+{
+    std::uniform_int_distribution<Integer> uniform(0, max_value);
+
+    std::vector<Integer> values;
+    values.reserve(size);
+    std::generate_n(std::back_inserter(values), size, [& engine, & uniform] {return uniform(engine);});
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+template <typename Intersect, typename Integer>
+void
+    test_skip
+    (
+        const std::string & name,
+        Intersect intersect,
+        const std::vector<Integer> & short_values,
+        const std::vector<Integer> & long_values,
+        std::size_t attempts
+    )
+{
+    using namespace std::chrono;
+
+    auto best_time = clock_type::duration::max();
+    auto size = std::size_t{0};
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        auto attempt_start_time = clock_type::now();
+        size = intersect(short_values, long_values);
+        best_time = std::min(best_time, clock_type::now() - attempt_start_time);
+    }
+
+    std::cout << " " << name << " " << duration_cast<duration<double>>(best_time).count();
+    std::cout << " (" << size << ")";
+}
+
+template <typename SkipPolicy>
+auto skip_intersect (SkipPolicy skip)
 {
-    std::vector<std::vector<std::int64_t>> values;
-    utility::read_many(std::cin, values);
+    return
+        [skip] (const auto & short_values, const auto & long_values)
+        {
+            auto intersection = burst::intersect(std::tie(short_values, long_values), std::less<>{}, skip);
+            return static_cast<std::size_t>(std::distance(intersection.begin(), intersection.end()));
+        };
+}
+
+/*!
+    \brief
+        Замер пересечения двух диапазонов в зависимости от соотношения их размеров
+
+    \details
+        Длинный диапазон состоит из `size` случайных чисел, а короткий — в `ratio` раз меньше,
+        где `ratio` пробегает степени двойки от 1 до `max_ratio`. Числа берутся из отрезка
+        `[0, 4 * size]`, так что в пересечение попадает заметная доля короткого диапазона.
+        Ленивое пересечение с каждым из способов продвижения диапазонов и энергичное
+        пересечение `burst::intersect_into` сравниваются с `std::set_intersection`.
+ */
+template <typename Integer>
+void test_ratio_sweep (std::size_t size, std::size_t max_ratio, std::size_t attempts)
+{
+    std::default_random_engine engine;
+    const auto max_value = static_cast<Integer>(4 * size);
+    const auto long_values = random_sorted_vector(size, max_value, engine);
+
+    for (auto ratio = std::size_t{1}; ratio <= max_ratio; ratio *= 2)
+    {
+        const auto short_values = random_sorted_vector(size / ratio, max_value, engine);
+
+        std::cout << "ratio " << ratio;
+        test_skip("std::set_intersection",
+            [] (const auto & short_values, const auto & long_values)
+            {
+                std::vector<Integer> result;
+                std::set_intersection(short_values.begin(), short_values.end(),
+                    long_values.begin(), long_values.end(), std::back_inserter(result));
+                return result.size();
+            },
+            short_values, long_values, attempts);
+        test_skip("binary", skip_intersect(burst::binary_skip), short_values, long_values, attempts);
+        test_skip("galloping", skip_intersect(burst::galloping_skip), short_values, long_values, attempts);
+        test_skip("linear", skip_intersect(burst::linear_skip), short_values, long_values, attempts);
+        test_skip("adaptive", skip_intersect(burst::adaptive_skip), short_values, long_values, attempts);
+        test_skip("intersect_into",
+            [] (const auto & short_values, const auto & long_values)
+            {
+                std::vector<Integer> result;
+                burst::intersect_into(std::tie(short_values, long_values), std::back_inserter(result));
+                return result.size();
+            },
+            short_values, long_values, attempts);
+        std::cout << std::endl;
+    }
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("ratio-sweep", "Сгенерировать два диапазона и замерить их пересечение при разном "
+            "соотношении размеров вместо чтения диапазонов со стандартного входа")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 22),
+            "Размер длинного диапазона при замере с перебором соотношений")
+        ("max-ratio", bpo::value<std::size_t>()->default_value(1 << 14),
+            "Наибольшее соотношение размеров диапазонов при замере с перебором")
+        ("attempts", bpo::value<std::size_t>()->default_value(5),
+            "Количество испытаний при замере с перебором")
+        ("bits", bpo::value<std::size_t>()->default_value(64),
+            "Разрядность беззнаковых чисел при замере с перебором: 32 или 64");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
 
-    test_std_intersect(values);
-    test_on_the_fly_intersect(values);
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else if (vm.count("ratio-sweep"))
+        {
+            const auto size = vm["size"].as<std::size_t>();
+            const auto max_ratio = vm["max-ratio"].as<std::size_t>();
+            const auto attempts = vm["attempts"].as<std::size_t>();
+            if (vm["bits"].as<std::size_t>() == 32)
+            {
+                test_ratio_sweep<std::uint32_t>(size, max_ratio, attempts);
+            }
+            else
+            {
+                test_ratio_sweep<std::uint64_t>(size, max_ratio, attempts);
+            }
+        }
+        else
+        {
+            std::vector<std::vector<std::int64_t>> values;
+            utility::read_many(std::cin, values);
+
+            test_std_intersect(values);
+            test_on_the_fly_intersect(values);
+            test_intersect_into(values);
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
 }
@@ -1,16 +1,25 @@
 #include <utility/io/read_many.hpp>
 
+#include <burst/algorithm/merge_into.hpp>
 #include <burst/iterator/merge_iterator.hpp>
 #include <burst/range/merge.hpp>
 
 #include <boost/assert.hpp>
+#include <boost/program_options.hpp>
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
+#include <random>
 #include <vector>
 
+using clock_type = std::chrono::steady_clock;
+
 template <typename Container>
 void test_on_the_fly_merge (const Container & values)
 {
@@ -43,6 +52,23 @@ void test_on_the_fly_merge (const Container & values)
     std::cout << std::endl;
 }
 
+template <typename Container>
+void test_merge_into (const Container & values)
+{
+    using nested_container_type = typename Container::value_type;
+
+    clock_t merge_time = clock();
+    nested_container_type merged;
+    burst::merge_into(values, std::back_inserter(merged));
+    merge_time = clock() - merge_time;
+
+    BOOST_VERIFY(std::is_sorted(merged.begin(), merged.end()));
+
+    std::cout << "merge_into:" << std::endl;
+    std::cout << "\t" << static_cast<double>(merge_time) / CLOCKS_PER_SEC << std::endl;
+    std::cout << std::endl;
+}
+
 template <typename Container>
 void test_merge_by_sorting (const Container & values)
 {
@@ -83,12 +109,220 @@ void test_std_merge (const Container & values)
     std::cout << std::endl;
 }
 
-int main ()
+using range_type = boost::iterator_range<std::vector<std::int64_t>::const_iterator>;
+
+std::vector<range_type> make_ranges (const std::vector<std::vector<std::int64_t>> & rows)
+{
+    std::vector<range_type> ranges;
+    for (const auto & row: rows)
+    {
+        ranges.push_back(boost::make_iterator_range(row));
+    }
+    return ranges;
+}
+
+/*!
+    \brief
+        Слияние с помощью пирамиды
+
+    \details
+        Повторяет устройство итератора слияния до появления дерева проигравших: на каждый элемент
+        слияния приходится одно извлечение из пирамиды и одна вставка в неё.
+ */
+std::int64_t heap_merge (std::vector<range_type> ranges)
+{
+    const auto greater_front =
+        [] (const range_type & left, const range_type & right)
+        {
+            return right.front() < left.front();
+        };
+
+    auto checksum = std::int64_t{0};
+    auto end = std::remove_if(ranges.begin(), ranges.end(), [] (const auto & r) {return r.empty();});
+    std::make_heap(ranges.begin(), end, greater_front);
+    while (ranges.begin() != end)
+    {
+        std::pop_heap(ranges.begin(), end, greater_front);
+        auto & range = *std::prev(end);
+        checksum = checksum * 31 + range.front();
+        range.advance_begin(1);
+        if (not range.empty())
+        {
+            std::push_heap(ranges.begin(), end, greater_front);
+        }
+        else
+        {
+            --end;
+        }
+    }
+    return checksum;
+}
+
+std::int64_t burst_merge (std::vector<range_type> ranges)
+{
+    auto checksum = std::int64_t{0};
+    for (auto value: burst::merge(ranges))
+    {
+        checksum = checksum * 31 + value;
+    }
+    return checksum;
+}
+
+std::int64_t burst_merge_into (const std::vector<range_type> & ranges)
+{
+    std::vector<std::int64_t> merged;
+    burst::merge_into(ranges, std::back_inserter(merged));
+
+    auto checksum = std::int64_t{0};
+    for (auto value: merged)
+    {
+        checksum = checksum * 31 + value;
+    }
+    return checksum;
+}
+
+template <typename Merge>
+double best_time (Merge merge, const std::vector<range_type> & ranges, std::size_t attempts, std::int64_t & checksum)
 {
-    std::vector<std::vector<std::int64_t>> values;
-    utility::read_many(std::cin, values);
+    using namespace std::chrono;
+
+    auto best = clock_type::duration::max();
+    for (std::size_t attempt = 0; attempt < attempts; ++attempt)
+    {
+        auto attempt_start_time = clock_type::now();
+        checksum = merge(ranges);
+        best = std::min(best, clock_type::now() - attempt_start_time);
+    }
+    return duration_cast<duration<double>>(best).count();
+}
+
+/*!
+    \brief
+        Упорядоченные диапазоны для замера
 
-    test_merge_by_sorting(values);
-    test_std_merge(values);
-    test_on_the_fly_merge(values);
+    \details
+        Если `run_length` равна нулю, то `size` случайных чисел поровну раскладываются в `k`
+        диапазонов. Иначе числа от `0` до `size` режутся на серии по `run_length` подряд идущих
+        чисел, и каждая серия отправляется в случайный диапазон, так что при слиянии диапазоны
+        сменяют друг друга в среднем через `run_length` элементов.
+ */
+std::vector<std::vector<std::int64_t>> make_rows (std::size_t size, std::size_t k, std::size_t run_length)
+{
+    std::default_random_engine engine;
+    std::vector<std::vector<std::int64_t>> rows(k);
+    if (run_length == 0)
+    {
+        std::uniform_int_distribution<std::int64_t> uniform;
+        for (auto & row: rows)
+        {
+            std::generate_n(std::back_inserter(row), size / k, [& engine, & uniform] {return uniform(engine);});
+            std::sort(row.begin(), row.end());
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<std::size_t> row_index(0, k - 1);
+        for (auto run_start = std::size_t{0}; run_start < size; run_start += run_length)
+        {
+            auto & row = rows[row_index(engine)];
+            for (auto value = run_start; value < std::min(run_start + run_length, size); ++value)
+            {
+                row.push_back(static_cast<std::int64_t>(value));
+            }
+        }
+    }
+    return rows;
+}
+
+/*!
+    \brief
+        Замер слияния в зависимости от количества сливаемых диапазонов
+
+    \details
+        Всего сливается `size` чисел, которые раскладываются в `k` упорядоченных диапазонов
+        (см. `make_rows`), где `k` пробегает степени двойки от 2 до `max_k`.
+        Слияние с помощью пирамиды сравнивается со слиянием итератором `merge_iterator`, который
+        начиная с некоторого `k` переходит на дерево проигравших, и с энергичным слиянием
+        `merge_into`, которое копирует длинные серии целиком.
+ */
+void test_k_sweep (std::size_t size, std::size_t max_k, std::size_t run_length, std::size_t attempts)
+{
+    for (auto k = std::size_t{2}; k <= max_k; k *= 2)
+    {
+        const auto rows = make_rows(size, k, run_length);
+        const auto ranges = make_ranges(rows);
+
+        auto heap_checksum = std::int64_t{0};
+        auto burst_checksum = std::int64_t{0};
+        auto into_checksum = std::int64_t{0};
+        const auto heap_time = best_time(heap_merge, ranges, attempts, heap_checksum);
+        const auto burst_time = best_time(burst_merge, ranges, attempts, burst_checksum);
+        const auto into_time = best_time(burst_merge_into, ranges, attempts, into_checksum);
+        BOOST_VERIFY(heap_checksum == burst_checksum);
+        BOOST_VERIFY(heap_checksum == into_checksum);
+
+        std::cout
+            << "k " << k
+            << " heap " << heap_time
+            << " merge_iterator " << burst_time
+            << " merge_into " << into_time
+            << std::endl;
+    }
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("sweep", "Сгенерировать данные и замерить слияние для разного количества диапазонов "
+            "вместо чтения диапазонов со стандартного входа")
+        ("size", bpo::value<std::size_t>()->default_value(1 << 22),
+            "Суммарный размер сливаемых диапазонов при замере с перебором количества диапазонов")
+        ("max-k", bpo::value<std::size_t>()->default_value(4096),
+            "Наибольшее количество сливаемых диапазонов при замере с перебором")
+        ("run-length", bpo::value<std::size_t>()->default_value(0),
+            "Средняя длина серии одного диапазона в слиянии при замере с перебором; "
+            "0 — случайные числа")
+        ("attempts", bpo::value<std::size_t>()->default_value(5),
+            "Количество испытаний при замере с перебором");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else if (vm.count("sweep"))
+        {
+            test_k_sweep
+            (
+                vm["size"].as<std::size_t>(),
+                vm["max-k"].as<std::size_t>(),
+                vm["run-length"].as<std::size_t>(),
+                vm["attempts"].as<std::size_t>()
+            );
+        }
+        else
+        {
+            std::vector<std::vector<std::int64_t>> values;
+            utility::read_many(std::cin, values);
+
+            test_merge_by_sorting(values);
+            test_std_merge(values);
+            test_on_the_fly_merge(values);
+            test_merge_into(values);
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
 }
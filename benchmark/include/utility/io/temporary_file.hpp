@@ -0,0 +1,74 @@
+#ifndef BURST_BENCHMARK_UTILITY_IO_TEMPORARY_FILE_HPP
+#define BURST_BENCHMARK_UTILITY_IO_TEMPORARY_FILE_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace utility
+{
+    /*!
+        \brief
+            Временный бинарный файл
+
+        \details
+            Открывается на чтение и запись, а при уничтожении закрывается и удаляется.
+     */
+    class temporary_file: public std::fstream
+    {
+    public:
+        explicit temporary_file (std::string path):
+            std::fstream(path, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary),
+            m_path(std::move(path))
+        {
+            if (not is_open())
+            {
+                throw std::runtime_error("Не удалось создать временный файл " + m_path);
+            }
+        }
+
+        ~temporary_file ()
+        {
+            close();
+            std::remove(m_path.c_str());
+        }
+
+    private:
+        std::string m_path;
+    };
+
+    /*!
+        \brief
+            Порождение временных файлов в заданной директории
+
+        \details
+            Предназначено для использования в качестве функции, создающей серии во внешней
+            сортировке. Файлы получают имена `<directory>/run_<номер>`.
+     */
+    class temporary_files
+    {
+    public:
+        explicit temporary_files (std::string directory):
+            m_directory(std::move(directory)),
+            m_count(std::make_shared<std::size_t>(0))
+        {
+        }
+
+        std::unique_ptr<std::iostream> operator () () const
+        {
+            auto path = m_directory + "/run_" + std::to_string((*m_count)++);
+            return std::make_unique<temporary_file>(std::move(path));
+        }
+
+    private:
+        std::string m_directory;
+        std::shared_ptr<std::size_t> m_count;
+    };
+} // namespace utility
+
+#endif // BURST_BENCHMARK_UTILITY_IO_TEMPORARY_FILE_HPP
@@ -0,0 +1,111 @@
+#include <utility/io/temporary_file.hpp>
+
+#include <burst/algorithm/external_radix_sort.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/trivial_read.hpp>
+#include <burst/functional/trivial_write.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/*!
+    \brief
+        Сортировка набора, порождённого утилитой `rangegen`
+
+    \details
+        Набор (размер и следующие за ним 64-битные числа) читается из потока `input`, числа
+        сортируются внешней поразрядной сортировкой с заданным бюджетом памяти, и набор в том
+        же формате записывается в поток `output`.
+ */
+void
+    do_sort
+    (
+        std::istream & input,
+        std::ostream & output,
+        std::size_t memory_budget,
+        const std::string & directory,
+        std::size_t thread_count
+    )
+{
+    auto size = std::size_t{};
+    if (not burst::trivial_read(input, size))
+    {
+        return;
+    }
+    burst::trivial_write(output, size);
+
+    const auto make_run = utility::temporary_files(directory);
+    if (thread_count > 1)
+    {
+        burst::external_radix_sort<std::int64_t>(burst::par(thread_count), input, output, memory_budget, make_run);
+    }
+    else
+    {
+        burst::external_radix_sort<std::int64_t>(input, output, memory_budget, make_run);
+    }
+}
+
+int main (int argc, const char * argv[])
+{
+    namespace bpo = boost::program_options;
+
+    bpo::options_description description("Опции");
+    description.add_options()
+        ("help,h", "Подсказка")
+        ("input", bpo::value<std::string>(),
+            "Входной файл. Если не задан, то набор читается со стандартного входа")
+        ("output", bpo::value<std::string>(),
+            "Выходной файл. Если не задан, то набор пишется на стандартный выход")
+        ("memory", bpo::value<std::size_t>()->default_value(std::size_t{1} << 26),
+            "Бюджет памяти в байтах")
+        ("tmpdir", bpo::value<std::string>()->default_value("/tmp"),
+            "Директория для временных файлов")
+        ("threads", bpo::value<std::size_t>()->default_value(1),
+            "Количество потоков для сортировки блоков");
+
+    try
+    {
+        bpo::variables_map vm;
+        bpo::store(bpo::parse_command_line(argc, argv, description), vm);
+        bpo::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << description << std::endl;
+        }
+        else
+        {
+            std::ifstream input_file;
+            if (vm.count("input"))
+            {
+                input_file.open(vm["input"].as<std::string>(), std::ios::binary);
+            }
+            std::ofstream output_file;
+            if (vm.count("output"))
+            {
+                output_file.open(vm["output"].as<std::string>(), std::ios::binary);
+            }
+            auto & input = vm.count("input") ? static_cast<std::istream &>(input_file) : std::cin;
+            auto & output = vm.count("output") ? static_cast<std::ostream &>(output_file) : std::cout;
+
+            do_sort
+            (
+                input,
+                output,
+                vm["memory"].as<std::size_t>(),
+                vm["tmpdir"].as<std::string>(),
+                vm["threads"].as<std::size_t>()
+            );
+        }
+    }
+    catch (bpo::error & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << description << std::endl;
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef BURST__ALGORITHM__APPLY_PERMUTATION_HPP
+#define BURST__ALGORITHM__APPLY_PERMUTATION_HPP
+
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Применить перестановку к диапазону на месте
+
+        \details
+            Переставляет элементы диапазона `[first, last)` так, что на позиции `i` оказывается
+            элемент, который до вызова стоял на позиции `indices[i]`. Именно такую перестановку
+            возвращает `radix_argsort`.
+
+            Перестановка раскладывается на циклы, и каждый цикл обходится ровно один раз, поэтому
+            каждый элемент переносится не более одного раза, а дополнительная память не
+            требуется. Пройденные индексы помечаются неподвижными точками, поэтому по окончании
+            работы `indices` содержит тождественную перестановку.
+
+        \param [first, last)
+            Переставляемый диапазон.
+        \param indices
+            Итератор на начало перестановки индексов размера `distance(first, last)`.
+            Должен быть итератором произвольного доступа.
+
+        \see radix_argsort
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void
+        apply_permutation
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 indices
+        )
+    {
+        using difference_type = iterator_difference_t<RandomAccessIterator1>;
+        using index_type = iterator_value_t<RandomAccessIterator2>;
+
+        using std::distance;
+        const auto size = distance(first, last);
+        for (auto cycle_start = difference_type{0}; cycle_start < size; ++cycle_start)
+        {
+            if (static_cast<difference_type>(indices[cycle_start]) == cycle_start)
+            {
+                continue;
+            }
+
+            auto value = std::move(first[cycle_start]);
+            auto current = cycle_start;
+            auto next = static_cast<difference_type>(indices[current]);
+            while (next != cycle_start)
+            {
+                first[current] = std::move(first[next]);
+                indices[current] = static_cast<index_type>(current);
+                current = next;
+                next = static_cast<difference_type>(indices[current]);
+            }
+            first[current] = std::move(value);
+            indices[current] = static_cast<index_type>(current);
+        }
+    }
+
+    /*!
+        \brief
+            Перегрузка для работы с диапазонами
+
+        \see apply_permutation
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void apply_permutation (RandomAccessRange && range, RandomAccessIterator indices)
+    {
+        using std::begin;
+        using std::end;
+        apply_permutation(begin(range), end(range), indices);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__APPLY_PERMUTATION_HPP
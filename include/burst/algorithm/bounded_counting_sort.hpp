@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__BOUNDED_COUNTING_SORT_HPP
+#define BURST__ALGORITHM__BOUNDED_COUNTING_SORT_HPP
+
+#include <burst/algorithm/bounded_counting_sort/bounded_counting_sort_par.hpp>
+#include <burst/algorithm/bounded_counting_sort/bounded_counting_sort_seq.hpp>
+
+#endif // BURST__ALGORITHM__BOUNDED_COUNTING_SORT_HPP
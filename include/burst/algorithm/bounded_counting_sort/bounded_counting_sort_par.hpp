@@ -0,0 +1,244 @@
+#ifndef BURST__ALGORITHM__BOUNDED_COUNTING_SORT__BOUNDED_COUNTING_SORT_PAR_HPP
+#define BURST__ALGORITHM__BOUNDED_COUNTING_SORT__BOUNDED_COUNTING_SORT_PAR_HPP
+
+#include <burst/algorithm/bounded_counting_sort/bounded_counting_sort_seq.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_bounded_counting_sort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_par.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Unsigned>
+        void
+            bounded_counting_sort_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Unsigned min,
+                Unsigned max
+            )
+        {
+            using std::distance;
+            const auto range_size = static_cast<std::size_t>(distance(first, last));
+            const auto width = static_cast<Unsigned>(max - min);
+
+            if (is_bounded_counting_profitable(width, range_size))
+            {
+                const auto value_range = static_cast<std::size_t>(width) + 1;
+                counting_sort_in_range(pool, shape, first, last, buffer,
+                    offset_key<std::size_t>(std::move(map), min), value_range);
+            }
+            else
+            {
+                with_narrowest_offset_key(std::move(map), min, width,
+                    [& pool, & shape, & first, & last, & buffer] (auto key)
+                    {
+                        radix_sort_by_key(pool, shape, first, last, buffer, std::move(key), low_byte, direct_scatter);
+                    });
+            }
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Параллельная сортировка подсчётом с границами образа
+
+        \details
+            Если значений образа немного, то каждый поток собирает собственные счётчики для
+            своего куска, как в параллельной сортировке подсчётом, иначе происходит откат на
+            параллельную поразрядную сортировку.
+            Если потоков указано меньше двух или диапазон слишком мал, то вызывается
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see bounded_counting_sort_seq.hpp
+        \see parallel_policy
+     */
+    template
+    <
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename Map,
+        typename Integer
+    >
+    void
+        bounded_counting_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            Integer min,
+            Integer max
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using image_type = std::decay_t<invoke_result_t<Map, value_type>>;
+
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & last, & buffer, & map, min, max] (auto & pool)
+                {
+                    detail::bounded_counting_sort_impl(pool, shape, first, last, buffer,
+                        compose(shift_to_unsigned, std::move(map)),
+                        shift_to_unsigned(static_cast<image_type>(min)),
+                        shift_to_unsigned(static_cast<image_type>(max)));
+                });
+        }
+        else
+        {
+            bounded_counting_sort(first, last, buffer, map, min, max);
+        }
+    }
+
+    /*!
+        \brief
+            Параллельная сортировка подсчётом с границами образа, найденными предварительным
+            проходом
+
+        \details
+            Предварительный проход по диапазону тоже делается параллельно.
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    void
+        bounded_counting_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & last, & buffer, & map] (auto & pool)
+                {
+                    using difference_type = iterator_difference_t<RandomAccessIterator1>;
+                    const auto chunk_size = static_cast<difference_type>(shape[1]);
+
+                    auto key = compose(shift_to_unsigned, std::move(map));
+                    const auto bounds = detail::minmax_image(pool, chunk_size, first, last, key);
+                    detail::bounded_counting_sort_impl(pool, shape, first, last, buffer, std::move(key),
+                        bounds.first, bounds.second);
+                });
+        }
+        else
+        {
+            bounded_counting_sort(first, last, buffer, map);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void
+        bounded_counting_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer
+        )
+    {
+        bounded_counting_sort(par, first, last, buffer, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной сортировки подсчётом с границами образа
+     */
+    template
+    <
+        typename RandomAccessRange,
+        typename RandomAccessIterator,
+        typename Map,
+        typename Integer
+    >
+    void
+        bounded_counting_sort
+        (
+            parallel_policy par,
+            RandomAccessRange && range,
+            RandomAccessIterator buffer,
+            Map map,
+            Integer min,
+            Integer max
+        )
+    {
+        using std::begin;
+        using std::end;
+        bounded_counting_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            map,
+            min,
+            max
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void bounded_counting_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer, Map map)
+    {
+        using std::begin;
+        using std::end;
+        bounded_counting_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            map
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void bounded_counting_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        bounded_counting_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__BOUNDED_COUNTING_SORT__BOUNDED_COUNTING_SORT_PAR_HPP
@@ -0,0 +1,217 @@
+#ifndef BURST__ALGORITHM__BOUNDED_COUNTING_SORT__BOUNDED_COUNTING_SORT_SEQ_HPP
+#define BURST__ALGORITHM__BOUNDED_COUNTING_SORT__BOUNDED_COUNTING_SORT_SEQ_HPP
+
+#include <burst/algorithm/detail/bounded_counting_sort.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_seq.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Сортировка по беззнаковому образу с известными границами
+
+            \details
+                Если значений образа немного, то сортирует подсчётом, иначе — поразрядно по
+                смещённому образу наименьшей подходящей разрядности.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Unsigned>
+        void
+            bounded_counting_sort_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Unsigned min,
+                Unsigned max
+            )
+        {
+            using std::distance;
+            const auto range_size = static_cast<std::size_t>(distance(first, last));
+            const auto width = static_cast<Unsigned>(max - min);
+
+            if (is_bounded_counting_profitable(width, range_size))
+            {
+                const auto value_range = static_cast<std::size_t>(width) + 1;
+                counting_sort_in_range(first, last, buffer, offset_key<std::size_t>(std::move(map), min), value_range);
+            }
+            else
+            {
+                with_narrowest_offset_key(std::move(map), min, width,
+                    [& first, & last, & buffer] (auto key)
+                    {
+                        radix_sort_by_key(first, last, buffer, std::move(key), low_byte, direct_scatter);
+                    });
+            }
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Сортировка подсчётом с границами образа, известными во время исполнения
+
+        \details
+            В отличие от `counting_sort_copy`, количество счётчиков определяется не типом образа, а
+            переданными границами: заводится ровно `max - min + 1` счётчиков. Поэтому можно
+            сортировать подсчётом числа, отображённые, например, в `std::uint32_t`, если все они
+            лежат в отрезке `[1000, 70000]`, а на 16-битных числах, из которых встречается всего
+            несколько сотен значений, не приходится обходить 65536 счётчиков.
+
+            Если значений образа слишком много — счётчики не помещаются в кэш или их больше, чем
+            сортируемых элементов, — то происходит автоматический откат на поразрядную сортировку.
+            При этом сортируется образ, смещённый на `min`, и для него выбирается наименьший
+            беззнаковый тип, поэтому проходов может оказаться меньше, чем у `radix_sort`.
+
+            Сортировка устойчивая. Отсортированный диапазон остаётся на месте исходного.
+
+        \param [first, last)
+            Диапазон, который нужно отсортировать. Должен быть диапазоном произвольного доступа.
+        \param buffer
+            Начало буфера размера не меньше `|[first, last)|`.
+        \param map
+            Отображение элементов в целые числа.
+        \param [min, max]
+            Отрезок, в котором лежат все образы `map(x)`. Если какой-либо образ выходит за его
+            пределы, то поведение не определено.
+
+        \see counting_sort_copy
+        \see radix_sort
+     */
+    template
+    <
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename Map,
+        typename Integer
+    >
+    void
+        bounded_counting_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            Integer min,
+            Integer max
+        )
+    {
+        using value_type = iterator_value_t<RandomAccessIterator1>;
+        using image_type = std::decay_t<invoke_result_t<Map, value_type>>;
+
+        detail::bounded_counting_sort_impl(first, last, buffer, compose(shift_to_unsigned, std::move(map)),
+            shift_to_unsigned(static_cast<image_type>(min)), shift_to_unsigned(static_cast<image_type>(max)));
+    }
+
+    /*!
+        \brief
+            Сортировка подсчётом с границами образа, найденными предварительным проходом
+
+        \details
+            Перед сортировкой делается дополнительный проход по диапазону, на котором находятся
+            наименьший и наибольший образы.
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    void
+        bounded_counting_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map
+        )
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        auto key = compose(shift_to_unsigned, std::move(map));
+        const auto bounds = detail::minmax_image(first, last, key);
+        detail::bounded_counting_sort_impl(first, last, buffer, std::move(key), bounds.first, bounds.second);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void
+        bounded_counting_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer
+        )
+    {
+        bounded_counting_sort(first, last, buffer, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант сортировки подсчётом с границами образа
+
+        \details
+            Отличается только тем, что сортируемые значения задаются не парой итераторов, а
+            диапазоном.
+     */
+    template
+    <
+        typename RandomAccessRange,
+        typename RandomAccessIterator,
+        typename Map,
+        typename Integer
+    >
+    void bounded_counting_sort (RandomAccessRange && range, RandomAccessIterator buffer, Map map, Integer min, Integer max)
+    {
+        using std::begin;
+        using std::end;
+        bounded_counting_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            map,
+            min,
+            max
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void bounded_counting_sort (RandomAccessRange && range, RandomAccessIterator buffer, Map map)
+    {
+        using std::begin;
+        using std::end;
+        bounded_counting_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            map
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void bounded_counting_sort (RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        bounded_counting_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__BOUNDED_COUNTING_SORT__BOUNDED_COUNTING_SORT_SEQ_HPP
@@ -4,13 +4,13 @@
 #include <burst/algorithm/counting_sort/counting_sort_copy_seq.hpp>
 #include <burst/algorithm/detail/get_shape.hpp>
 #include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/write_combining.hpp>
 #include <burst/execution/parallel_policy.hpp>
 #include <burst/functional/compose.hpp>
 #include <burst/functional/identity.hpp>
 #include <burst/integer/shift_to_unsigned.hpp>
 
-#include <boost/asio/thread_pool.hpp>
-
 #include <iterator>
 #include <utility>
 
@@ -39,6 +39,9 @@ namespace burst
                 http://www.heterogeneouscompute.org/wordpress/wp-content/uploads/2011/06/RadixSort.pdf)
             4.  Каждый поток распределяет элементы своего куска по результирующему диапазону.
 
+            Если в `par` передан пул потоков, то сортировка исполняется в нём, а собственный пул
+            не создаётся.
+
         \param par
             Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма, и содержащий
             желаемое количество потоков для параллелизации.
@@ -58,26 +61,56 @@ namespace burst
             RandomAccessIterator2 result,
             Map map
         )
+    {
+        return counting_sort_copy(par, first, last, result, std::move(map), direct_scatter);
+    }
+
+    /*!
+        \brief
+            Параллельная сортировка подсчётом с выбранной стратегией распределения
+
+        \details
+            Каждый поток распределяет элементы своего куска способом, заданным последним
+            аргументом: `direct_scatter` (по умолчанию) или `write_combining`.
+
+        \see write_combining
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Scatter>
+    RandomAccessIterator2
+        counting_sort_copy
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result,
+            Map map,
+            Scatter scatter
+        )
     {
         const auto shape = detail::get_shape(par, first, last);
         const auto thread_count = shape[0];
         if (thread_count > 1)
         {
-            boost::asio::thread_pool pool(thread_count);
             return
-                detail::counting_sort_impl
-                (
-                    pool,
-                    shape,
-                    first,
-                    last,
-                    result,
-                    compose(shift_to_unsigned, std::move(map))
-                );
+                detail::with_thread_pool(par, thread_count,
+                    [& shape, & first, & last, & result, & map, & scatter] (auto & pool)
+                    {
+                        return
+                            detail::counting_sort_impl
+                            (
+                                pool,
+                                shape,
+                                first,
+                                last,
+                                result,
+                                compose(shift_to_unsigned, std::move(map)),
+                                scatter
+                            );
+                    });
         }
         else
         {
-            return counting_sort_copy(first, last, result, map);
+            return counting_sort_copy(first, last, result, map, scatter);
         }
     }
 
@@ -2,6 +2,7 @@
 #define BURST__ALGORITHM__COUNTING_SORT__COUNTING_SORT_COPY_SEQ_HPP
 
 #include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/write_combining.hpp>
 #include <burst/functional/compose.hpp>
 #include <burst/functional/identity.hpp>
 #include <burst/integer/shift_to_unsigned.hpp>
@@ -74,6 +75,38 @@ namespace burst
             );
     }
 
+    /*!
+        \brief
+            Сортировка подсчётом с выбранной стратегией распределения
+
+        \details
+            Последний аргумент задаёт способ, которым элементы записываются в выходной диапазон:
+            `direct_scatter` (по умолчанию) или `write_combining`.
+
+        \see write_combining
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator, typename Map, typename Scatter>
+    RandomAccessIterator
+        counting_sort_copy
+        (
+            ForwardIterator first,
+            ForwardIterator last,
+            RandomAccessIterator result,
+            Map map,
+            Scatter scatter
+        )
+    {
+        return
+            detail::counting_sort_impl
+            (
+                first,
+                last,
+                result,
+                compose(shift_to_unsigned, std::move(map)),
+                scatter
+            );
+    }
+
     /*!
         \brief
             Перегрузка без пользовательского отображения
@@ -45,6 +45,37 @@ namespace burst
             );
     }
 
+    /*!
+        \brief
+            Параллельная сортировка подсчётом с переносом элементов и выбранной стратегией
+            распределения
+
+        \see write_combining
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Scatter>
+    RandomAccessIterator2
+        counting_sort_move
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result,
+            Map map,
+            Scatter scatter
+        )
+    {
+        return
+            counting_sort_copy
+            (
+                par,
+                std::make_move_iterator(first),
+                std::make_move_iterator(last),
+                result,
+                map,
+                scatter
+            );
+    }
+
     /*!
         \brief
             Диапазонный вариант параллельной сортировки подсчётом с переносом элементов из исходного
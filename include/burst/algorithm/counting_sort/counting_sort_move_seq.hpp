@@ -39,6 +39,34 @@ namespace burst
             );
     }
 
+    /*!
+        \brief
+            Сортировка подсчётом с переносом элементов и выбранной стратегией распределения
+
+        \see write_combining
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator, typename Map, typename Scatter>
+    RandomAccessIterator
+        counting_sort_move
+        (
+            ForwardIterator first,
+            ForwardIterator last,
+            RandomAccessIterator result,
+            Map map,
+            Scatter scatter
+        )
+    {
+        return
+            counting_sort_copy
+            (
+                std::make_move_iterator(first),
+                std::make_move_iterator(last),
+                result,
+                map,
+                scatter
+            );
+    }
+
     /*!
         \brief
             Диапазонный вариант сортировки подсчётом с переносом элементов из исходного диапазона в
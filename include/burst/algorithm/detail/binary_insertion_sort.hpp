@@ -0,0 +1,30 @@
+#ifndef BURST__ALGORITHM__DETAIL__BINARY_INSERTION_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__BINARY_INSERTION_SORT_HPP
+
+#include <algorithm>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Сортировка вставками с двоичным поиском места вставки
+
+            \details
+                Устойчива, потому что каждый элемент вставляется после всех равных ему.
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        void binary_insertion_sort (RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+        {
+            for (auto current = first; current != last; ++current)
+            {
+                const auto position = std::upper_bound(first, current, *current, compare);
+                std::rotate(position, current, std::next(current));
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__BINARY_INSERTION_SORT_HPP
@@ -0,0 +1,183 @@
+#ifndef BURST__ALGORITHM__DETAIL__BOUNDED_COUNTING_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__BOUNDED_COUNTING_SORT_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Наибольшее количество счётчиков сортировки подсчётом с заданными границами
+
+            \details
+                Массив из стольких счётчиков помещается в кэш первого уровня. Если значений образа
+                больше, то поразрядная сортировка по смещённому образу оказывается быстрее: ей
+                хватает двух проходов с небольшими массивами счётчиков вплоть до 65536 значений.
+         */
+        constexpr auto bounded_counting_sort_max_range = std::size_t{1} << 12;
+
+        /*!
+            \brief
+                Выгодна ли сортировка подсчётом при заданной ширине диапазона образов
+
+            \details
+                Кроме ограничения на размер массива счётчиков учитывается и размер сортируемого
+                диапазона: подготовка счётчиков занимает время `O(M)`, поэтому если значений
+                образа больше, чем сортируемых элементов (и чем счётчиков одного прохода
+                поразрядной сортировки), то поразрядная сортировка обойдётся дешевле.
+
+            \param width
+                Разность между наибольшим и наименьшим образами, то есть `M - 1`.
+            \param size
+                Количество сортируемых элементов.
+         */
+        template <typename Unsigned>
+        bool is_bounded_counting_profitable (Unsigned width, std::size_t size)
+        {
+            using wide_type = std::common_type_t<Unsigned, std::size_t>;
+            constexpr auto radix_value_range = std::size_t{1} << std::numeric_limits<std::uint8_t>::digits;
+
+            const auto range_limit = std::min(bounded_counting_sort_max_range, std::max(size, radix_value_range));
+            return static_cast<wide_type>(width) < static_cast<wide_type>(range_limit);
+        }
+
+        /*!
+            \brief
+                Смещение образа к нулю
+
+            \details
+                Вычитает из беззнакового образа `map(x)` наименьшее значение образа `min` и
+                приводит разность к типу `Key`. Тип `Key` может быть уже типа образа, если
+                разность между наибольшим и наименьшим образами в нём помещается.
+         */
+        template <typename Key, typename Map, typename Unsigned>
+        struct offset_key_fn
+        {
+            template <typename Value>
+            constexpr Key operator () (const Value & value) const
+            {
+                return static_cast<Key>(map(value) - min);
+            }
+
+            Map map;
+            Unsigned min;
+        };
+
+        template <typename Key, typename Map, typename Unsigned>
+        constexpr auto offset_key (Map map, Unsigned min)
+        {
+            return offset_key_fn<Key, Map, Unsigned>{std::move(map), min};
+        }
+
+        template <typename Narrow, typename Wide>
+        using narrowest_t = std::conditional_t<(sizeof(Narrow) < sizeof(Wide)), Narrow, Wide>;
+
+        /*!
+            \brief
+                Вызов функции со смещённым образом наименьшей разрядности
+
+            \details
+                Выбирает наименьший из беззнаковых типов, в который помещается разность между
+                наибольшим и наименьшим образами, и передаёт в функцию `f` смещённый образ этого
+                типа. Поразрядной сортировке по такому образу нужно меньше проходов, чем по
+                исходному: например, 64-битные числа из диапазона шириной в миллион сортируются
+                по 32-битному ключу.
+         */
+        template <typename Map, typename Unsigned, typename UnaryFunction>
+        void with_narrowest_offset_key (Map map, Unsigned min, Unsigned width, UnaryFunction && f)
+        {
+            using wide_type = std::common_type_t<Unsigned, std::uint64_t>;
+            const auto wide_width = static_cast<wide_type>(width);
+
+            if (wide_width <= std::numeric_limits<std::uint16_t>::max())
+            {
+                f(offset_key<narrowest_t<std::uint16_t, Unsigned>>(std::move(map), min));
+            }
+            else if (wide_width <= std::numeric_limits<std::uint32_t>::max())
+            {
+                f(offset_key<narrowest_t<std::uint32_t, Unsigned>>(std::move(map), min));
+            }
+            else if (wide_width <= std::numeric_limits<std::uint64_t>::max())
+            {
+                f(offset_key<narrowest_t<std::uint64_t, Unsigned>>(std::move(map), min));
+            }
+            else
+            {
+                f(offset_key<Unsigned>(std::move(map), min));
+            }
+        }
+
+        /*!
+            \brief
+                Наименьший и наибольший образы непустого диапазона
+
+            \returns
+                Пару `(min, max)` образов `map(x)` по всем `x` из `[first, last)`.
+         */
+        template <typename ForwardIterator, typename Map>
+        auto minmax_image (ForwardIterator first, ForwardIterator last, Map & map)
+        {
+            const auto image = map(*first);
+            auto bounds = std::make_pair(image, image);
+            std::for_each(std::next(first), last,
+                [& bounds, & map] (const auto & value)
+                {
+                    const auto image = map(value);
+                    if (image < bounds.first)
+                    {
+                        bounds.first = image;
+                    }
+                    else if (bounds.second < image)
+                    {
+                        bounds.second = image;
+                    }
+                });
+            return bounds;
+        }
+
+        /*!
+            \brief
+                Сортировка подсчётом с количеством счётчиков, известным только во время исполнения
+
+            \details
+                Образы `key(x)` должны лежать в полуинтервале `[0, value_range)`. Элементы
+                распределяются в буфер, а затем переносятся обратно в исходный диапазон.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key>
+        void
+            counting_sort_in_range
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                std::size_t value_range
+            )
+        {
+            using counter_type = iterator_difference_t<RandomAccessIterator1>;
+
+            // Единица для дополнительного нуля в начале массива.
+            auto counters = std::vector<counter_type>(value_range + 1, 0);
+            count(first, last, key, counters.data() + 1);
+            std::partial_sum(counters.begin(), counters.end(), counters.begin());
+
+            dispose(std::make_move_iterator(first), std::make_move_iterator(last), buffer, key, counters.data());
+            std::move(buffer, buffer + counters.back(), first);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__BOUNDED_COUNTING_SORT_HPP
@@ -0,0 +1,201 @@
+#ifndef BURST__ALGORITHM__DETAIL__CACHED_KEY_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__CACHED_KEY_RADIX_SORT_HPP
+
+#include <burst/algorithm/detail/image_bit_count.hpp>
+#include <burst/algorithm/detail/radix_argsort.hpp>
+#include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Ключ из пары `keyed_index`
+
+            \details
+                Объявляет то же количество значащих битов, что и отображение, которым ключ был
+                вычислен, чтобы поразрядная сортировка пар делала столько же проходов, сколько
+                сделала бы сортировка самих элементов.
+         */
+        template <std::size_t BitCount>
+        struct cached_key_fn: key_of_fn
+        {
+            constexpr static auto bit_count = BitCount;
+        };
+
+        /*!
+            \brief
+                Хватает ли 32-битных номеров на диапазон заданного размера
+
+            \details
+                Общее правило выбора типа номеров для последовательной и параллельной сортировок
+                по вычисленным ключам: `std::uint32_t`, если диапазон позволяет, иначе
+                `std::size_t`.
+         */
+        inline bool is_narrow_key_index_enough (std::size_t size)
+        {
+            return size <= std::numeric_limits<std::uint32_t>::max();
+        }
+
+        /*!
+            \brief
+                Выгодно ли автоматически сортировать по вычисленным ключам
+
+            \details
+                Сортировка по вычисленным ключам переносит на каждом проходе пары из ключа и
+                32-битного номера, а исходные элементы переносит дважды в самом конце: в буфер и
+                обратно. Это выгодно, когда элементы хотя бы вдвое больше таких пар, а проходов
+                больше двух: при одном или двух проходах прямая сортировка тоже переносит каждый
+                элемент не больше двух раз.
+         */
+        template <typename Value, typename Key, typename Radix>
+        struct is_key_cache_profitable:
+            std::integral_constant
+            <
+                bool,
+                (2 * sizeof(keyed_index<std::decay_t<invoke_result_t<Key, Value>>, std::uint32_t>) <= sizeof(Value) &&
+                    radix_sort_traits<Value, Key, Radix>::radix_count > 2)
+            >
+        {
+        };
+
+        //!     Размер диапазона, начиная с которого ключи вычисляются заранее автоматически.
+        constexpr auto key_cache_threshold = std::ptrdiff_t{1} << 10;
+
+        /*!
+            \brief
+                Первая пара, номер которой не совпадает с её позицией
+
+            \details
+                Элементы, соответствующие парам до неё, уже стоят на своих местах, и переносить
+                их не нужно. Если входной диапазон был упорядочен, то возвращается конец пар.
+         */
+        template <typename RandomAccessIterator>
+        RandomAccessIterator first_displaced (RandomAccessIterator cached_first, RandomAccessIterator cached_last)
+        {
+            auto position = std::size_t{0};
+            return std::find_if(cached_first, cached_last,
+                [& position] (const auto & cached)
+                {
+                    return static_cast<std::size_t>(index_of(cached)) != position++;
+                });
+        }
+
+        //!     Перестановка элементов в порядке, заданном номерами из отсортированных пар.
+        template <typename RandomAccessIterator1, typename ForwardIterator, typename RandomAccessIterator2>
+        void gather_by_cached_keys (RandomAccessIterator1 first, ForwardIterator cached_first, ForwardIterator cached_last, RandomAccessIterator2 result)
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            std::transform(cached_first, cached_last, result,
+                [first] (const auto & cached)
+                {
+                    return std::move(*std::next(first, static_cast<difference_type>(index_of(cached))));
+                });
+        }
+
+        /*!
+            \brief
+                Поразрядная сортировка по заранее вычисленным ключам
+
+            \details
+                Вычисляет ключи всех элементов, записывая рядом с каждым ключом номер элемента,
+                сортирует получившиеся пары поразрядно, затем переносит элементы в буфер в
+                порядке номеров из отсортированных пар, а из буфера — обратно во входной
+                диапазон. Элементы в начале диапазона, которые уже стоят на своих местах, не
+                переносятся, поэтому упорядоченный диапазон не переносится совсем.
+                Поразрядная сортировка устойчива, поэтому элементы с равными ключами сохраняют
+                исходный порядок.
+
+            \see cache_keys
+         */
+        template
+        <
+            typename Counter,
+            typename Index,
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Key,
+            typename Radix
+        >
+        void
+            cached_key_radix_sort_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using cached_type = keyed_index_for_t<Index, RandomAccessIterator1, Key>;
+
+            using std::distance;
+            const auto range_size = distance(first, last);
+            auto cached = make_uninitialized_array<cached_type>(2 * static_cast<std::size_t>(range_size));
+            const auto cached_first = cached.get();
+            const auto cached_last = cached_first + range_size;
+
+            auto index = Index{0};
+            std::transform(first, last, cached_first,
+                [& key, & index] (const auto & value)
+                {
+                    return cached_type{key(value), index++};
+                });
+
+            constexpr auto bit_count = image_bit_count<Key, value_type>::value;
+            radix_sort_impl<Counter>(cached_first, cached_last, cached_last, cached_key_fn<bit_count>{}, radix);
+
+            const auto displaced = first_displaced(cached_first, cached_last);
+            const auto placed_count = displaced - cached_first;
+            gather_by_cached_keys(first, displaced, cached_last, buffer);
+            std::move(buffer, std::next(buffer, range_size - placed_count), std::next(first, placed_count));
+        }
+
+        /*!
+            \brief
+                Выбор типа номеров по правилу `is_narrow_key_index_enough`
+
+            \details
+                Диапазон, который сортируется с 32-битными счётчиками, заведомо помещается в
+                32-битные номера.
+         */
+        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key, typename Radix>
+        void
+            cached_key_radix_sort_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix
+            )
+        {
+            using std::distance;
+            if (sizeof(Counter) <= sizeof(std::uint32_t) ||
+                is_narrow_key_index_enough(static_cast<std::size_t>(distance(first, last))))
+            {
+                cached_key_radix_sort_impl<Counter, std::uint32_t>(first, last, buffer, std::move(key), radix);
+            }
+            else
+            {
+                cached_key_radix_sort_impl<Counter, std::size_t>(first, last, buffer, std::move(key), radix);
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__CACHED_KEY_RADIX_SORT_HPP
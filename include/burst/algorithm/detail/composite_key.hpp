@@ -0,0 +1,247 @@
+#ifndef BURST__ALGORITHM__DETAIL__COMPOSITE_KEY_HPP
+#define BURST__ALGORITHM__DETAIL__COMPOSITE_KEY_HPP
+
+#include <burst/functional/compose.hpp>
+#include <burst/integer/divceil.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/integer/to_ordered_integral.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/unsigned_integer_of_size.hpp>
+#include <burst/variadic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Является ли образ отображения составным ключом, то есть кортежем или парой.
+        template <typename T>
+        struct is_composite_key: std::false_type {};
+
+        template <typename ... Ts>
+        struct is_composite_key<std::tuple<Ts...>>: std::true_type {};
+
+        template <typename T, typename U>
+        struct is_composite_key<std::pair<T, U>>: std::true_type {};
+
+        //!     Упорядоченное беззнаковое представление одного поля составного ключа.
+        struct order_field_fn
+        {
+            template <typename Arithmetic>
+            constexpr auto operator () (Arithmetic value) const
+            {
+                return shift_to_unsigned(to_ordered_integral(value));
+            }
+        };
+
+        constexpr auto order_field = order_field_fn{};
+
+        //!     Наименьший беззнаковый тип, вмещающий `BitCount` битов.
+        template <std::size_t BitCount>
+        using packed_word_t =
+            unsigned_integer_of_size_t
+            <
+                BitCount <= 8 ? 1 :
+                BitCount <= 16 ? 2 :
+                BitCount <= 32 ? 4 :
+                8
+            >;
+
+        constexpr auto packed_word_bit_count = std::size_t{64};
+
+        /*!
+            \brief
+                Раскладка составного ключа по битам
+
+            \details
+                Каждое поле кортежа приводится к упорядоченному беззнаковому целому и занимает
+                столько битов, сколько значащих битов в этом целом. Поля укладываются друг за
+                другом, начиная со старших битов: первое поле — самое старшее, последнее —
+                самое младшее. Получившееся число делится на 64-битные слова, причём слово
+                с номером `0` — самое младшее, а самое старшее слово может быть уже 64 битов.
+         */
+        template <typename Key, typename = std::make_index_sequence<std::tuple_size<Key>::value>>
+        struct composite_key_layout;
+
+        template <typename Key, std::size_t ... Fields>
+        struct composite_key_layout<Key, std::index_sequence<Fields...>>
+        {
+            template <std::size_t Field>
+            using field_type =
+                std::decay_t<invoke_result_t<order_field_fn, std::decay_t<std::tuple_element_t<Field, Key>>>>;
+
+            static constexpr std::size_t field_bit_count (std::size_t field)
+            {
+                const std::size_t bit_counts[] =
+                    {static_cast<std::size_t>(std::numeric_limits<field_type<Fields>>::digits)...};
+                return bit_counts[field];
+            }
+
+            //!     Номер младшего бита поля в составном ключе.
+            static constexpr std::size_t field_offset (std::size_t field)
+            {
+                auto offset = std::size_t{0};
+                for (auto next = field + 1; next < sizeof...(Fields); ++next)
+                {
+                    offset += field_bit_count(next);
+                }
+                return offset;
+            }
+
+            static constexpr std::size_t bit_count ()
+            {
+                return field_offset(0) + field_bit_count(0);
+            }
+
+            static constexpr std::size_t word_count ()
+            {
+                return divceil(bit_count(), packed_word_bit_count);
+            }
+
+            static constexpr std::size_t word_bit_count (std::size_t word)
+            {
+                return
+                    bit_count() - word * packed_word_bit_count < packed_word_bit_count
+                        ? bit_count() - word * packed_word_bit_count
+                        : packed_word_bit_count;
+            }
+        };
+
+        /*!
+            \brief
+                Одно слово упакованного составного ключа
+
+            \details
+                Применяет к элементу отображение `map`, возвращающее кортеж, упаковывает поля
+                кортежа согласно `composite_key_layout` и возвращает слово номер `Word`.
+                Количество значащих битов слова объявлено в поле `bit_count`, поэтому
+                поразрядная сортировка делает ровно столько проходов, сколько нужно для этих
+                битов.
+         */
+        template <typename Map, typename Key, std::size_t Word>
+        struct composite_key_word_fn
+        {
+            using layout = composite_key_layout<Key>;
+
+            constexpr static auto bit_count = layout::word_bit_count(Word);
+            using result_type = packed_word_t<bit_count>;
+
+            template <typename Value>
+            result_type operator () (const Value & value) const
+            {
+                return pack(map(value), std::make_index_sequence<std::tuple_size<Key>::value>{});
+            }
+
+            template <typename Tuple, std::size_t ... Fields>
+            static result_type pack (const Tuple & key, std::index_sequence<Fields...>)
+            {
+                auto word = std::uint64_t{0};
+                BURST_EXPAND_VARIADIC(word |= field_part<Fields>(std::get<Fields>(key)));
+                return static_cast<result_type>(word);
+            }
+
+            //!     Часть поля `Field`, попадающая в слово `Word`, сдвинутая на своё место в слове.
+            template <std::size_t Field, typename Arithmetic>
+            static std::uint64_t field_part (Arithmetic field)
+            {
+                constexpr auto field_begin = layout::field_offset(Field);
+                constexpr auto field_end = field_begin + layout::field_bit_count(Field);
+                constexpr auto word_begin = Word * packed_word_bit_count;
+                constexpr auto word_end = word_begin + packed_word_bit_count;
+                static_assert(layout::field_bit_count(Field) <= packed_word_bit_count, "");
+
+                const auto bits = static_cast<std::uint64_t>(order_field(field));
+                if (field_end <= word_begin || field_begin >= word_end)
+                {
+                    return 0;
+                }
+                else if (field_begin >= word_begin)
+                {
+                    return bits << ((field_begin - word_begin) % packed_word_bit_count);
+                }
+                else
+                {
+                    return bits >> ((word_begin - field_begin) % packed_word_bit_count);
+                }
+            }
+
+            Map map;
+        };
+
+        template <typename Value, typename Map, typename UnaryFunction, std::size_t ... Words>
+        void
+            for_each_key_word
+            (
+                const Map & map,
+                UnaryFunction && f,
+                std::true_type,
+                std::index_sequence<Words...>
+            )
+        {
+            using key_type = std::decay_t<invoke_result_t<Map, Value>>;
+            BURST_EXPAND_VARIADIC(f(composite_key_word_fn<Map, key_type, Words>{map}));
+        }
+
+        template <typename Value, typename Map, typename UnaryFunction>
+        void for_each_key_word (Map map, UnaryFunction && f, std::true_type)
+        {
+            using key_type = std::decay_t<invoke_result_t<Map, Value>>;
+            constexpr auto word_count = composite_key_layout<key_type>::word_count();
+            for_each_key_word<Value>(map, f, std::true_type{}, std::make_index_sequence<word_count>{});
+        }
+
+        template <typename Value, typename Map, typename UnaryFunction>
+        void for_each_key_word (Map map, UnaryFunction && f, std::false_type)
+        {
+            f(compose(shift_to_unsigned, std::move(map)));
+        }
+
+        template <typename Value, typename Map>
+        auto first_key_word (Map map, std::true_type)
+        {
+            using key_type = std::decay_t<invoke_result_t<Map, Value>>;
+            return composite_key_word_fn<Map, key_type, 0>{std::move(map)};
+        }
+
+        template <typename Value, typename Map>
+        auto first_key_word (Map map, std::false_type)
+        {
+            return compose(shift_to_unsigned, std::move(map));
+        }
+
+        //!     Отображение в младшее слово ключа сортировки (см. `for_each_key_word`).
+        template <typename Value, typename Map>
+        auto first_key_word (Map map)
+        {
+            using key_type = std::decay_t<invoke_result_t<Map, Value>>;
+            return first_key_word<Value>(std::move(map), is_composite_key<key_type>{});
+        }
+
+        /*!
+            \brief
+                Перебор слов ключа сортировки, начиная с младшего
+
+            \details
+                Если отображение `map` возвращает целое число, то `f` вызывается один раз с
+                отображением в беззнаковое целое (см. `shift_to_unsigned`).
+                Если же оно возвращает составной ключ (кортеж или пару), то ключ упаковывается в
+                одно или несколько беззнаковых слов, и `f` вызывается с отображением в каждое
+                слово, начиная с младшего. Устойчивая сортировка по всем словам по очереди
+                упорядочивает элементы по составному ключу.
+         */
+        template <typename Value, typename Map, typename UnaryFunction>
+        void for_each_key_word (Map map, UnaryFunction && f)
+        {
+            using key_type = std::decay_t<invoke_result_t<Map, Value>>;
+            for_each_key_word<Value>(std::move(map), std::forward<UnaryFunction>(f), is_composite_key<key_type>{});
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__COMPOSITE_KEY_HPP
@@ -0,0 +1,93 @@
+#ifndef BURST__ALGORITHM__DETAIL__COPY_RUN_HPP
+#define BURST__ALGORITHM__DETAIL__COPY_RUN_HPP
+
+#include <burst/algorithm/detail/reserve_output.hpp>
+#include <burst/type_traits/void_t.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename Container, typename Iterator, typename = void>
+        struct has_range_insert: std::false_type {};
+
+        template <typename Container, typename Iterator>
+        struct has_range_insert
+            <
+                Container,
+                Iterator,
+                void_t
+                <
+                    decltype
+                    (
+                        std::declval<Container &>().insert
+                        (
+                            std::declval<Container &>().end(),
+                            std::declval<Iterator>(),
+                            std::declval<Iterator>()
+                        )
+                    )
+                >
+            >:
+            std::true_type {};
+
+        template <typename ForwardIterator, typename Container>
+        std::back_insert_iterator<Container>
+            copy_run_impl
+            (
+                ForwardIterator first, ForwardIterator last,
+                std::back_insert_iterator<Container> result,
+                std::true_type
+            )
+        {
+            auto & container = back_insert_container<Container>::get(result);
+            container.insert(container.end(), first, last);
+            return result;
+        }
+
+        template <typename ForwardIterator, typename Container>
+        std::back_insert_iterator<Container>
+            copy_run_impl
+            (
+                ForwardIterator first, ForwardIterator last,
+                std::back_insert_iterator<Container> result,
+                std::false_type
+            )
+        {
+            return std::copy(first, last, result);
+        }
+
+        /*!
+            \brief
+                Скопировать серию элементов в выходной итератор
+
+            \details
+                Если `result` вставляет в конец контейнера, то серия вставляется в контейнер
+                одним вызовом `insert`, который сразу выделяет место под всю серию, вместо того
+                чтобы вставлять элементы по одному.
+         */
+        template <typename ForwardIterator, typename Container>
+        std::back_insert_iterator<Container>
+            copy_run
+            (
+                ForwardIterator first, ForwardIterator last,
+                std::back_insert_iterator<Container> result
+            )
+        {
+            return copy_run_impl(first, last, result, has_range_insert<Container, ForwardIterator>{});
+        }
+
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator copy_run (InputIterator first, InputIterator last, OutputIterator result)
+        {
+            return std::copy(first, last, result);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__COPY_RUN_HPP
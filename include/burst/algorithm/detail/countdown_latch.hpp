@@ -0,0 +1,77 @@
+#ifndef BURST__ALGORITHM__DETAIL__COUNTDOWN_LATCH_HPP
+#define BURST__ALGORITHM__DETAIL__COUNTDOWN_LATCH_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Одноразовый счётчик завершения задач
+
+            \details
+                Аналог `std::latch` из C++20 с возможностью передать ожидающему потоку исключение.
+                Каждая задача по завершении вызывает `count_down` (или `fail`, если она завершилась
+                исключением), а ожидающий поток вызывает `wait`, который возвращает управление,
+                когда все задачи отчитались. Если хотя бы одна задача завершилась исключением, то
+                первое из них выбрасывается из `wait`.
+         */
+        class countdown_latch
+        {
+        public:
+            explicit countdown_latch (std::size_t count):
+                m_count(count)
+            {
+            }
+
+            countdown_latch (const countdown_latch &) = delete;
+            countdown_latch & operator = (const countdown_latch &) = delete;
+
+            void count_down ()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_count == 0)
+                {
+                    m_done.notify_one();
+                }
+            }
+
+            void fail (std::exception_ptr error)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (not m_error)
+                {
+                    m_error = std::move(error);
+                }
+                if (--m_count == 0)
+                {
+                    m_done.notify_one();
+                }
+            }
+
+            void wait ()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done.wait(lock, [this] {return m_count == 0;});
+                if (m_error)
+                {
+                    std::rethrow_exception(m_error);
+                }
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_done;
+            std::size_t m_count;
+            std::exception_ptr m_error;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__COUNTDOWN_LATCH_HPP
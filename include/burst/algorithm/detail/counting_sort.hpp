@@ -2,13 +2,17 @@
 #define BURST__ALGORITHM__DETAIL__COUNTING_SORT_HPP
 
 #include <burst/algorithm/detail/counting_sort_traits.hpp>
+#include <burst/algorithm/detail/write_combining.hpp>
+#include <burst/algorithm/write_combining.hpp>
 #include <burst/container/access/cback.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
 #include <burst/type_traits/iterator_value.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 
 namespace burst
@@ -125,12 +129,222 @@ namespace burst
                 });
         }
 
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                direct_scatter_fn
+            )
+        {
+            dispose(first, last, result, map, counters);
+        }
+
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose_backward
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                direct_scatter_fn
+            )
+        {
+            dispose_backward(first, last, result, map, counters);
+        }
+
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_fn,
+                std::true_type
+            )
+        {
+            dispose_write_combining(first, last, result, map, counters);
+        }
+
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_fn,
+                std::false_type
+            )
+        {
+            dispose(first, last, result, map, counters);
+        }
+
+        /*!
+            \brief
+                Расставить по местам через буферы объединения записи
+
+            \details
+                Буферы объединения записи применимы только к тривиальным типам. Остальные типы
+                распределяются напрямую.
+
+            \see dispose_write_combining
+         */
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_fn scatter
+            )
+        {
+            using is_trivial = std::is_trivial<iterator_value_t<ForwardIterator>>;
+            dispose(first, last, result, map, counters, scatter, is_trivial{});
+        }
+
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose_backward
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_fn,
+                std::true_type
+            )
+        {
+            dispose_backward_write_combining(first, last, result, map, counters);
+        }
+
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose_backward
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_fn,
+                std::false_type
+            )
+        {
+            dispose_backward(first, last, result, map, counters);
+        }
+
+        //!     Аналог `dispose` с буферами объединения записи для прохода в обратном порядке.
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose_backward
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_fn scatter
+            )
+        {
+            using is_trivial = std::is_trivial<iterator_value_t<BidirectionalIterator>>;
+            dispose_backward(first, last, result, map, counters, scatter, is_trivial{});
+        }
+
+        //!     Распределение через буферы, выделенные заранее на всю сортировку.
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2,
+            typename Value,
+            std::size_t ValueRange
+        >
+        void
+            dispose_backward
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_scatter<Value, ValueRange> scatter
+            )
+        {
+            dispose_backward_write_combining(first, last, result, map, counters, *scatter.buffers);
+        }
+
         template
         <
             typename Counter,
             typename ForwardIterator,
             typename RandomAccessIterator,
-            typename Map
+            typename Map,
+            typename Scatter = direct_scatter_fn
         >
         RandomAccessIterator
             counting_sort_impl
@@ -138,7 +352,8 @@ namespace burst
                 ForwardIterator first,
                 ForwardIterator last,
                 RandomAccessIterator result,
-                Map map
+                Map map,
+                Scatter scatter = Scatter{}
             )
         {
             using value_type = iterator_value_t<ForwardIterator>;
@@ -149,19 +364,26 @@ namespace burst
             counter_type counters[traits::value_range + 1] = {0};
 
             collect(first, last, map, std::next(std::begin(counters)));
-            dispose(first, last, result, map, std::begin(counters));
+            dispose(first, last, result, map, std::begin(counters), scatter);
 
             return result + burst::cback(counters);
         }
 
-        template <typename ForwardIterator, typename RandomAccessIterator, typename Map>
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator,
+            typename Map,
+            typename Scatter = direct_scatter_fn
+        >
         RandomAccessIterator
             counting_sort_impl
             (
                 ForwardIterator first,
                 ForwardIterator last,
                 RandomAccessIterator result,
-                Map map
+                Map map,
+                Scatter scatter = Scatter{}
             )
         {
             return
@@ -170,7 +392,8 @@ namespace burst
                     first,
                     last,
                     result,
-                    map
+                    map,
+                    scatter
                 );
         }
     } // namespace detail
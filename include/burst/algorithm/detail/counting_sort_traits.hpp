@@ -1,11 +1,11 @@
 #ifndef BURST__ALGORITHM__DETAIL__COUNTING_SORT_TRAITS_HPP
 #define BURST__ALGORITHM__DETAIL__COUNTING_SORT_TRAITS_HPP
 
-#include <burst/integer/intlog2.hpp>
+#include <burst/algorithm/detail/image_bit_count.hpp>
 #include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/is_integer.hpp>
 
-#include <cstdint>
-#include <limits>
+#include <cstddef>
 #include <type_traits>
 
 namespace burst
@@ -18,12 +18,12 @@ namespace burst
             using image_type = std::decay_t<invoke_result_t<Map, Value>>;
             static_assert
             (
-                std::is_integral<image_type>::value && std::is_unsigned<image_type>::value,
+                is_unsigned_integer<image_type>::value,
                 "Сортируемые элементы должны быть отображены в целые числа."
             );
 
-            constexpr static const auto value_range = std::numeric_limits<image_type>::max() + 1;
-            constexpr static auto radix_size = intlog2<std::uint64_t>(value_range);
+            constexpr static auto radix_size = image_bit_count<Map, Value>::value;
+            constexpr static const auto value_range = std::size_t{1} << radix_size;
         };
     } // namespace detail
 } // namespace burst
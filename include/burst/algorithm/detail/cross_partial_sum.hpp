@@ -2,31 +2,96 @@
 #define BURST__ALGORITHM__DETAIL__CROSS_PARTIAL_SUM_HPP
 
 #include <cstddef>
+#include <type_traits>
 
 namespace burst
 {
     namespace detail
     {
-        // TODO: https://github.com/izvolov/burst/issues/149
-        template <typename RandomAccessIterator>
-        void
+        /*!
+            \brief
+                Сквозные частичные суммы по столбцам `[first_column, last_column)`
+
+            \details
+                Элементы таблицы `values` из `block_count` строк обходятся по столбцам сверху
+                вниз, а столбцы — слева направо, и каждый элемент заменяется суммой `sum` и всех
+                предшествующих ему при таком обходе элементов выбранных столбцов.
+
+            \returns
+                Сумму `sum` и всех элементов выбранных столбцов.
+         */
+        template <typename RandomAccessIterator, typename Value>
+        Value
             cross_partial_sum
             (
                 RandomAccessIterator values,
                 std::size_t block_count,
-                std::size_t block_size
+                std::size_t first_column,
+                std::size_t last_column,
+                Value sum
             )
         {
-            for (auto global_pos = 1ul; global_pos < block_count * block_size; ++global_pos)
+            for (auto column = first_column; column < last_column; ++column)
             {
-                auto prev_block = (global_pos - 1) % block_count;
-                auto prev_block_pos = (global_pos - 1) / block_count;
+                for (auto block = 0ul; block < block_count; ++block)
+                {
+                    sum += values[block][column];
+                    values[block][column] = sum;
+                }
+            }
+
+            return sum;
+        }
 
-                auto current_block = global_pos % block_count;
-                auto current_block_pos = global_pos / block_count;
+        /*!
+            \brief
+                Сумма элементов столбцов `[first_column, last_column)`
 
-                values[current_block][current_block_pos] += values[prev_block][prev_block_pos];
+            \details
+                Строки обходятся последовательно, чтобы чтение шло по соседним ячейкам памяти.
+         */
+        template <typename RandomAccessIterator, typename Value>
+        Value
+            cross_sum
+            (
+                RandomAccessIterator values,
+                std::size_t block_count,
+                std::size_t first_column,
+                std::size_t last_column,
+                Value sum
+            )
+        {
+            for (auto block = 0ul; block < block_count; ++block)
+            {
+                const auto row = values[block];
+                for (auto column = first_column; column < last_column; ++column)
+                {
+                    sum += row[column];
+                }
             }
+
+            return sum;
+        }
+
+        /*!
+            \brief
+                Сквозные частичные суммы счётчиков нескольких кусков
+
+            \details
+                После вызова `values[b][i]` содержит сумму счётчиков `values[*][j]` всех кусков
+                для `j < i` и счётчиков `values[c][i]` для `c <= b`.
+         */
+        template <typename RandomAccessIterator>
+        void
+            cross_partial_sum
+            (
+                RandomAccessIterator values,
+                std::size_t block_count,
+                std::size_t block_size
+            )
+        {
+            using value_type = std::decay_t<decltype(values[0][0])>;
+            cross_partial_sum(values, block_count, 0, block_size, value_type{0});
         }
     } // namespace detail
 } // namespace burst
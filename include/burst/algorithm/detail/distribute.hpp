@@ -0,0 +1,82 @@
+#ifndef BURST__ALGORITHM__DETAIL__DISTRIBUTE_HPP
+#define BURST__ALGORITHM__DETAIL__DISTRIBUTE_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/detail/counting_sort_traits.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Гистограмма образов
+
+            \returns
+                Массив размера `M`, где `M` — количество значений образа, в `i`-й ячейке
+                которого лежит количество элементов с образом `i`.
+         */
+        template <typename ForwardIterator, typename Map>
+        auto histogram_impl (ForwardIterator first, ForwardIterator last, Map map)
+        {
+            using value_type = iterator_value_t<ForwardIterator>;
+            using traits = counting_sort_traits<value_type, Map>;
+            using counter_type = iterator_difference_t<ForwardIterator>;
+
+            auto counters = std::vector<counter_type>(traits::value_range, 0);
+            count(first, last, map, counters.data());
+
+            return counters;
+        }
+
+        /*!
+            \brief
+                Распределение по корзинам с возвратом границ корзин
+
+            \details
+                То же самое, что и сортировка подсчётом, но по окончании распределения счётчики
+                не выбрасываются, а превращаются в массив границ корзин.
+
+                После сбора счётчиков в ячейке `i + 1` лежит начало корзины `i`. Распределение
+                сдвигает каждый счётчик от начала своей корзины к её концу, то есть к началу
+                следующей корзины, поэтому для получения границ остаётся сдвинуть массив на одну
+                ячейку вправо.
+
+            \returns
+                Массив размера `M + 1`, где `M` — количество значений образа. Корзина `i`
+                занимает в выходном диапазоне полуинтервал `[result + b[i], result + b[i + 1])`.
+         */
+        template <typename ForwardIterator, typename RandomAccessIterator, typename Map, typename Scatter>
+        auto
+            distribute_impl
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator result,
+                Map map,
+                Scatter scatter
+            )
+        {
+            using value_type = iterator_value_t<ForwardIterator>;
+            using traits = counting_sort_traits<value_type, Map>;
+            using counter_type = iterator_difference_t<RandomAccessIterator>;
+
+            auto boundaries = std::vector<counter_type>(traits::value_range + 1, 0);
+            collect(first, last, map, boundaries.data() + 1);
+            dispose(first, last, result, map, boundaries.data(), scatter);
+
+            std::copy_backward(boundaries.begin(), std::prev(boundaries.end()), boundaries.end());
+            boundaries.front() = 0;
+
+            return boundaries;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__DISTRIBUTE_HPP
@@ -0,0 +1,343 @@
+#ifndef BURST__ALGORITHM__DETAIL__EXTERNAL_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__EXTERNAL_RADIX_SORT_HPP
+
+#include <burst/iterator/end_tag.hpp>
+#include <burst/range/merge.hpp>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Убедиться, что операция над потоком удалась
+
+            \details
+                Если, например, закончилось место на диске, то поток переходит в состояние
+                ошибки, а сортировка без этой проверки завершилась бы «успешно» с обрезанным
+                результатом.
+
+            \throws std::runtime_error
+                Если поток в состоянии ошибки.
+         */
+        inline void check_stream (const std::ios & stream, const char * message)
+        {
+            if (stream.fail())
+            {
+                throw std::runtime_error(message);
+            }
+        }
+
+        /*!
+            \brief
+                Убедиться, что чтение из потока удалось
+
+            \details
+                Конец потока отличается от ошибки чтения: при ошибке поток переходит в
+                состояние `bad()`, а если чтение оборвалось не в конце потока — в состояние
+                `fail()` без `eof()`. Без этой проверки обрыв чтения был бы принят за конец
+                данных.
+
+            \throws std::runtime_error
+                Если чтение не удалось.
+         */
+        inline void check_read (const std::istream & stream, const char * message)
+        {
+            if (stream.bad() || (stream.fail() && not stream.eof()))
+            {
+                throw std::runtime_error(message);
+            }
+        }
+
+        /*!
+            \brief
+                Прочитать из потока не более `n` объектов в бинарном виде
+
+            \returns
+                Количество прочитанных объектов. Неполный объект в конце потока отбрасывается.
+
+            \throws std::runtime_error
+                Если чтение из потока не удалось.
+         */
+        template <typename Value>
+        std::size_t read_block (std::istream & stream, Value * block, std::size_t n)
+        {
+            stream.read(reinterpret_cast<char *>(block), static_cast<std::streamsize>(n * sizeof(Value)));
+            check_read(stream, "Не удалось прочитать блок из потока.");
+            return static_cast<std::size_t>(stream.gcount()) / sizeof(Value);
+        }
+
+        template <typename Value>
+        void write_block (std::ostream & stream, const Value * block, std::size_t n)
+        {
+            stream.write(reinterpret_cast<const char *>(block), static_cast<std::streamsize>(n * sizeof(Value)));
+            check_stream(stream, "Не удалось записать блок в поток.");
+        }
+
+        //!     Записать остаток данных на устройство и убедиться, что запись удалась.
+        inline void flush_stream (std::ostream & stream)
+        {
+            stream.flush();
+            check_stream(stream, "Не удалось сбросить поток.");
+        }
+
+        /*!
+            \brief
+                Буферизованное чтение отсортированной серии
+
+            \details
+                Читает серию из потока блоками заданного размера. Каждый раз, когда текущий блок
+                исчерпан, из потока читается следующий.
+         */
+        template <typename Value>
+        class binary_run_reader
+        {
+        public:
+            binary_run_reader (std::istream & stream, std::size_t buffer_size):
+                m_stream(std::addressof(stream)),
+                m_buffer(new Value[buffer_size]),
+                m_capacity(buffer_size),
+                m_position(0),
+                m_size(0)
+            {
+                refill();
+            }
+
+            bool empty () const
+            {
+                return m_position == m_size;
+            }
+
+            const Value & front () const
+            {
+                return m_buffer[m_position];
+            }
+
+            void pop_front ()
+            {
+                if (++m_position == m_size)
+                {
+                    refill();
+                }
+            }
+
+        private:
+            void refill ()
+            {
+                m_size = read_block(*m_stream, m_buffer.get(), m_capacity);
+                m_position = 0;
+            }
+
+            std::istream * m_stream;
+            std::unique_ptr<Value[]> m_buffer;
+            std::size_t m_capacity;
+            std::size_t m_position;
+            std::size_t m_size;
+        };
+
+        /*!
+            \brief
+                Однопроходный итератор по серии
+
+            \details
+                Все копии итератора разделяют один и тот же читатель, поэтому итератор, как и
+                итератор бинарного ввода, однопроходный.
+
+            \see binary_istream_iterator
+         */
+        template <typename Value>
+        class binary_run_iterator:
+            public
+                boost::iterator_facade
+                <
+                    binary_run_iterator<Value>,
+                    Value,
+                    boost::single_pass_traversal_tag,
+                    const Value &
+                >
+        {
+        public:
+            explicit binary_run_iterator (binary_run_reader<Value> & reader):
+                m_reader(std::addressof(reader))
+            {
+            }
+
+            binary_run_iterator ():
+                m_reader(nullptr)
+            {
+            }
+
+        private:
+            friend class boost::iterator_core_access;
+
+            bool exhausted () const
+            {
+                return m_reader == nullptr || m_reader->empty();
+            }
+
+            void increment ()
+            {
+                m_reader->pop_front();
+            }
+
+            bool equal (const binary_run_iterator & that) const
+            {
+                return this->exhausted() == that.exhausted();
+            }
+
+            const Value & dereference () const
+            {
+                return m_reader->front();
+            }
+
+            binary_run_reader<Value> * m_reader;
+        };
+
+        /*!
+            \brief
+                Внешняя сортировка
+
+            \details
+                1.  Входной поток читается блоками такого размера, чтобы блок вместе с буфером
+                    для его сортировки укладывался в бюджет памяти.
+                2.  Каждый блок сортируется функцией `sort_block` и записывается в отдельную
+                    серию, полученную от `make_run`. Если весь поток уместился в один блок, то
+                    он сразу записывается в выходной поток.
+                3.  Серии сливаются итератором слияния. Бюджет памяти поровну делится между
+                    буферами чтения серий и буфером записи результата.
+
+                После каждой записи и сброса серии и выходного потока проверяется их состояние.
+
+            \param memory_budget
+                Количество байтов, которое разрешено использовать под данные.
+            \param make_run
+                Функция без аргументов, возвращающая указатель на новый поток ввода-вывода
+                (`std::iostream`) для хранения одной серии.
+            \param sort_block
+                Функция `sort_block(first, last, buffer)`, упорядочивающая блок `[first, last)`
+                по образам `map`, используя буфер того же размера.
+
+            \throws std::runtime_error
+                Если не удалось прочитать входной поток или серию либо записать серию или
+                результат.
+         */
+        template <typename Value, typename MakeRun, typename Map, typename SortBlock>
+        void
+            external_radix_sort_impl
+            (
+                std::istream & input,
+                std::ostream & output,
+                std::size_t memory_budget,
+                MakeRun make_run,
+                Map map,
+                SortBlock sort_block
+            )
+        {
+            static_assert(std::is_trivial<Value>::value, "");
+
+            const auto block_size = memory_budget / (2 * sizeof(Value));
+            if (block_size == 0)
+            {
+                throw std::invalid_argument("Бюджет памяти меньше размера двух сортируемых объектов.");
+            }
+
+            using run_type = decltype(make_run());
+            std::vector<run_type> runs;
+            {
+                auto block = std::unique_ptr<Value[]>(new Value[block_size]);
+                auto buffer = std::unique_ptr<Value[]>(new Value[block_size]);
+                while (true)
+                {
+                    const auto size = read_block(input, block.get(), block_size);
+                    if (size == 0)
+                    {
+                        break;
+                    }
+                    sort_block(block.get(), block.get() + size, buffer.get());
+
+                    using traits_type = std::istream::traits_type;
+                    const auto is_last = size < block_size || traits_type::eq_int_type(input.peek(), traits_type::eof());
+                    check_read(input, "Не удалось прочитать блок из потока.");
+                    if (runs.empty() && is_last)
+                    {
+                        write_block(output, block.get(), size);
+                        flush_stream(output);
+                        return;
+                    }
+
+                    runs.push_back(make_run());
+                    write_block(*runs.back(), block.get(), size);
+                    flush_stream(*runs.back());
+                    if (is_last)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (runs.empty())
+            {
+                return;
+            }
+
+            const auto buffer_size = std::max(memory_budget / ((runs.size() + 1) * sizeof(Value)), std::size_t{1});
+
+            std::vector<binary_run_reader<Value>> readers;
+            readers.reserve(runs.size());
+            for (auto & run: runs)
+            {
+                run->seekg(0);
+                check_stream(*run, "Не удалось вернуться к началу серии.");
+                readers.emplace_back(*run, buffer_size);
+            }
+
+            using run_range = boost::iterator_range<binary_run_iterator<Value>>;
+            std::vector<run_range> ranges;
+            ranges.reserve(readers.size());
+            for (auto & reader: readers)
+            {
+                ranges.emplace_back(binary_run_iterator<Value>(reader), binary_run_iterator<Value>{});
+            }
+
+            const auto merged =
+                burst::merge(ranges,
+                    [& map] (const auto & left, const auto & right)
+                    {
+                        return map(left) < map(right);
+                    });
+
+            // Итератор слияния хранит отображение пользователя, которое может оказаться
+            // неприсваиваемым, поэтому результат буферизуется вручную, а не через
+            // `buffered_chunks`.
+            auto output_buffer = std::unique_ptr<Value[]>(new Value[buffer_size]);
+            auto output_size = std::size_t{0};
+            for (const auto & value: merged)
+            {
+                output_buffer[output_size++] = value;
+                if (output_size == buffer_size)
+                {
+                    write_block(output, output_buffer.get(), output_size);
+                    output_size = 0;
+                }
+            }
+            write_block(output, output_buffer.get(), output_size);
+            flush_stream(output);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__EXTERNAL_RADIX_SORT_HPP
@@ -0,0 +1,97 @@
+#ifndef BURST__ALGORITHM__DETAIL__FRONT_HEAP_INTO_HPP
+#define BURST__ALGORITHM__DETAIL__FRONT_HEAP_INTO_HPP
+
+#include <burst/algorithm/detail/copy_run.hpp>
+#include <burst/algorithm/detail/run_bound.hpp>
+#include <burst/container/access/front.hpp>
+#include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Энергичный проход по пирамиде диапазонов
+
+            \details
+                Общая часть энергичных объединения и симметрической разности. Диапазоны лежат
+                в пирамиде по первым элементам.
+
+                Если наименьший первый элемент строго меньше первых элементов всех остальных
+                диапазонов, то ни в одном другом диапазоне нет ни его, ни следующих за ним
+                элементов, меньших второго по величине первого элемента. Такая серия целиком
+                входит и в объединение, и в симметрическую разность, поэтому её конец ищется
+                скачущим поиском, и она копируется в `result` за один раз. Когда остаётся только
+                один непустой диапазон, он копируется до конца.
+
+                Иначе из пирамиды извлекается группа диапазонов с наименьшим первым элементом, и
+                этот элемент записывается в `result`, если `take_group(n)` для размера группы `n`
+                истинно.
+         */
+        template <typename Range, typename Compare, typename OutputIterator, typename GroupPredicate>
+        OutputIterator
+            front_heap_into
+            (
+                std::vector<Range> ranges,
+                Compare compare,
+                OutputIterator result,
+                GroupPredicate take_group
+            )
+        {
+            ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [] (const auto & r) {return r.empty();}),
+                ranges.end());
+
+            const auto heap_order = each(front) | invert(compare);
+            const auto first = ranges.begin();
+            auto last = ranges.end();
+            make_front_heap(first, last, compare);
+            while (std::distance(first, last) > 1)
+            {
+                const auto second =
+                    std::distance(first, last) > 2 && compare(first[2].front(), first[1].front())
+                        ? std::next(first, 2)
+                        : std::next(first, 1);
+                if (compare(first->front(), second->front()))
+                {
+                    const auto run_end = run_lower_bound(first->begin(), first->end(), second->front(), compare);
+                    result = copy_run(first->begin(), run_end, result);
+                    first->advance_begin(std::distance(first->begin(), run_end));
+
+                    std::pop_heap(first, last, heap_order);
+                    if (not std::prev(last)->empty())
+                    {
+                        std::push_heap(first, last, heap_order);
+                    }
+                    else
+                    {
+                        --last;
+                    }
+                }
+                else
+                {
+                    const auto group_begin = pop_front_group(first, last, compare);
+                    if (take_group(std::distance(group_begin, last)))
+                    {
+                        *result++ = group_begin->front();
+                    }
+                    last = push_advanced(first, group_begin, last, compare);
+                }
+            }
+
+            if (first != last)
+            {
+                result = copy_run(first->begin(), first->end(), result);
+            }
+            return result;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__FRONT_HEAP_INTO_HPP
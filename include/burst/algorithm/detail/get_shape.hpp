@@ -4,6 +4,7 @@
 #include <burst/execution/parallel_policy.hpp>
 #include <burst/integer/divceil.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <array>
 
@@ -38,6 +39,49 @@ namespace burst
                 return std::array<std::size_t, 2>{0, 0};
             }
         }
+
+        //!     Наибольшее количество кусков на один поток при дроблении формы.
+        constexpr auto max_chunks_per_thread = std::size_t{4};
+
+        //!     Ограничение на количество счётчиков всех кусков, при котором форма ещё дробится.
+        constexpr auto chunk_counters_limit = std::size_t{1} << 14;
+
+        /*!
+            \brief
+                Раздробить форму на большее количество кусков, чем потоков
+
+            \details
+                Если каждому потоку достаётся ровно один кусок, то медленный поток задерживает
+                весь проход. Мелкие куски раздаются свободным потокам по мере освобождения, и
+                нагрузка выравнивается.
+                Но каждому куску нужен свой массив из `counters_per_chunk` счётчиков, и их
+                частичные суммы тоже нужно считать, поэтому количество кусков на поток
+                уменьшается по мере роста `counters_per_chunk`, вплоть до одного.
+
+            \returns
+                Массив из двух значений, где `array[0]` — количество кусков, `array[1]` — размер
+                куска.
+         */
+        inline auto
+            refine_shape
+            (
+                const std::array<std::size_t, 2> & shape,
+                std::size_t range_size,
+                std::size_t counters_per_chunk
+            )
+        {
+            const auto chunks_per_thread =
+                std::max(std::size_t{1}, std::min(max_chunks_per_thread, chunk_counters_limit / counters_per_chunk));
+            if (chunks_per_thread == 1 || range_size == 0)
+            {
+                return shape;
+            }
+
+            const auto chunk_size = divceil(range_size, shape[0] * chunks_per_thread);
+            const auto chunk_count = divceil(range_size, chunk_size);
+
+            return std::array<std::size_t, 2>{chunk_count, chunk_size};
+        }
     } // namespace detail
 } // namespace burst
 
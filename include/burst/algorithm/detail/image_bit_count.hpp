@@ -0,0 +1,64 @@
+#ifndef BURST__ALGORITHM__DETAIL__IMAGE_BIT_COUNT_HPP
+#define BURST__ALGORITHM__DETAIL__IMAGE_BIT_COUNT_HPP
+
+#include <burst/functional/compose.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/is_integer.hpp>
+#include <burst/type_traits/void_t.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Количество значащих битов в образе отображения
+
+            \details
+                Если отображение `F` объявляет поле `bit_count`, то берётся его значение (см.
+                `low_bits`). Иначе количество битов определяется типом образа.
+                Композиция отображений наследует количество битов внешнего отображения. Исключение —
+                `shift_to_unsigned` поверх беззнакового образа: он ничего не меняет, поэтому
+                количество битов берётся у внутреннего отображения.
+         */
+        template <typename F, typename Argument, typename = void>
+        struct image_bit_count:
+            std::integral_constant
+            <
+                std::size_t,
+                static_cast<std::size_t>(std::numeric_limits<std::decay_t<invoke_result_t<F, Argument>>>::digits)
+            >
+        {
+        };
+
+        template <typename F, typename Argument>
+        struct image_bit_count<F, Argument, void_t<decltype(std::decay_t<F>::bit_count)>>:
+            std::integral_constant<std::size_t, std::decay_t<F>::bit_count>
+        {
+        };
+
+        template <typename L, typename R, typename Argument>
+        struct image_bit_count<compose_fn<L, R>, Argument, void>:
+            image_bit_count<L, invoke_result_t<R, Argument>>
+        {
+        };
+
+        template <typename R, typename Argument>
+        struct image_bit_count<compose_fn<shift_to_unsigned_fn, R>, Argument, void>:
+            std::conditional_t
+            <
+                is_unsigned_integer<std::decay_t<invoke_result_t<R, Argument>>>::value,
+                image_bit_count<R, Argument>,
+                image_bit_count<shift_to_unsigned_fn, invoke_result_t<R, Argument>>
+            >
+        {
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__IMAGE_BIT_COUNT_HPP
@@ -0,0 +1,55 @@
+#ifndef BURST__ALGORITHM__DETAIL__INNER_RANGE_VECTOR_HPP
+#define BURST__ALGORITHM__DETAIL__INNER_RANGE_VECTOR_HPP
+
+#include <burst/iterator/detail/uniform_range_tuple_please.hpp>
+#include <burst/range/make_range_vector.hpp>
+#include <burst/tuple/apply.hpp>
+#include <burst/type_traits/range_iterator.hpp>
+#include <burst/type_traits/range_value.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Собрать вектор диапазонов, указывающих на исходные диапазоны
+
+            \details
+                Энергичные операции над множествами продвигают диапазоны из этого вектора, а сами
+                исходные диапазоны остаются нетронутыми.
+         */
+        template <typename RandomAccessRange>
+        auto make_inner_range_vector (const RandomAccessRange & ranges)
+        {
+            using inner_iterator = range_iterator_t<const range_value_t<RandomAccessRange>>;
+
+            using std::begin;
+            using std::end;
+            auto inner_ranges = std::vector<boost::iterator_range<inner_iterator>>{};
+            inner_ranges.reserve(static_cast<std::size_t>(std::distance(begin(ranges), end(ranges))));
+            for (const auto & range: ranges)
+            {
+                inner_ranges.push_back(boost::make_iterator_range(range));
+            }
+            return inner_ranges;
+        }
+
+        //!     Диапазоны из кортежа могут быть разных типов, но их элементы должны быть одного типа.
+        template <typename ... Ranges>
+        auto make_inner_range_vector (std::tuple<Ranges &...> ranges)
+        {
+            auto common_ranges = uniform_range_tuple_please(ranges);
+            return make_inner_range_vector(burst::apply(burst::make_range_vector, common_ranges));
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__INNER_RANGE_VECTOR_HPP
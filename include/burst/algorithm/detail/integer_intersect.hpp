@@ -0,0 +1,371 @@
+#ifndef BURST__ALGORITHM__DETAIL__INTEGER_INTERSECT_HPP
+#define BURST__ALGORITHM__DETAIL__INTEGER_INTERSECT_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/type_traits/is_contiguous_iterator.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BURST_INTEGER_INTERSECT_SSE2
+#endif
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Целые, для которых есть специальные ядра пересечения: 32- и 64-битные.
+        template <typename Value>
+        struct is_intersect_kernel_value:
+            std::integral_constant
+            <
+                bool,
+                std::is_integral<Value>::value && not std::is_same<Value, bool>::value &&
+                    (sizeof(Value) == 4 || sizeof(Value) == 8)
+            >
+        {
+        };
+
+        //!     Задаёт ли отношение порядка естественный порядок на числах.
+        template <typename Compare, typename Value>
+        struct is_natural_less: std::false_type {};
+
+        template <typename Value>
+        struct is_natural_less<std::less<>, Value>: std::true_type {};
+
+        template <typename Value>
+        struct is_natural_less<std::less<Value>, Value>: std::true_type {};
+
+        /*!
+            \brief
+                Можно ли пересекать диапазоны специальными ядрами
+
+            \details
+                Можно, если элементы диапазонов лежат в памяти подряд, являются 32- или
+                64-битными целыми числами и упорядочены естественным образом.
+         */
+        template <typename Iterator, typename Compare>
+        struct is_intersect_kernel_applicable:
+            std::integral_constant
+            <
+                bool,
+                is_contiguous_iterator<Iterator>::value &&
+                    is_intersect_kernel_value<iterator_value_t<Iterator>>::value &&
+                    is_natural_less<Compare, iterator_value_t<Iterator>>::value
+            >
+        {
+        };
+
+#if defined(BURST_INTEGER_INTERSECT_SSE2)
+        inline __m128i sse2_load (const void * pointer)
+        {
+            return _mm_loadu_si128(static_cast<const __m128i *>(pointer));
+        }
+
+        template <std::size_t ValueSize>
+        struct sse2_block;
+
+        //!     Блок из четырёх 32-битных чисел.
+        template <>
+        struct sse2_block<4>
+        {
+            static constexpr auto size = std::ptrdiff_t{4};
+
+            //!     i-й бит взведён, если `a[i]` есть среди `b[0], ..., b[3]`.
+            static unsigned match_mask (const void * a, const void * b)
+            {
+                const auto va = sse2_load(a);
+                const auto vb = sse2_load(b);
+                auto equal = _mm_cmpeq_epi32(va, vb);
+                equal = _mm_or_si128(equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39)));
+                equal = _mm_or_si128(equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4e)));
+                equal = _mm_or_si128(equal, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93)));
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+            }
+
+            //!     i-й бит взведён, если `a[i] == a[i + 1]`.
+            static unsigned adjacent_mask (const void * a)
+            {
+                const auto value_size = std::ptrdiff_t{4};
+                const auto next = static_cast<const char *>(a) + value_size;
+                const auto equal = _mm_cmpeq_epi32(sse2_load(a), sse2_load(next));
+                return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+            }
+        };
+
+        //!     Блок из двух 64-битных чисел.
+        template <>
+        struct sse2_block<8>
+        {
+            static constexpr auto size = std::ptrdiff_t{2};
+
+            //!     В SSE2 нет сравнения 64-битных чисел, поэтому сравниваются половины.
+            static __m128i equal (__m128i a, __m128i b)
+            {
+                const auto halves = _mm_cmpeq_epi32(a, b);
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, 0xb1));
+            }
+
+            static unsigned match_mask (const void * a, const void * b)
+            {
+                const auto va = sse2_load(a);
+                const auto vb = sse2_load(b);
+                const auto matches = _mm_or_si128(equal(va, vb), equal(va, _mm_shuffle_epi32(vb, 0x4e)));
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(matches)));
+            }
+
+            static unsigned adjacent_mask (const void * a)
+            {
+                const auto value_size = std::ptrdiff_t{8};
+                const auto next = static_cast<const char *>(a) + value_size;
+                const auto matches = equal(sse2_load(a), sse2_load(next));
+                return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(matches)));
+            }
+        };
+
+        //!     Пропустить блоки по четыре 32-битных числа, которые все меньше `goal`.
+        template <typename Value>
+        void scan_lower_bound_blocks (const Value * & first, const Value * last, Value goal, std::integral_constant<std::size_t, 4>)
+        {
+            // Беззнаковые числа сравниваются как знаковые после переворачивания старшего бита.
+            const auto flip = _mm_set1_epi32(std::is_signed<Value>::value ? 0 : std::numeric_limits<std::int32_t>::min());
+            const auto goals = _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(goal)), flip);
+            while (last - first >= 4)
+            {
+                const auto values = _mm_xor_si128(sse2_load(first), flip);
+                const auto less = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(values, goals)));
+                if (less != 0xf)
+                {
+                    return;
+                }
+                first += 4;
+            }
+        }
+
+        template <typename Value>
+        void scan_lower_bound_blocks (const Value * &, const Value *, Value, std::integral_constant<std::size_t, 8>)
+        {
+        }
+#endif
+
+        /*!
+            \brief
+                Поиск нижней грани проходом от начала
+
+            \details
+                Пропускает числа, меньшие `goal`. 32-битные числа при наличии SSE2 проверяются
+                блоками по четыре, а 64-битные — по одному, так как в SSE2 нет их упорядоченного
+                сравнения.
+         */
+        template <typename Value>
+        const Value * scan_lower_bound (const Value * first, const Value * last, Value goal)
+        {
+#if defined(BURST_INTEGER_INTERSECT_SSE2)
+            using value_size = std::integral_constant<std::size_t, sizeof(Value)>;
+            scan_lower_bound_blocks(first, last, goal, value_size{});
+#endif
+            while (first != last && *first < goal)
+            {
+                ++first;
+            }
+            return first;
+        }
+
+        /*!
+            \brief
+                Пересечение слиянием без ветвлений
+
+            \details
+                На каждом шаге первый элемент `a` записывается в результат, но результат
+                продвигается только если он совпал с первым элементом `b`. Поэтому вместо плохо
+                предсказуемого ветвления — только арифметика над результатами сравнений.
+                Повторяющиеся элементы обрабатываются так же, как в `std::set_intersection`.
+
+                Результат должен вмещать `min(|a|, |b|)` элементов.
+         */
+        template <typename Value>
+        Value *
+            branchless_intersect
+            (
+                const Value * a, const Value * a_end,
+                const Value * b, const Value * b_end,
+                Value * result
+            )
+        {
+            while (a != a_end && b != b_end)
+            {
+                const auto x = *a;
+                const auto y = *b;
+                *result = x;
+                result += static_cast<std::ptrdiff_t>(x == y);
+                a += static_cast<std::ptrdiff_t>(not (y < x));
+                b += static_cast<std::ptrdiff_t>(not (x < y));
+            }
+            return result;
+        }
+
+        /*!
+            \brief
+                Блочное пересечение
+
+            \details
+                Диапазоны пересекаются блоками по 128 бит, как у Шлегеля и Лемира: каждый элемент
+                блока из `a` одной векторной операцией сравнивается со всеми элементами блока из
+                `b` и его циклических сдвигов, после чего продвигается тот блок (или оба), чей
+                последний элемент не больше. Хвосты, а также весь остаток, если в каком-то блоке
+                нашлись повторяющиеся элементы, пересекаются слиянием без ветвлений.
+
+                Без SSE2 всё пересечение делается слиянием без ветвлений.
+         */
+        template <typename Value>
+        Value *
+            block_intersect
+            (
+                const Value * a, const Value * a_end,
+                const Value * b, const Value * b_end,
+                Value * result
+            )
+        {
+#if defined(BURST_INTEGER_INTERSECT_SSE2)
+            using block = sse2_block<sizeof(Value)>;
+            while (a_end - a > block::size && b_end - b > block::size)
+            {
+                if ((block::adjacent_mask(a) | block::adjacent_mask(b)) != 0)
+                {
+                    break;
+                }
+
+                const auto matches = block::match_mask(a, b);
+                const auto a_max = a[block::size - 1];
+                const auto b_max = b[block::size - 1];
+                for (auto index = std::ptrdiff_t{0}; index < block::size; ++index)
+                {
+                    if ((matches >> index) & 1u)
+                    {
+                        *result++ = a[index];
+                    }
+                }
+                a += static_cast<std::ptrdiff_t>(not (b_max < a_max)) * block::size;
+                b += static_cast<std::ptrdiff_t>(not (a_max < b_max)) * block::size;
+            }
+#endif
+            return branchless_intersect(a, a_end, b, b_end, result);
+        }
+
+        /*!
+            \brief
+                Пересечение скачущим поиском
+
+            \details
+                Для каждого элемента короткого диапазона `a` в длинном диапазоне `b` скачущим
+                поиском от последней найденной позиции ищется его нижняя грань. Количество
+                сравнений — `O(m log(n / m))`, где `m = |a|`, `n = |b|`.
+         */
+        template <typename Value>
+        Value *
+            galloping_intersect
+            (
+                const Value * a, const Value * a_end,
+                const Value * b, const Value * b_end,
+                Value * result
+            )
+        {
+            for (; a != a_end && b != b_end; ++a)
+            {
+                b = galloping_search(b, b_end, *a, std::less<>{});
+                if (b != b_end && *b == *a)
+                {
+                    *result++ = *a;
+                    ++b;
+                }
+            }
+            return result;
+        }
+
+        //!     Во сколько раз длинный диапазон должен быть длиннее короткого для скачущего поиска.
+        constexpr auto galloping_intersect_ratio = std::ptrdiff_t{32};
+
+        //!     Пересечение двух диапазонов, из которых `a` не длиннее `b`.
+        template <typename Value>
+        Value *
+            intersect_two
+            (
+                const Value * a, const Value * a_end,
+                const Value * b, const Value * b_end,
+                Value * result
+            )
+        {
+            if ((b_end - b) / galloping_intersect_ratio > a_end - a)
+            {
+                return galloping_intersect(a, a_end, b, b_end, result);
+            }
+            else
+            {
+                return block_intersect(a, a_end, b, b_end, result);
+            }
+        }
+
+        /*!
+            \brief
+                Пересечение набора массивов целых чисел
+
+            \details
+                Массивы упорядочиваются по возрастанию длины, два самых коротких пересекаются во
+                временный буфер, а затем промежуточный результат по очереди пересекается со всеми
+                остальными массивами, переходя из одного буфера в другой. Промежуточный результат
+                не длиннее самого короткого массива и никогда не удлиняется, поэтому с ростом
+                длин массивов всё чаще выгоден скачущий поиск.
+         */
+        template <typename Value, typename OutputIterator>
+        OutputIterator
+            intersect_arrays
+            (
+                std::vector<boost::iterator_range<const Value *>> arrays,
+                OutputIterator result
+            )
+        {
+            if (arrays.empty())
+            {
+                return result;
+            }
+
+            std::sort(arrays.begin(), arrays.end(),
+                [] (const auto & left, const auto & right) {return left.size() < right.size();});
+
+            const auto & shortest = arrays.front();
+            if (arrays.size() == 1 || shortest.empty())
+            {
+                return std::copy(shortest.begin(), shortest.end(), result);
+            }
+
+            const auto buffer_size = static_cast<std::size_t>(shortest.size());
+            auto buffer = std::vector<Value>(arrays.size() > 2 ? 2 * buffer_size : buffer_size);
+            auto buffer_begin = buffer.data();
+            auto buffer_end =
+                intersect_two(shortest.begin(), shortest.end(), arrays[1].begin(), arrays[1].end(), buffer_begin);
+
+            auto spare = buffer_begin + buffer_size;
+            for (auto array = arrays.begin() + 2; array != arrays.end() && buffer_end != buffer_begin; ++array)
+            {
+                const auto spare_end =
+                    intersect_two<Value>(buffer_begin, buffer_end, array->begin(), array->end(), spare);
+                std::tie(buffer_begin, buffer_end, spare) = std::make_tuple(spare, spare_end, buffer_begin);
+            }
+
+            return std::copy(buffer_begin, buffer_end, result);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__INTEGER_INTERSECT_HPP
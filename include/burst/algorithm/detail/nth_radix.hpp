@@ -2,7 +2,9 @@
 #define BURST__ALGORITHM__DETAIL__NTH_RADIX_HPP
 
 #include <burst/algorithm/detail/counting_sort_traits.hpp>
+#include <burst/algorithm/detail/image_bit_count.hpp>
 #include <burst/integer/right_shift.hpp>
+#include <burst/type_traits/is_integer.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -12,19 +14,34 @@ namespace burst
 {
     namespace detail
     {
+        //!     Выделение разряда с номером `radix_number` из беззнакового целого числа.
+        template <typename Radix>
+        struct nth_radix_fn
+        {
+            template <typename Integer>
+            auto operator () (Integer n) const
+            {
+                static_assert(is_unsigned_integer<Integer>::value, "");
+                using traits = counting_sort_traits<Integer, Radix>;
+
+                return radix(right_shift(n, traits::radix_size * radix_number));
+            }
+
+            std::size_t radix_number;
+            Radix radix;
+        };
+
+        //!     Разряд с любым номером имеет ту же ширину, что и младший.
+        template <typename Radix, typename Argument>
+        struct image_bit_count<nth_radix_fn<Radix>, Argument, void>:
+            image_bit_count<Radix, Argument>
+        {
+        };
+
         template <typename Radix>
         auto nth_radix (std::size_t radix_number, Radix radix)
         {
-            return
-                [radix_number, radix = std::move(radix)] (auto n)
-                {
-                    using value_type = decltype(n);
-                    static_assert(std::is_integral<value_type>::value, "");
-                    static_assert(std::is_unsigned<value_type>::value, "");
-                    using traits = counting_sort_traits<value_type, Radix>;
-
-                    return radix(right_shift(n, traits::radix_size * radix_number));
-                };
+            return nth_radix_fn<Radix>{radix_number, std::move(radix)};
         }
     } // namespace detail
 } // namespace burst
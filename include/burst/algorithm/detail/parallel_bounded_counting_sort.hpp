@@ -0,0 +1,119 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_BOUNDED_COUNTING_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_BOUNDED_COUNTING_SORT_HPP
+
+#include <burst/algorithm/detail/bounded_counting_sort.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/algorithm/detail/parallel_cross_partial_sum.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/integer/divceil.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельный поиск наименьшего и наибольшего образов непустого диапазона
+
+            \details
+                Каждый кусок находит границы своих образов, а затем границы кусков объединяются.
+         */
+        template <typename RandomAccessIterator, typename Map>
+        auto
+            minmax_image
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator> chunk_size,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Map & map
+            )
+        {
+            using bounds_type = decltype(minmax_image(first, last, map));
+
+            using std::distance;
+            const auto chunk_count =
+                divceil(static_cast<std::size_t>(distance(first, last)), static_cast<std::size_t>(chunk_size));
+            auto chunk_bounds = std::vector<bounds_type>(chunk_count);
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [& chunk_bounds, & map] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                {
+                    chunk_bounds[static_cast<std::size_t>(chunk_index)] = minmax_image(chunk_begin, chunk_end, map);
+                });
+
+            auto bounds = chunk_bounds.front();
+            std::for_each(std::next(chunk_bounds.begin()), chunk_bounds.end(),
+                [& bounds] (const auto & chunk)
+                {
+                    bounds.first = std::min(bounds.first, chunk.first);
+                    bounds.second = std::max(bounds.second, chunk.second);
+                });
+            return bounds;
+        }
+
+        /*!
+            \brief
+                Параллельная сортировка подсчётом с количеством счётчиков, известным только во
+                время исполнения
+
+            \details
+                Устроена так же, как параллельная сортировка подсчётом: у каждого куска своя строка
+                из `value_range` счётчиков, строки синхронизируются между кусками, после чего
+                каждый кусок распределяет свои элементы в буфер. Затем отсортированный буфер
+                параллельно переносится в исходный диапазон.
+
+            \see counting_sort_in_range
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key>
+        void
+            counting_sort_in_range
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                std::size_t value_range
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            using std::distance;
+            const auto range_size = distance(first, last);
+            const auto chunks = refine_shape(shape, static_cast<std::size_t>(range_size), value_range);
+            const auto chunk_size = static_cast<difference_type>(chunks[1]);
+
+            auto counters = std::make_unique<difference_type[]>(chunks[0] * value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(chunks[0], value_range));
+
+            const auto chunk_count =
+                parallel_by_chunks(pool, chunk_size, first, last,
+                    [& counters_view, & key] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                    {
+                        count(chunk_begin, chunk_end, key, counters_view[chunk_index]);
+                    });
+            parallel_cross_partial_sum(pool, counters_view, static_cast<std::size_t>(chunk_count), value_range);
+
+            dispose_backward(pool, chunk_size,
+                std::make_move_iterator(first), std::make_move_iterator(last), buffer, key, counters_view);
+            parallel_move(pool, chunk_size, buffer, std::next(buffer, range_size), first);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_BOUNDED_COUNTING_SORT_HPP
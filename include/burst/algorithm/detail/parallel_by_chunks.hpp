@@ -1,6 +1,7 @@
 #ifndef BURST__ALGORITHM__DETAIL__PARALLEL_BY_CHUNKS_HPP
 #define BURST__ALGORITHM__DETAIL__PARALLEL_BY_CHUNKS_HPP
 
+#include <burst/algorithm/detail/countdown_latch.hpp>
 #include <burst/type_traits/invoke_result.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
 
@@ -9,10 +10,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <exception>
 #include <future>
 #include <iterator>
 #include <utility>
-#include <vector>
 
 namespace burst
 {
@@ -30,7 +31,28 @@ namespace burst
             return future;
         }
 
-        // TODO: https://github.com/izvolov/burst/issues/150
+        /*!
+            \brief
+                Параллельная обработка диапазона по кускам
+
+            \details
+                Разбивает диапазон `[first, last)` на куски размера `chunk_size` (последний может
+                оказаться короче) и для каждого куска ставит в пул задачу
+                `process_chunk(chunk_index, chunk_begin, chunk_end)`.
+
+                Пул раздаёт задачи из общей очереди, поэтому если кусков больше, чем потоков, то
+                освободившийся поток сразу забирает следующий необработанный кусок, и медленный
+                поток не задерживает остальных.
+                Задачи не заводят собственных `std::future`: завершения всех кусков дожидаются на
+                одном общем счётчике. Если обработка какого-либо куска завершилась исключением, то
+                оно выбрасывается из этой функции после завершения всех задач.
+
+                Индекс куска не зависит от того, какой поток его обработал, поэтому данные,
+                относящиеся к куску (например, счётчики), следует адресовать именно по нему.
+
+            \returns
+                Количество кусков.
+         */
         template <typename RandomAccessIterator, typename TernaryFunction>
         iterator_difference_t<RandomAccessIterator>
             parallel_by_chunks
@@ -42,27 +64,33 @@ namespace burst
                 TernaryFunction process_chunk
             )
         {
-            std::vector<std::future<void>> results;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
 
-            auto chunk_count = iterator_difference_t<RandomAccessIterator>{0};
-            while (first != last)
-            {
-                using std::distance;
-                auto chunk_begin = first;
-                auto chunk_end =
-                    std::next(chunk_begin, std::min(distance(chunk_begin, last), chunk_size));
+            using std::distance;
+            const auto range_size = distance(first, last);
+            const auto chunk_count = range_size == 0 ? difference_type{0} : (range_size - 1) / chunk_size + 1;
 
-                results.push_back(detail::post(pool,
-                    [process_chunk, chunk_count, chunk_begin, chunk_end]
+            countdown_latch latch(static_cast<std::size_t>(chunk_count));
+            for (auto chunk_index = difference_type{0}; chunk_index < chunk_count; ++chunk_index)
+            {
+                boost::asio::post(pool,
+                    [& process_chunk, & latch, first, range_size, chunk_size, chunk_index]
                     {
-                        process_chunk(chunk_count, chunk_begin, chunk_end);
-                    }));
-
-                first = chunk_end;
-                ++chunk_count;
+                        const auto chunk_offset = chunk_index * chunk_size;
+                        const auto chunk_begin = std::next(first, chunk_offset);
+                        const auto chunk_end = std::next(chunk_begin, std::min(range_size - chunk_offset, chunk_size));
+                        try
+                        {
+                            process_chunk(chunk_index, chunk_begin, chunk_end);
+                            latch.count_down();
+                        }
+                        catch (...)
+                        {
+                            latch.fail(std::current_exception());
+                        }
+                    });
             }
-
-            std::for_each(results.begin(), results.end(), [] (auto & r) {r.get();});
+            latch.wait();
 
             return chunk_count;
         }
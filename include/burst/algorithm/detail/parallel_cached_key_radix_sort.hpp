@@ -0,0 +1,176 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_CACHED_KEY_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_CACHED_KEY_RADIX_SORT_HPP
+
+#include <burst/algorithm/detail/cached_key_radix_sort.hpp>
+#include <burst/algorithm/detail/image_bit_count.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort.hpp>
+#include <burst/algorithm/radix_sort/cache_keys.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная поразрядная сортировка по заранее вычисленным ключам
+
+            \details
+                Ключи вычисляются, а элементы в конце переставляются параллельно по кускам.
+                Как и в последовательном варианте, элементы, уже стоящие на своих местах в
+                начале диапазона, не переносятся.
+                Пары из ключа и номера сортируются параллельной поразрядной сортировкой.
+
+            \see cached_key_radix_sort_impl
+         */
+        template <typename Index, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key, typename Radix>
+        void
+            cached_key_radix_sort_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using cached_type = keyed_index_for_t<Index, RandomAccessIterator1, Key>;
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            using std::distance;
+            const auto range_size = distance(first, last);
+            const auto chunk_size = static_cast<difference_type>(shape[1]);
+            auto cached = make_uninitialized_array<cached_type>(2 * static_cast<std::size_t>(range_size));
+            const auto cached_first = cached.get();
+            const auto cached_last = cached_first + range_size;
+
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [first, cached_first, & key] (auto, auto chunk_begin, auto chunk_end)
+                {
+                    auto index = static_cast<Index>(chunk_begin - first);
+                    std::transform(chunk_begin, chunk_end, cached_first + (chunk_begin - first),
+                        [& key, & index] (const auto & value)
+                        {
+                            return cached_type{key(value), index++};
+                        });
+                });
+
+            constexpr auto bit_count = image_bit_count<Key, value_type>::value;
+            radix_sort_impl(pool, shape, cached_first, cached_last, cached_last, cached_key_fn<bit_count>{}, radix);
+
+            const auto displaced = first_displaced(cached_first, cached_last);
+            const auto placed_count = displaced - cached_first;
+            parallel_by_chunks(pool, chunk_size, displaced, cached_last,
+                [first, displaced, buffer] (auto, auto chunk_begin, auto chunk_end)
+                {
+                    gather_by_cached_keys(first, chunk_begin, chunk_end, std::next(buffer, chunk_begin - displaced));
+                });
+            parallel_move(pool, chunk_size, buffer, std::next(buffer, range_size - placed_count), std::next(first, placed_count));
+        }
+
+        //!     Выбор типа номеров по правилу `is_narrow_key_index_enough`.
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key, typename Radix>
+        void
+            cached_key_radix_sort_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix
+            )
+        {
+            using std::distance;
+            if (is_narrow_key_index_enough(static_cast<std::size_t>(distance(first, last))))
+            {
+                cached_key_radix_sort_impl<std::uint32_t>(pool, shape, first, last, buffer, std::move(key), radix);
+            }
+            else
+            {
+                cached_key_radix_sort_impl<std::size_t>(pool, shape, first, last, buffer, std::move(key), radix);
+            }
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key, typename Radix, typename Scatter>
+        void
+            radix_sort_by_key
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                Scatter scatter
+            )
+        {
+            radix_sort_impl(pool, shape, first, last, buffer, std::move(key), radix, scatter);
+        }
+
+        //!     Параллельный аналог последовательной функции `radix_sort_by_key_impl`.
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key, typename Radix>
+        void
+            radix_sort_by_key
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                direct_scatter_fn scatter
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+
+            using std::distance;
+            if (is_key_cache_profitable<value_type, Key, Radix>::value && distance(first, last) >= key_cache_threshold)
+            {
+                cached_key_radix_sort_impl(pool, shape, first, last, buffer, std::move(key), radix);
+            }
+            else
+            {
+                radix_sort_impl(pool, shape, first, last, buffer, std::move(key), radix, scatter);
+            }
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Key, typename Radix>
+        void
+            radix_sort_by_key
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                cache_keys_fn
+            )
+        {
+            cached_key_radix_sort_impl(pool, shape, first, last, buffer, std::move(key), radix);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_CACHED_KEY_RADIX_SORT_HPP
@@ -2,8 +2,9 @@
 #define BURST__ALGORITHM__DETAIL__PARALLEL_COUNTING_SORT_HPP
 
 #include <burst/algorithm/detail/counting_sort.hpp>
-#include <burst/algorithm/detail/cross_partial_sum.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
 #include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_cross_partial_sum.hpp>
 #include <burst/container/shaped_array_view.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
 #include <burst/type_traits/iterator_value.hpp>
@@ -40,15 +41,17 @@ namespace burst
                     {
                         count(chunk_begin, chunk_end, map, counters[thread_index]);
                     });
-            cross_partial_sum(counters, static_cast<std::size_t>(chunk_count), radix_value_range);
+            parallel_cross_partial_sum(pool, counters, static_cast<std::size_t>(chunk_count), radix_value_range);
         }
 
+        //!     Каждый кусок распределяется в своём потоке с собственными буферами (если они есть).
         template
         <
             typename RandomAccessIterator1,
             typename RandomAccessIterator2,
             typename Map,
-            typename RandomAccessIterator3
+            typename RandomAccessIterator3,
+            typename Scatter = direct_scatter_fn
         >
         void
             dispose_backward
@@ -59,13 +62,14 @@ namespace burst
                 RandomAccessIterator1 last,
                 RandomAccessIterator2 result,
                 Map map,
-                RandomAccessIterator3 counters
+                RandomAccessIterator3 counters,
+                Scatter scatter = Scatter{}
             )
         {
             parallel_by_chunks(pool, chunk_size, first, last,
-                [result, & counters, & map] (auto thread_index, auto chunk_begin, auto chunk_end)
+                [result, & counters, & map, scatter] (auto thread_index, auto chunk_begin, auto chunk_end)
                 {
-                    dispose_backward(chunk_begin, chunk_end, result, map, counters[thread_index]);
+                    dispose_backward(chunk_begin, chunk_end, result, map, counters[thread_index], nth_scatter(scatter, static_cast<std::size_t>(thread_index)));
                 });
         }
 
@@ -74,7 +78,8 @@ namespace burst
             typename RandomAccessIterator1,
             typename RandomAccessIterator2,
             typename Map,
-            typename RandomAccessIterator3
+            typename RandomAccessIterator3,
+            typename Scatter
         >
         RandomAccessIterator2
             counting_sort_impl
@@ -85,18 +90,25 @@ namespace burst
                 RandomAccessIterator1 last,
                 RandomAccessIterator2 result,
                 Map map,
-                RandomAccessIterator3 counters
+                RandomAccessIterator3 counters,
+                Scatter scatter
             )
         {
             collect(pool, chunk_size, first, last, map, counters);
-            dispose_backward(pool, chunk_size, first, last, result, map, counters);
+            dispose_backward(pool, chunk_size, first, last, result, map, counters, scatter);
 
             using std::distance;
             using std::next;
             return next(result, distance(first, last));
         }
 
-        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+        template
+        <
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Map,
+            typename Scatter = direct_scatter_fn
+        >
         RandomAccessIterator2
             counting_sort_impl
             (
@@ -105,22 +117,25 @@ namespace burst
                 RandomAccessIterator1 first,
                 RandomAccessIterator1 last,
                 RandomAccessIterator2 result,
-                Map map
+                Map map,
+                Scatter scatter = Scatter{}
             )
         {
             using value_type = iterator_value_t<RandomAccessIterator1>;
             using traits = counting_sort_traits<value_type, Map>;
             using difference_type = iterator_difference_t<RandomAccessIterator2>;
 
-            const auto count = shape[0];
+            using std::distance;
+            const auto chunks = refine_shape(shape, static_cast<std::size_t>(distance(first, last)), traits::value_range);
+            const auto count = chunks[0];
             const auto chunk_size =
-                static_cast<iterator_difference_t<RandomAccessIterator2>>(shape[1]);
+                static_cast<iterator_difference_t<RandomAccessIterator2>>(chunks[1]);
 
             auto counters = std::make_unique<difference_type[]>(count * traits::value_range);
             auto counters_view =
                 make_shaped_array_view(counters.get(), make_shape(count, traits::value_range));
 
-            return counting_sort_impl(pool, chunk_size, first, last, result, map, counters_view);
+            return counting_sort_impl(pool, chunk_size, first, last, result, map, counters_view, scatter);
         }
     } // namespace detail
 } // namespace burst
@@ -0,0 +1,116 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_CROSS_PARTIAL_SUM_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_CROSS_PARTIAL_SUM_HPP
+
+#include <burst/algorithm/detail/cross_partial_sum.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/integer/divceil.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Количество счётчиков, начиная с которого частичные суммы считаются параллельно.
+        constexpr auto parallel_cross_partial_sum_threshold = std::size_t{1} << 15;
+
+        /*!
+            \brief
+                Параллельный обход столбцов таблицы полосами
+
+            \details
+                Разбивает столбцы `[0, column_count)` на `part_count` полос одинаковой ширины
+                (последняя может оказаться уже) и вызывает для каждой полосы
+                `process(part_index, first_column, last_column)` в отдельной задаче пула.
+
+            \returns
+                Количество полос.
+         */
+        template <typename TernaryFunction>
+        std::size_t
+            parallel_by_columns
+            (
+                boost::asio::thread_pool & pool,
+                std::size_t part_count,
+                std::size_t column_count,
+                TernaryFunction process
+            )
+        {
+            const auto part_width = static_cast<std::ptrdiff_t>(divceil(column_count, part_count));
+            const auto columns = boost::counting_iterator<std::size_t>(0);
+            const auto real_part_count =
+                parallel_by_chunks(pool, part_width, columns, columns + static_cast<std::ptrdiff_t>(column_count),
+                    [& process] (auto part_index, auto first, auto last)
+                    {
+                        process(static_cast<std::size_t>(part_index), *first, *last);
+                    });
+            return static_cast<std::size_t>(real_part_count);
+        }
+
+        /*!
+            \brief
+                Параллельные сквозные частичные суммы
+
+            \details
+                Параллельный аналог функции `cross_partial_sum`. Столбцы таблицы счётчиков
+                делятся на `block_count` полос, и подсчёт идёт в три шага:
+                1.  Каждая полоса параллельно с другими суммирует свои счётчики.
+                2.  Суммы полос последовательно превращаются в исключающие частичные суммы — это
+                    начальные значения для каждой полосы.
+                3.  Каждая полоса параллельно с другими вычисляет сквозные частичные суммы своих
+                    столбцов, начиная с полученного значения.
+                Таким образом, последовательная часть работы — это только `block_count`
+                сложений вместо `block_count * block_size`.
+
+                Если счётчиков мало, то накладные расходы на запуск задач не окупаются, и
+                частичные суммы считаются последовательно.
+
+            \see cross_partial_sum
+         */
+        template <typename RandomAccessIterator>
+        void
+            parallel_cross_partial_sum
+            (
+                boost::asio::thread_pool & pool,
+                RandomAccessIterator values,
+                std::size_t block_count,
+                std::size_t block_size
+            )
+        {
+            using value_type = std::decay_t<decltype(values[0][0])>;
+
+            const auto part_count = std::min(block_count, block_size);
+            if (part_count < 2 || block_count * block_size < parallel_cross_partial_sum_threshold)
+            {
+                cross_partial_sum(values, block_count, block_size);
+                return;
+            }
+
+            auto part_sums = std::make_unique<value_type[]>(part_count);
+            const auto real_part_count =
+                parallel_by_columns(pool, part_count, block_size,
+                    [values, block_count, & part_sums] (auto part_index, auto first_column, auto last_column)
+                    {
+                        part_sums[part_index] = cross_sum(values, block_count, first_column, last_column, value_type{0});
+                    });
+
+            std::partial_sum(part_sums.get(), part_sums.get() + real_part_count, part_sums.get());
+
+            parallel_by_columns(pool, part_count, block_size,
+                [values, block_count, & part_sums] (auto part_index, auto first_column, auto last_column)
+                {
+                    const auto initial = part_index == 0 ? value_type{0} : part_sums[part_index - 1];
+                    cross_partial_sum(values, block_count, first_column, last_column, initial);
+                });
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_CROSS_PARTIAL_SUM_HPP
@@ -0,0 +1,122 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_DISTRIBUTE_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_DISTRIBUTE_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/detail/counting_sort_traits.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная гистограмма образов
+
+            \details
+                Каждый кусок подсчитывает образы своих элементов в собственной строке счётчиков,
+                после чего строки складываются.
+
+            \see histogram_impl
+         */
+        template <typename RandomAccessIterator, typename Map>
+        auto
+            histogram_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Map map
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = counting_sort_traits<value_type, Map>;
+            using counter_type = iterator_difference_t<RandomAccessIterator>;
+
+            const auto chunk_count = shape[0];
+            const auto chunk_size = static_cast<counter_type>(shape[1]);
+
+            auto chunk_counters = std::make_unique<counter_type[]>(chunk_count * traits::value_range);
+            const auto counters_view =
+                make_shaped_array_view(chunk_counters.get(), make_shape(chunk_count, traits::value_range));
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [& counters_view, & map] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                {
+                    count(chunk_begin, chunk_end, map, counters_view[chunk_index]);
+                });
+
+            auto counters = std::vector<counter_type>(counters_view[0], counters_view[0] + traits::value_range);
+            for (auto chunk = std::size_t{1}; chunk < chunk_count; ++chunk)
+            {
+                std::transform(counters.begin(), counters.end(), counters_view[chunk], counters.begin(),
+                    [] (auto total, auto chunk_total) {return total + chunk_total;});
+            }
+
+            return counters;
+        }
+
+        /*!
+            \brief
+                Параллельное распределение по корзинам с возвратом границ корзин
+
+            \details
+                Так же, как параллельная сортировка подсчётом, собирает счётчики по кускам и
+                синхронизирует их между кусками, после чего каждый кусок распределяет свои
+                элементы с конца. По окончании распределения счётчики нулевого куска указывают
+                на начала корзин.
+
+            \see distribute_impl
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Scatter>
+        auto
+            distribute_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 result,
+                Map map,
+                Scatter scatter
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using traits = counting_sort_traits<value_type, Map>;
+            using counter_type = iterator_difference_t<RandomAccessIterator2>;
+
+            using std::distance;
+            const auto chunks = refine_shape(shape, static_cast<std::size_t>(distance(first, last)), traits::value_range);
+            const auto chunk_count = chunks[0];
+            const auto chunk_size = static_cast<iterator_difference_t<RandomAccessIterator1>>(chunks[1]);
+
+            auto counters = std::make_unique<counter_type[]>(chunk_count * traits::value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(chunk_count, traits::value_range));
+
+            collect(pool, chunk_size, first, last, map, counters_view);
+            dispose_backward(pool, chunk_size, first, last, result, map, counters_view, scatter);
+
+            auto boundaries = std::vector<counter_type>(traits::value_range + 1);
+            std::copy(counters_view[0], counters_view[0] + traits::value_range, boundaries.begin());
+            boundaries.back() = static_cast<counter_type>(distance(first, last));
+
+            return boundaries;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_DISTRIBUTE_HPP
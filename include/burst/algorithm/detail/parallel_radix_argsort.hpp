@@ -0,0 +1,83 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_ARGSORT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_ARGSORT_HPP
+
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort.hpp>
+#include <burst/algorithm/detail/radix_argsort.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная косвенная поразрядная сортировка
+
+            \details
+                Ключи с индексами заполняются параллельно по кускам, затем сортируются
+                параллельной поразрядной сортировкой, и индексы так же по кускам переписываются в
+                выходной диапазон.
+
+            \see radix_argsort_impl
+         */
+        template
+        <
+            typename Index,
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Map,
+            typename Radix
+        >
+        RandomAccessIterator2
+            radix_argsort_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 result,
+                Map map,
+                Radix radix
+            )
+        {
+            using keyed_index_type = keyed_index_for_t<Index, RandomAccessIterator1, Map>;
+
+            using std::distance;
+            const auto size = static_cast<std::size_t>(distance(first, last));
+            auto keys = make_uninitialized_array<keyed_index_type>(size);
+            auto buffer = make_uninitialized_array<keyed_index_type>(size);
+
+            const auto chunk_size = static_cast<iterator_difference_t<RandomAccessIterator1>>(shape[1]);
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [first, & keys, & map] (auto, auto chunk_begin, auto chunk_end)
+                {
+                    auto index = static_cast<std::size_t>(chunk_begin - first);
+                    std::for_each(chunk_begin, chunk_end,
+                        [& keys, & map, & index] (const auto & value)
+                        {
+                            keys[index] = keyed_index_type{map(value), static_cast<Index>(index)};
+                            ++index;
+                        });
+                });
+
+            radix_sort_impl(pool, shape, keys.get(), keys.get() + size, buffer.get(), key_of, radix);
+
+            parallel_by_chunks(pool, static_cast<std::ptrdiff_t>(shape[1]), keys.get(), keys.get() + size,
+                [& keys, result] (auto, auto chunk_begin, auto chunk_end)
+                {
+                    std::transform(chunk_begin, chunk_end, result + (chunk_begin - keys.get()), index_of);
+                });
+
+            return result + static_cast<iterator_difference_t<RandomAccessIterator2>>(size);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_ARGSORT_HPP
@@ -0,0 +1,105 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SELECT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SELECT_HPP
+
+#include <burst/algorithm/detail/nth_radix.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/algorithm/detail/radix_select.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/integer/divceil.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельный поразрядный поиск n-го элемента
+
+            \details
+                Пока оставшийся диапазон достаточно велик, счётчики очередного разряда собираются
+                параллельно: у каждого потока свой массив счётчиков для своего куска (см.
+                `collect`). Трёхчастное разбиение по найденной корзине выполняется одним потоком,
+                после чего диапазон сужается до этой корзины, и каждый следующий шаг обходит уже
+                только её.
+                Когда диапазон становится меньше, чем по одному массиву счётчиков на поток,
+                оставшиеся разряды обрабатываются последовательным алгоритмом.
+
+            \see radix_select_impl
+         */
+        template <typename RandomAccessIterator, typename Map, typename Radix>
+        void
+            radix_select_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator first,
+                RandomAccessIterator nth,
+                RandomAccessIterator last,
+                Map map,
+                Radix radix
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            if (nth == last)
+            {
+                return;
+            }
+
+            const auto thread_count = shape[0];
+            const auto parallel_range_size = static_cast<difference_type>(thread_count * traits::radix_value_range);
+
+            auto counters = std::make_unique<difference_type[]>(thread_count * traits::radix_value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(thread_count, traits::radix_value_range));
+
+            auto radix_number = traits::radix_count;
+            while (radix_number > 0 && last - first > parallel_range_size)
+            {
+                --radix_number;
+
+                const auto range_size = last - first;
+                const auto chunk_size = static_cast<difference_type>(divceil(static_cast<std::size_t>(range_size), thread_count));
+                const auto chunk_count = static_cast<std::size_t>(divceil(range_size, chunk_size));
+                const auto digit = compose(nth_radix(radix_number, radix), map);
+
+                std::fill(counters.get(), counters.get() + thread_count * traits::radix_value_range, 0);
+                collect(pool, chunk_size, first, last, digit, counters_view);
+
+                // После синхронизации между кусками последняя строка счётчиков содержит концы
+                // корзин во всём диапазоне.
+                const auto ends = counters_view[chunk_count - 1];
+                const auto bucket =
+                    detail::post(pool,
+                        [first, nth, last, & digit, ends]
+                        {
+                            return narrow_to_bucket(first, nth, last, digit, ends, traits::radix_value_range);
+                        }).get();
+                first = bucket.first;
+                last = bucket.second;
+            }
+
+            detail::post(pool,
+                [first, nth, last, & map, & radix, radix_number]
+                {
+                    radix_select_impl(first, nth, last, map, radix, radix_number);
+                }).get();
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SELECT_HPP
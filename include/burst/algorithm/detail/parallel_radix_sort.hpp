@@ -1,13 +1,19 @@
 #ifndef BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_HPP
 #define BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_HPP
 
+#include <burst/algorithm/detail/counting_sort_traits.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
 #include <burst/algorithm/detail/nth_radix.hpp>
 #include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/algorithm/detail/parallel_cross_partial_sum.hpp>
 #include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/algorithm/detail/write_combining.hpp>
 #include <burst/container/shaped_array_view.hpp>
 #include <burst/functional/compose.hpp>
+#include <burst/integer/divceil.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
 #include <burst/type_traits/iterator_value.hpp>
+#include <burst/variadic.hpp>
 
 #include <boost/asio/thread_pool.hpp>
 
@@ -17,12 +23,13 @@
 #include <iterator>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace burst
 {
     namespace detail
     {
-        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Scatter = direct_scatter_fn>
         typename std::enable_if
         <
             radix_sort_traits
@@ -33,49 +40,363 @@ namespace burst
             >
             ::radix_count == 1
         >
-        ::type radix_sort_impl (boost::asio::thread_pool & pool, const std::array<std::size_t, 2> & shape, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, Map map, Radix radix)
+        ::type radix_sort_impl (boost::asio::thread_pool & pool, const std::array<std::size_t, 2> & shape, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, Map map, Radix radix, Scatter scatter = Scatter{})
         {
             auto buffer_end =
                 counting_sort_impl(pool, shape, std::make_move_iterator(first), std::make_move_iterator(last), buffer,
-                    [& map, & radix] (const auto & value)
+                    compose(std::move(radix), std::move(map)), scatter);
+
+            std::move(buffer, buffer_end, first);
+        }
+
+        /*!
+            \brief
+                Синхронизация счётчиков одного разряда между кусками
+
+            \details
+                Вызывает `parallel_cross_partial_sum` для счётчиков разряда, после чего находит
+                наибольшее количество элементов с одинаковым значением этого разряда во всём
+                диапазоне.
+
+            \returns
+                Значение максимального счётчика разряда.
+         */
+        template <typename Counters>
+        auto
+            cross_partial_sum_max
+            (
+                boost::asio::thread_pool & pool,
+                Counters counters,
+                std::size_t chunk_count,
+                std::size_t radix_value_range
+            )
+        {
+            parallel_cross_partial_sum(pool, counters, chunk_count, radix_value_range);
+
+            const auto totals = counters[chunk_count - 1];
+            auto maximum = totals[0];
+            for (auto value = 1ul; value < radix_value_range; ++value)
+            {
+                maximum = std::max(maximum, totals[value] - totals[value - 1]);
+            }
+
+            return maximum;
+        }
+
+        //!     Счётчики всех разрядов, относящиеся к одному куску.
+        /*!
+                Выражение `chunk_counters_view{counters, i}[r]` эквивалентно `counters[r][i]`.
+         */
+        template <typename Counters, typename Integer>
+        struct chunk_counters_view
+        {
+            auto operator [] (std::size_t radix_number) const
+            {
+                return counters[radix_number][chunk_index];
+            }
+
+            Counters counters;
+            Integer chunk_index;
+        };
+
+        /*!
+            \brief
+                Параллельный сбор счётчиков сразу для всех разрядов
+
+            \details
+                Параллельный аналог последовательной функции `collect_impl`.
+
+                Каждый кусок за один проход подсчитывает значения всех разрядов в собственных
+                счётчиках и проверяет на упорядоченность как собственные элементы, так и пару из
+                своего последнего элемента и первого элемента следующего куска.
+                Если весь диапазон упорядочен, то больше ничего не делается. Иначе счётчики
+                каждого разряда синхронизируются между кусками, и для каждого разряда вычисляется
+                значение максимального счётчика.
+
+            \returns
+                `true`, если образы входного диапазона упорядочены, и `false` в противном случае.
+
+            \see collect_impl
+            \see cross_partial_sum_max
+         */
+        template <typename RandomAccessIterator1, typename Map, typename Radix, typename Counters, typename RandomAccessIterator2, std::size_t ... Radices>
+        bool
+            collect_impl
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator1> chunk_size,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                Map map,
+                Radix radix,
+                Counters counters,
+                RandomAccessIterator2 maximums,
+                std::index_sequence<Radices...>
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            constexpr auto radix_value_range = radix_sort_traits<value_type, Map, Radix>::radix_value_range;
+
+            const auto max_chunk_count =
+                divceil(static_cast<std::size_t>(std::distance(first, last)), static_cast<std::size_t>(chunk_size));
+            auto chunk_is_sorted = std::make_unique<bool[]>(max_chunk_count);
+
+            const auto chunk_count =
+                parallel_by_chunks(pool, chunk_size, first, last,
+                    [last, & counters, & map, & radix, & chunk_is_sorted] (auto chunk_index, auto chunk_begin, auto chunk_end)
                     {
-                        return radix(map(value));
+                        using chunk_index_type = decltype(chunk_index);
+                        const auto chunk_counters = chunk_counters_view<Counters, chunk_index_type>{counters, chunk_index};
+                        const auto is_chunk_sorted =
+                            count_impl(chunk_begin, chunk_end, map, radix, chunk_counters, std::index_sequence<Radices...>{});
+                        const auto is_sorted_with_next =
+                            chunk_end == last || map(*std::prev(chunk_end)) <= map(*chunk_end);
+
+                        chunk_is_sorted[static_cast<std::size_t>(chunk_index)] = is_chunk_sorted && is_sorted_with_next;
                     });
 
-            std::move(buffer, buffer_end, first);
+            const auto is_sorted =
+                std::all_of(chunk_is_sorted.get(), chunk_is_sorted.get() + chunk_count,
+                    [] (auto is_chunk_sorted) {return is_chunk_sorted;});
+            if (not is_sorted)
+            {
+                BURST_EXPAND_VARIADIC(maximums[Radices] = cross_partial_sum_max(pool, counters[Radices], static_cast<std::size_t>(chunk_count), radix_value_range));
+            }
+
+            return is_sorted;
+        }
+
+        template <typename RandomAccessIterator1, typename Map, typename Radix, typename Counters, typename RandomAccessIterator2>
+        bool
+            collect
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator1> chunk_size,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                Map map,
+                Radix radix,
+                Counters counters,
+                RandomAccessIterator2 maximums
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            constexpr auto radix_count = radix_sort_traits<value_type, Map, Radix>::radix_count;
+            return collect_impl(pool, chunk_size, first, last, map, radix, counters, maximums, std::make_index_sequence<radix_count>());
+        }
+
+        //!     Параллельный перенос диапазона с сохранением порядка элементов.
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+        void
+            parallel_move
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator1> chunk_size,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 result
+            )
+        {
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [first, result] (auto, auto chunk_begin, auto chunk_end)
+                {
+                    std::move(chunk_begin, chunk_end, result + (chunk_begin - first));
+                });
+        }
+
+        /*!
+            \brief
+                Один проход параллельной поразрядной сортировки
+
+            \details
+                Распределяет элементы по одному разряду из входного диапазона в выходной.
+
+                Счётчики, собранные функцией `collect` сразу для всех разрядов, соответствуют
+                разбиению на куски исходного расположения элементов. Они пригодны для
+                распределения только до тех пор, пока элементы не были переставлены. Поэтому,
+                начиная со второго распределения, счётчики разряда собираются заново по текущему
+                расположению элементов.
+
+            \param counters_are_actual
+                Флаг, показывающий, соответствуют ли счётчики текущему расположению элементов.
+                После распределения сбрасывается.
+         */
+        template
+        <
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Map,
+            typename Counters,
+            typename Scatter
+        >
+        void
+            radix_sort_pass
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator1> chunk_size,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 result,
+                Map map,
+                Counters counters,
+                bool & counters_are_actual,
+                Scatter scatter
+            )
+        {
+            if (not counters_are_actual)
+            {
+                using value_type = iterator_value_t<RandomAccessIterator1>;
+                constexpr auto radix_value_range = counting_sort_traits<value_type, Map>::value_range;
+
+                const auto chunk_count =
+                    divceil(static_cast<std::size_t>(std::distance(first, last)), static_cast<std::size_t>(chunk_size));
+                std::fill(counters[0], counters[0] + chunk_count * radix_value_range, 0);
+
+                collect(pool, chunk_size, first, last, map, counters);
+            }
+
+            dispose_backward(pool, chunk_size, std::make_move_iterator(first), std::make_move_iterator(last), result, map, counters, scatter);
+            counters_are_actual = false;
+        }
+
+        /*!
+            \brief
+                Итерация параллельной поразрядной сортировки
+
+            \details
+                Параллельный аналог последовательной итерации: разряды, все значения которых
+                одинаковы, пропускаются, а остальные распределяются из той половины (входной
+                диапазон или буфер), где сейчас лежит последовательность, в другую.
+
+            \see radix_sort_iteration
+            \see radix_sort_pass
+         */
+        template
+        <
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Map,
+            typename Radix,
+            typename Counters,
+            typename RandomAccessIterator3,
+            typename Scatter
+        >
+        void
+            radix_sort_iteration
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator1> chunk_size,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer_begin,
+                Map map,
+                Radix radix,
+                Counters counters,
+                RandomAccessIterator3 maximums,
+                std::size_t radix_number,
+                bool & counters_are_actual,
+                bool & sorted_in_buffer,
+                Scatter scatter
+            )
+        {
+            using std::distance;
+            const auto range_size = distance(first, last);
+            if (maximums[radix_number] == range_size)
+            {
+                return;
+            }
+
+            const auto buffer_end = std::next(buffer_begin, range_size);
+            auto nth = compose(nth_radix(radix_number, radix), map);
+            if (sorted_in_buffer)
+            {
+                radix_sort_pass(pool, chunk_size, buffer_begin, buffer_end, first, nth, counters[radix_number], counters_are_actual, scatter);
+            }
+            else
+            {
+                radix_sort_pass(pool, chunk_size, first, last, buffer_begin, nth, counters[radix_number], counters_are_actual, scatter);
+            }
+            sorted_in_buffer = not sorted_in_buffer;
+        }
+
+        /*!
+            \brief
+                Проходы параллельной поразрядной сортировки без переноса результата
+
+            \details
+                Так же, как и последовательный вариант, сначала за один проход собирает счётчики
+                для всех разрядов. Если входной диапазон уже упорядочен, то на этом всё
+                заканчивается. Иначе пропускаются все разряды, значения которых одинаковы для всех
+                элементов, а остальные распределяются по очереди. Память для распределения
+                выделяется один раз на все проходы, отдельно для каждого куска.
+
+            \returns
+                `true`, если упорядоченная последовательность оказалась в буфере, и `false`, если
+                она находится во входном диапазоне.
+
+            \see radix_sort_iteration
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Scatter>
+        bool radix_sort_passes (boost::asio::thread_pool & pool, const std::array<std::size_t, 2> & shape, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer_begin, Map map, Radix radix, Scatter scatter)
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            const auto chunks =
+                refine_shape(shape, static_cast<std::size_t>(std::distance(first, last)), traits::radix_count * traits::radix_value_range);
+            const auto chunk_count = chunks[0];
+            const auto chunk_size = static_cast<difference_type>(chunks[1]);
+
+            auto counters = std::make_unique<difference_type[]>(traits::radix_count * chunk_count * traits::radix_value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(traits::radix_count, chunk_count, traits::radix_value_range));
+            difference_type maximums[traits::radix_count] = {0};
+
+            auto sorted_in_buffer = false;
+            const auto is_sorted = collect(pool, chunk_size, first, last, map, radix, counters_view, maximums);
+            if (not is_sorted)
+            {
+                auto counters_are_actual = true;
+                const auto buffers = scatter_buffers<value_type, traits::radix_value_range, Scatter>(scatter, chunk_count);
+                for (auto radix_number = 0ul; radix_number < traits::radix_count; ++radix_number)
+                {
+                    radix_sort_iteration(pool, chunk_size, first, last, buffer_begin, map, radix, counters_view, maximums, radix_number, counters_are_actual, sorted_in_buffer, buffers.get());
+                }
+            }
+
+            return sorted_in_buffer;
         }
 
-        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        /*!
+            \brief
+                Параллельная поразрядная сортировка для многоразрядных чисел
+
+            \details
+                Последовательность, оказавшаяся по окончании проходов в буфере, параллельно
+                переносится обратно во входной диапазон.
+
+            \see radix_sort_passes
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Scatter = direct_scatter_fn>
         typename std::enable_if
         <
-            radix_sort_traits
+            (radix_sort_traits
             <
                 iterator_value_t<RandomAccessIterator1>,
                 Map,
                 Radix
             >
-            ::radix_count % 2 == 0
+            ::radix_count > 1)
         >
-        ::type radix_sort_impl (boost::asio::thread_pool & pool, const std::array<std::size_t, 2> & shape, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer_begin, Map map, Radix radix)
+        ::type radix_sort_impl (boost::asio::thread_pool & pool, const std::array<std::size_t, 2> & shape, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer_begin, Map map, Radix radix, Scatter scatter = Scatter{})
         {
-            using value_type = iterator_value_t<RandomAccessIterator1>;
-            using traits = radix_sort_traits<value_type, Map, Radix>;
             using difference_type = iterator_difference_t<RandomAccessIterator1>;
 
-            const auto thread_count = shape[0];
-            const auto chunk_size = static_cast<difference_type>(shape[1]);
-
-            auto counters = std::make_unique<difference_type[]>(traits::radix_count * thread_count * traits::radix_value_range);
-            auto counters_view = make_shaped_array_view(counters.get(), make_shape(traits::radix_count, thread_count, traits::radix_value_range));
-
-            const auto buffer_end = buffer_begin + std::distance(first, last);
-            for (auto radix_number = 0ul; radix_number < traits::radix_count; radix_number += 2)
+            const auto sorted_in_buffer = radix_sort_passes(pool, shape, first, last, buffer_begin, map, radix, scatter);
+            if (sorted_in_buffer)
             {
-                auto nth = compose(nth_radix(radix_number, radix), map);
-                counting_sort_impl(pool, chunk_size, std::make_move_iterator(first), std::make_move_iterator(last), buffer_begin, nth, counters_view[radix_number]);
-
-                auto n1th = compose(nth_radix(radix_number + 1, radix), map);
-                counting_sort_impl(pool, chunk_size, std::make_move_iterator(buffer_begin), std::make_move_iterator(buffer_end), first, n1th, counters_view[radix_number + 1]);
+                const auto chunk_size = static_cast<difference_type>(shape[1]);
+                parallel_move(pool, chunk_size, buffer_begin, std::next(buffer_begin, std::distance(first, last)), first);
             }
         }
     } // namespace detail
@@ -0,0 +1,120 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_INPLACE_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_INPLACE_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/nth_radix.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort.hpp>
+#include <burst/algorithm/detail/radix_sort_inplace.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная поразрядная сортировка на месте
+
+            \details
+                1.  Параллельно за один проход собирает счётчики всех разрядов и проверяет
+                    упорядоченность диапазона (см. `collect`). Упорядоченный диапазон сразу
+                    возвращается.
+                2.  Находит старший разряд, значения которого различны, и распределяет по нему
+                    весь диапазон на месте. Это распределение последовательно.
+                3.  Каждая из полученных корзин независимо сортируется последовательным
+                    алгоритмом в отдельной задаче пула.
+
+            \see american_flag_sort
+         */
+        template <typename RandomAccessIterator, typename Map, typename Radix>
+        void
+            radix_sort_inplace_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Map map,
+                Radix radix
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            const auto chunks =
+                refine_shape(shape, static_cast<std::size_t>(std::distance(first, last)), traits::radix_count * traits::radix_value_range);
+            const auto chunk_count = chunks[0];
+            const auto chunk_size = static_cast<difference_type>(chunks[1]);
+
+            auto counters = std::make_unique<difference_type[]>(traits::radix_count * chunk_count * traits::radix_value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(traits::radix_count, chunk_count, traits::radix_value_range));
+            difference_type maximums[traits::radix_count] = {0};
+
+            const auto is_sorted = collect(pool, chunk_size, first, last, map, radix, counters_view, maximums);
+            if (is_sorted)
+            {
+                return;
+            }
+
+            const auto range_size = std::distance(first, last);
+            auto radix_number = traits::radix_count - 1;
+            while (maximums[radix_number] == range_size)
+            {
+                --radix_number;
+            }
+
+            // После синхронизации между кусками последняя строка счётчиков разряда содержит
+            // концы корзин во всём диапазоне.
+            const auto ends = counters_view[radix_number][chunk_count - 1];
+            auto heads = std::make_unique<difference_type[]>(traits::radix_value_range);
+            std::copy(ends, ends + traits::radix_value_range - 1, heads.get() + 1);
+            detail::post(pool,
+                [first, & map, & radix, radix_number, & heads, ends]
+                {
+                    dispose_inplace(first, compose(nth_radix(radix_number, radix), map), heads.get(), ends, traits::radix_value_range);
+                }).get();
+
+            if (radix_number > 0)
+            {
+                std::vector<std::future<void>> results;
+
+                auto bucket_begin = difference_type{0};
+                for (auto bucket = 0ul; bucket < traits::radix_value_range; ++bucket)
+                {
+                    const auto bucket_end = ends[bucket];
+                    if (bucket_end - bucket_begin > 1)
+                    {
+                        results.push_back(detail::post(pool,
+                            [bucket_first = first + bucket_begin, bucket_last = first + bucket_end, & map, & radix, radix_number]
+                            {
+                                auto bucket_counters = std::make_unique<difference_type[]>((traits::radix_count + 1) * traits::radix_value_range);
+                                auto bucket_counters_view = make_shaped_array_view(bucket_counters.get(), make_shape(traits::radix_count + 1, traits::radix_value_range));
+                                american_flag_sort(bucket_first, bucket_last, map, radix, radix_number - 1, bucket_counters_view);
+                            }));
+                    }
+                    bucket_begin = bucket_end;
+                }
+
+                std::for_each(results.begin(), results.end(), [] (auto & r) {r.get();});
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_INPLACE_HPP
@@ -0,0 +1,374 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_UNIQUE_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_UNIQUE_HPP
+
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/integer/divceil.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Расположение начал групп по кускам
+
+            \details
+                Началом группы считается элемент, образ которого отличается от образа
+                предыдущего элемента, а также самый первый элемент диапазона.
+                `head_offsets[i]` — количество начал групп во всех кусках до `i`-го,
+                `first_heads[i]` — расстояние от начала диапазона до первого начала группы в
+                `i`-м куске или размер диапазона, если в куске нет ни одного начала группы.
+                `next_heads[i]` — расстояние до ближайшего начала группы за пределами `i`-го
+                куска или размер диапазона, если таких нет.
+         */
+        template <typename Integer>
+        struct run_heads
+        {
+            explicit run_heads (std::size_t max_chunk_count):
+                head_offsets(std::make_unique<Integer[]>(max_chunk_count + 1)),
+                first_heads(std::make_unique<Integer[]>(max_chunk_count)),
+                next_heads(std::make_unique<Integer[]>(max_chunk_count))
+            {
+            }
+
+            Integer head_count () const
+            {
+                return head_offsets[chunk_count];
+            }
+
+            std::size_t chunk_count = 0;
+            std::unique_ptr<Integer[]> head_offsets;
+            std::unique_ptr<Integer[]> first_heads;
+            std::unique_ptr<Integer[]> next_heads;
+        };
+
+        /*!
+            \brief
+                Параллельный поиск начал групп равных образов
+
+            \details
+                Каждый кусок подсчитывает начала групп в своих пределах. Чтобы понять, является ли
+                началом группы первый элемент куска, он сравнивается с последним элементом
+                предыдущего куска, поэтому группа, пересекающая границу кусков, учитывается
+                только один раз — в том куске, где она начинается.
+
+            \see run_heads
+         */
+        template <typename RandomAccessIterator, typename Map>
+        auto
+            find_run_heads
+            (
+                boost::asio::thread_pool & pool,
+                iterator_difference_t<RandomAccessIterator> chunk_size,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Map & map
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            using std::distance;
+            const auto range_size = distance(first, last);
+            const auto max_chunk_count =
+                divceil(static_cast<std::size_t>(range_size), static_cast<std::size_t>(chunk_size));
+            auto heads = run_heads<difference_type>(max_chunk_count);
+
+            const auto chunk_count =
+                parallel_by_chunks(pool, chunk_size, first, last,
+                    [first, range_size, & map, & heads] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                    {
+                        const auto chunk = static_cast<std::size_t>(chunk_index);
+
+                        auto image = map(*chunk_begin);
+                        auto head_count = difference_type{0};
+                        auto first_head = range_size;
+                        if (chunk_begin == first || map(*std::prev(chunk_begin)) != image)
+                        {
+                            head_count = 1;
+                            first_head = chunk_begin - first;
+                        }
+
+                        for (auto element = std::next(chunk_begin); element != chunk_end; ++element)
+                        {
+                            auto next_image = map(*element);
+                            if (next_image != image)
+                            {
+                                if (head_count == 0)
+                                {
+                                    first_head = element - first;
+                                }
+                                ++head_count;
+                                image = next_image;
+                            }
+                        }
+
+                        heads.head_offsets[chunk + 1] = head_count;
+                        heads.first_heads[chunk] = first_head;
+                    });
+
+            heads.chunk_count = static_cast<std::size_t>(chunk_count);
+            heads.head_offsets[0] = 0;
+            std::partial_sum(heads.head_offsets.get(), heads.head_offsets.get() + heads.chunk_count + 1, heads.head_offsets.get());
+
+            auto next_head = range_size;
+            for (auto chunk = heads.chunk_count; chunk > 0; --chunk)
+            {
+                heads.next_heads[chunk - 1] = next_head;
+                next_head = std::min(next_head, heads.first_heads[chunk - 1]);
+            }
+
+            return heads;
+        }
+
+        /*!
+            \brief
+                Параллельное завершение сортировки удалением повторов
+
+            \details
+                Параллельный аналог `unique_finish`. Сначала находятся начала групп (см.
+                `find_run_heads`), а затем каждый кусок переносит свои начала групп на места,
+                известные заранее.
+                Если упорядоченная последовательность находится в буфере, то начала групп сразу
+                переносятся во входной диапазон. Иначе они сначала переносятся в буфер, а затем
+                обратно, потому что при переносе внутри одного диапазона куски могли бы
+                затирать ещё не прочитанные элементы друг друга.
+
+            \see unique_finish
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+        struct parallel_unique_finish
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            RandomAccessIterator1 in_place (RandomAccessIterator1 sorted_first, RandomAccessIterator1 sorted_last)
+            {
+                const auto unique_count = move_heads(sorted_first, sorted_last, buffer);
+                parallel_move(*pool, chunk_size, buffer, std::next(buffer, unique_count), first);
+
+                return std::next(first, unique_count);
+            }
+
+            RandomAccessIterator1 from_buffer (RandomAccessIterator2 buffer_first, RandomAccessIterator2 buffer_last)
+            {
+                const auto unique_count = move_heads(buffer_first, buffer_last, first);
+                return std::next(first, unique_count);
+            }
+
+            template <typename RandomAccessIterator3, typename RandomAccessIterator4>
+            difference_type move_heads (RandomAccessIterator3 sorted_first, RandomAccessIterator3 sorted_last, RandomAccessIterator4 result)
+            {
+                const auto heads = find_run_heads(*pool, chunk_size, sorted_first, sorted_last, map);
+                parallel_by_chunks(*pool, chunk_size, sorted_first, sorted_last,
+                    [this, sorted_first, result, & heads] (auto chunk_index, auto, auto chunk_end)
+                    {
+                        const auto chunk = static_cast<std::size_t>(chunk_index);
+                        auto head = std::next(sorted_first, heads.first_heads[chunk]);
+                        if (head >= chunk_end)
+                        {
+                            return;
+                        }
+
+                        auto output = std::next(result, heads.head_offsets[chunk]);
+                        auto image = map(*head);
+                        *output++ = std::move(*head);
+                        for (auto element = std::next(head); element != chunk_end; ++element)
+                        {
+                            auto next_image = map(*element);
+                            if (next_image != image)
+                            {
+                                *output++ = std::move(*element);
+                                image = next_image;
+                            }
+                        }
+                    });
+
+                return heads.head_count();
+            }
+
+            boost::asio::thread_pool * pool;
+            difference_type chunk_size;
+            RandomAccessIterator1 first;
+            RandomAccessIterator2 buffer;
+            Map map;
+        };
+
+        /*!
+            \brief
+                Параллельное завершение сортировки подсчётом повторов
+
+            \details
+                Параллельный аналог `count_finish`. После поиска начал групп (см.
+                `find_run_heads`) каждый кусок переносит свои элементы во входной диапазон (если
+                последовательность в буфере) и записывает пары для групп, которые в нём
+                начинаются. Размер последней группы куска определяется по ближайшему началу
+                группы за его пределами, поэтому читать чужие куски не требуется.
+                Пары записываются по заранее известным номерам, поэтому выходной итератор должен
+                быть итератором произвольного доступа.
+
+            \see count_finish
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+        struct parallel_count_finish
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            RandomAccessIterator2 in_place (RandomAccessIterator1 sorted_first, RandomAccessIterator1 sorted_last)
+            {
+                const auto heads = find_run_heads(*pool, chunk_size, sorted_first, sorted_last, map);
+                parallel_by_chunks(*pool, chunk_size, sorted_first, sorted_last,
+                    [this, & heads] (auto chunk_index, auto, auto chunk_end)
+                    {
+                        write_counts(static_cast<std::size_t>(chunk_index), chunk_end, heads);
+                    });
+
+                return std::next(result, heads.head_count());
+            }
+
+            template <typename RandomAccessIterator3>
+            RandomAccessIterator2 from_buffer (RandomAccessIterator3 buffer_first, RandomAccessIterator3 buffer_last)
+            {
+                const auto heads = find_run_heads(*pool, chunk_size, buffer_first, buffer_last, map);
+                parallel_by_chunks(*pool, chunk_size, buffer_first, buffer_last,
+                    [this, buffer_first, & heads] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                    {
+                        const auto destination = std::next(first, chunk_begin - buffer_first);
+                        const auto destination_end = std::move(chunk_begin, chunk_end, destination);
+                        write_counts(static_cast<std::size_t>(chunk_index), destination_end, heads);
+                    });
+
+                return std::next(result, heads.head_count());
+            }
+
+            //!     Записать пары для групп, начинающихся в куске с номером `chunk`.
+            void write_counts (std::size_t chunk, RandomAccessIterator1 chunk_end, const run_heads<difference_type> & heads)
+            {
+                auto run_first = std::next(first, heads.first_heads[chunk]);
+                if (run_first >= chunk_end)
+                {
+                    return;
+                }
+
+                auto output = std::next(result, heads.head_offsets[chunk]);
+                auto image = map(*run_first);
+                for (auto element = std::next(run_first); element != chunk_end; ++element)
+                {
+                    auto next_image = map(*element);
+                    if (next_image != image)
+                    {
+                        *output++ = std::pair<value_type, difference_type>(*run_first, element - run_first);
+                        run_first = element;
+                        image = next_image;
+                    }
+                }
+
+                const auto run_last = std::next(first, heads.next_heads[chunk]);
+                *output = std::pair<value_type, difference_type>(*run_first, run_last - run_first);
+            }
+
+            boost::asio::thread_pool * pool;
+            difference_type chunk_size;
+            RandomAccessIterator1 first;
+            RandomAccessIterator2 result;
+            Map map;
+        };
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Finish>
+        auto
+            radix_sort_and_finish
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                Finish finish,
+                std::true_type
+            )
+        {
+            const auto buffer_end =
+                counting_sort_impl(pool, shape, std::make_move_iterator(first), std::make_move_iterator(last), buffer,
+                    compose(std::move(radix), std::move(map)), direct_scatter);
+
+            return finish.from_buffer(buffer, buffer_end);
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Finish>
+        auto
+            radix_sort_and_finish
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                Finish finish,
+                std::false_type
+            )
+        {
+            const auto sorted_in_buffer = radix_sort_passes(pool, shape, first, last, buffer, map, radix, direct_scatter);
+            if (sorted_in_buffer)
+            {
+                return finish.from_buffer(buffer, std::next(buffer, std::distance(first, last)));
+            }
+            else
+            {
+                return finish.in_place(first, last);
+            }
+        }
+
+        /*!
+            \brief
+                Параллельная поразрядная сортировка с завершающим проходом
+
+            \details
+                Параллельный аналог последовательной функции `radix_sort_and_finish`.
+
+            \see parallel_unique_finish
+            \see parallel_count_finish
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Finish>
+        auto
+            radix_sort_and_finish
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                Finish finish
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using is_single_radix = std::integral_constant<bool, traits::radix_count == 1>;
+
+            return radix_sort_and_finish(pool, shape, first, last, buffer, std::move(map), radix, std::move(finish), is_single_radix{});
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_RADIX_SORT_UNIQUE_HPP
@@ -0,0 +1,94 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_SAMPLE_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_SAMPLE_SORT_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_cross_partial_sum.hpp>
+#include <burst/algorithm/detail/sample_sort.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная сортировка выборкой
+
+            \details
+                Распределение по корзинам устроено так же, как в параллельной сортировке
+                подсчётом: каждый кусок определяет корзины своих элементов и собирает собственные
+                счётчики, счётчики синхронизируются между кусками, и каждый кусок распределяет
+                свои элементы в буфер. После этого каждая корзина, кроме корзин равенства,
+                сортируется отдельной задачей пула. Корзин в несколько раз больше, чем потоков, поэтому освободившийся поток
+                сразу берёт следующую корзину, и неравные размеры корзин сглаживаются.
+
+            \see sample_sort_impl
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+        void
+            sample_sort_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Compare compare
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            using std::distance;
+            const auto range_size = static_cast<std::size_t>(distance(first, last));
+            const auto tree = make_splitter_tree(first, last, sample_sort_level_count(range_size, shape[0]), compare);
+            const auto bucket_count = tree.bucket_count();
+
+            const auto chunks = refine_shape(shape, range_size, bucket_count);
+            const auto chunk_size = static_cast<difference_type>(chunks[1]);
+
+            auto buckets = std::make_unique<sample_sort_bucket_type[]>(range_size);
+            auto counters = std::make_unique<difference_type[]>(chunks[0] * bucket_count);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(chunks[0], bucket_count));
+
+            const auto chunk_count =
+                parallel_by_chunks(pool, chunk_size, first, last,
+                    [first, & tree, & buckets, & counters_view] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                    {
+                        const auto chunk_buckets = buckets.get() + (chunk_begin - first);
+                        classify(chunk_begin, chunk_end, tree, chunk_buckets, counters_view[chunk_index]);
+                    });
+            parallel_cross_partial_sum(pool, counters_view, static_cast<std::size_t>(chunk_count), bucket_count);
+
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [first, buffer, & buckets, & counters_view] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                {
+                    const auto chunk_buckets = buckets.get() + (chunk_begin - first);
+                    scatter_backward(chunk_begin, chunk_end, chunk_buckets, buffer, counters_view[chunk_index]);
+                });
+
+            // После распределения счётчики нулевого куска указывают на начала корзин.
+            const auto bucket_begins = counters_view[0];
+            const auto range_end = static_cast<difference_type>(range_size);
+            const auto bucket_indices = boost::counting_iterator<std::size_t>(0);
+            parallel_by_chunks(pool, 1, bucket_indices, bucket_indices + static_cast<std::ptrdiff_t>(bucket_count),
+                [first, buffer, bucket_begins, bucket_count, range_end, & tree] (auto, auto bucket, auto)
+                {
+                    const auto bucket_begin = bucket_begins[*bucket];
+                    const auto bucket_end = *bucket + 1 < bucket_count ? bucket_begins[*bucket + 1] : range_end;
+                    sort_bucket(tree, *bucket, buffer + bucket_begin, buffer + bucket_end, first + bucket_begin);
+                });
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_SAMPLE_SORT_HPP
@@ -0,0 +1,89 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_SEGMENTED_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_SEGMENTED_RADIX_SORT_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/segmented_radix_sort.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная сортировка отрезков
+
+            \details
+                Соседние отрезки объединяются в пачки так, чтобы в каждой пачке было примерно
+                `chunk_size` элементов, а отрезок крупнее этого размера составляет пачку
+                самостоятельно. Каждая пачка сортируется последовательно в отдельной задаче
+                пула со своими счётчиками и своим участком буфера. Пачки ставятся в пул через
+                `parallel_by_chunks` от самой большой к самой маленькой, чтобы самые долгие задачи
+                начались первыми, а короткие заполнили оставшееся время.
+
+            \see segmented_radix_sort_impl
+         */
+        template <typename Counter, typename RandomAccessIterator1, typename ForwardIterator, typename RandomAccessIterator2, typename Map, typename Radix>
+        void
+            segmented_radix_sort_impl
+            (
+                boost::asio::thread_pool & pool,
+                std::size_t chunk_size,
+                RandomAccessIterator1 first,
+                ForwardIterator offsets_first,
+                ForwardIterator offsets_last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix
+            )
+        {
+            if (offsets_first == offsets_last)
+            {
+                return;
+            }
+
+            struct batch
+            {
+                ForwardIterator offsets_first;
+                ForwardIterator offsets_last;
+                std::size_t size;
+            };
+
+            std::vector<batch> batches;
+            auto batch_first = offsets_first;
+            for (auto offset = std::next(offsets_first); offset != offsets_last; ++offset)
+            {
+                const auto batch_size = static_cast<std::size_t>(*offset - *batch_first);
+                if (batch_size >= chunk_size || std::next(offset) == offsets_last)
+                {
+                    batches.push_back(batch{batch_first, std::next(offset), batch_size});
+                    batch_first = offset;
+                }
+            }
+
+            std::stable_sort(batches.begin(), batches.end(),
+                [] (const batch & left, const batch & right)
+                {
+                    return left.size > right.size;
+                });
+
+            // Каждая пачка — отдельный кусок, поэтому пачки уходят в пул в порядке убывания.
+            detail::parallel_by_chunks(pool, 1, batches.begin(), batches.end(),
+                [first, buffer, & map, & radix] (auto, auto b, auto)
+                {
+                    const auto batch_buffer = std::next(buffer, static_cast<iterator_difference_t<RandomAccessIterator2>>(*b->offsets_first));
+                    segmented_radix_sort_impl<Counter>(first, b->offsets_first, b->offsets_last, batch_buffer, map, radix);
+                });
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_SEGMENTED_RADIX_SORT_HPP
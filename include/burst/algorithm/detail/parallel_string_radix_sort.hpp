@@ -0,0 +1,98 @@
+#ifndef BURST__ALGORITHM__DETAIL__PARALLEL_STRING_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__PARALLEL_STRING_RADIX_SORT_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_counting_sort.hpp>
+#include <burst/algorithm/detail/parallel_cross_partial_sum.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort.hpp>
+#include <burst/algorithm/detail/string_radix_sort.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Параллельная поразрядная сортировка строк
+
+            \details
+                Первый символ обрабатывается всеми потоками сразу: каждый кусок подсчитывает
+                символы в собственных счётчиках, счётчики синхронизируются между кусками, после
+                чего каждый кусок распределяет свои элементы в буфер, и элементы параллельно
+                переносятся обратно.
+                Получившиеся корзины независимы, поэтому каждая из них досортировывается
+                последовательным алгоритмом в отдельной задаче пула, используя свой участок
+                буфера.
+
+            \see string_radix_sort_impl
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+        void
+            string_radix_sort_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            const auto chunks = refine_shape(shape, static_cast<std::size_t>(last - first), string_radix_value_range);
+            const auto chunk_count = chunks[0];
+            const auto chunk_size = static_cast<difference_type>(chunks[1]);
+            const auto digit = string_digit(map, 0);
+
+            auto counters = std::make_unique<difference_type[]>(chunk_count * string_radix_value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(chunk_count, string_radix_value_range));
+
+            parallel_by_chunks(pool, chunk_size, first, last,
+                [& counters_view, & digit] (auto chunk_index, auto chunk_begin, auto chunk_end)
+                {
+                    count(chunk_begin, chunk_end, digit, counters_view[chunk_index]);
+                });
+            parallel_cross_partial_sum(pool, counters_view, chunk_count, string_radix_value_range);
+
+            const auto range_size = last - first;
+            dispose_backward(pool, chunk_size, std::make_move_iterator(first), std::make_move_iterator(last), buffer, digit, counters_view);
+            parallel_move(pool, chunk_size, buffer, std::next(buffer, range_size), first);
+
+            // После обратного распределения первая строка счётчиков содержит начала корзин.
+            const auto starts = counters_view[0];
+            std::vector<std::future<void>> results;
+            for (auto bucket = 1ul; bucket < string_radix_value_range; ++bucket)
+            {
+                const auto bucket_begin = starts[bucket];
+                const auto bucket_end = bucket + 1 < string_radix_value_range ? starts[bucket + 1] : range_size;
+                if (bucket_end - bucket_begin > 1)
+                {
+                    results.push_back(detail::post(pool,
+                        [bucket_first = first + bucket_begin, bucket_last = first + bucket_end, bucket_buffer = std::next(buffer, bucket_begin), & map]
+                        {
+                            string_radix_sort_impl(bucket_first, bucket_last, bucket_buffer, map, 1);
+                        }));
+                }
+            }
+
+            std::for_each(results.begin(), results.end(), [] (auto & r) {r.get();});
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__PARALLEL_STRING_RADIX_SORT_HPP
@@ -0,0 +1,123 @@
+#ifndef BURST__ALGORITHM__DETAIL__RADIX_ARGSORT_HPP
+#define BURST__ALGORITHM__DETAIL__RADIX_ARGSORT_HPP
+
+#include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Индекс элемента вместе с ключом, по которому этот элемент сортируется.
+        template <typename Key, typename Index>
+        struct keyed_index
+        {
+            Key key;
+            Index index;
+        };
+
+        struct key_of_fn
+        {
+            template <typename Key, typename Index>
+            constexpr Key operator () (const keyed_index<Key, Index> & k) const
+            {
+                return k.key;
+            }
+        };
+        constexpr auto key_of = key_of_fn{};
+
+        struct index_of_fn
+        {
+            template <typename Key, typename Index>
+            constexpr Index operator () (const keyed_index<Key, Index> & k) const
+            {
+                return k.index;
+            }
+        };
+        constexpr auto index_of = index_of_fn{};
+
+        template <typename Index, typename RandomAccessIterator, typename Map>
+        using keyed_index_for_t =
+            keyed_index
+            <
+                std::decay_t<invoke_result_t<Map, iterator_value_t<RandomAccessIterator>>>,
+                Index
+            >;
+
+        /*!
+            \brief
+                Массив без инициализации элементов
+
+            \details
+                Ключи с индексами полностью перезаписываются перед использованием, поэтому
+                обнулять их при выделении памяти не нужно.
+         */
+        template <typename T>
+        std::unique_ptr<T[]> make_uninitialized_array (std::size_t size)
+        {
+            static_assert(std::is_trivial<T>::value, "");
+            return std::unique_ptr<T[]>(new T[size]);
+        }
+
+        /*!
+            \brief
+                Косвенная поразрядная сортировка
+
+            \details
+                Для каждого элемента входного диапазона вычисляет ключ `map(first[i])` и
+                сортирует поразрядно пары из ключа и индекса `i`. Поскольку за каждый проход
+                переносятся только эти пары, а не сами элементы, то объём пересылаемой памяти не
+                зависит от размера сортируемых объектов.
+                Индексы отсортированных пар записываются в выходной итератор.
+
+            \tparam Counter
+                Тип счётчиков поразрядной сортировки.
+            \tparam Index
+                Тип индекса. Должен вмещать размер входного диапазона.
+         */
+        template
+        <
+            typename Counter,
+            typename Index,
+            typename RandomAccessIterator,
+            typename OutputIterator,
+            typename Map,
+            typename Radix
+        >
+        OutputIterator
+            radix_argsort_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                OutputIterator result,
+                Map map,
+                Radix radix
+            )
+        {
+            using keyed_index_type = keyed_index_for_t<Index, RandomAccessIterator, Map>;
+
+            using std::distance;
+            const auto size = static_cast<std::size_t>(distance(first, last));
+            auto keys = make_uninitialized_array<keyed_index_type>(size);
+            auto buffer = make_uninitialized_array<keyed_index_type>(size);
+
+            for (auto index = std::size_t{0}; index < size; ++index)
+            {
+                keys[index] = keyed_index_type{map(*first++), static_cast<Index>(index)};
+            }
+
+            radix_sort_impl<Counter>(keys.get(), keys.get() + size, buffer.get(), key_of, radix);
+
+            return std::transform(keys.get(), keys.get() + size, result, index_of);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__RADIX_ARGSORT_HPP
@@ -0,0 +1,189 @@
+#ifndef BURST__ALGORITHM__DETAIL__RADIX_SELECT_HPP
+#define BURST__ALGORITHM__DETAIL__RADIX_SELECT_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/detail/nth_radix.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/algorithm/partial_sum_max.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер диапазона, в котором нужный элемент ищется сравнениями, а не поразрядно.
+        constexpr auto radix_select_small_range_size = 64;
+
+        /*!
+            \brief
+                Трёхчастное разбиение по значению разряда
+
+            \details
+                Переставляет элементы диапазона `[first, last)` так, что в `[0, bucket_begin)`
+                оказываются элементы, значение разряда которых меньше `bucket`, в
+                `[bucket_begin, bucket_end)` — равное `bucket`, а в остальной части — большее
+                `bucket`.
+                Выполняется двумя двухчастными разбиениями, причём второе разбиение делается в той
+                из получившихся после первого частей, которая короче. Поэтому если искомая корзина
+                лежит близко к краю диапазона (например, при поиске небольшого количества
+                наименьших элементов), то работа сводится к одному разбиению всего диапазона.
+         */
+        template <typename RandomAccessIterator, typename Map, typename Difference>
+        void
+            partition_by_bucket
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Map map,
+                std::size_t bucket,
+                Difference bucket_begin,
+                Difference bucket_end
+            )
+        {
+            const auto digit_of = [& map] (const auto & value) {return static_cast<std::size_t>(map(value));};
+            if (bucket_end < (last - first) - bucket_begin)
+            {
+                const auto greater_begin =
+                    std::partition(first, last, [& digit_of, bucket] (const auto & v) {return digit_of(v) <= bucket;});
+                std::partition(first, greater_begin, [& digit_of, bucket] (const auto & v) {return digit_of(v) < bucket;});
+            }
+            else
+            {
+                const auto equal_begin =
+                    std::partition(first, last, [& digit_of, bucket] (const auto & v) {return digit_of(v) < bucket;});
+                std::partition(equal_begin, last, [& digit_of, bucket] (const auto & v) {return digit_of(v) == bucket;});
+            }
+        }
+
+        /*!
+            \brief
+                Сужение диапазона до корзины, содержащей n-й элемент
+
+            \details
+                По концам корзин `ends` находит корзину, в которую попадёт элемент с позицией `nth`
+                в упорядоченном диапазоне, и разбивает диапазон так, чтобы эта корзина заняла своё
+                итоговое место. Если все элементы попадают в одну корзину, то разбиение не
+                требуется.
+
+            \returns
+                Границы найденной корзины.
+         */
+        template <typename RandomAccessIterator1, typename Map, typename RandomAccessIterator2>
+        std::pair<RandomAccessIterator1, RandomAccessIterator1>
+            narrow_to_bucket
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 nth,
+                RandomAccessIterator1 last,
+                Map map,
+                RandomAccessIterator2 ends,
+                std::size_t value_range
+            )
+        {
+            const auto position = nth - first;
+            const auto bucket_end = std::upper_bound(ends, ends + value_range, position);
+            const auto bucket = static_cast<std::size_t>(bucket_end - ends);
+            const auto bucket_begin = bucket == 0 ? 0 : ends[bucket - 1];
+
+            if (*bucket_end - bucket_begin != last - first)
+            {
+                partition_by_bucket(first, last, map, bucket, bucket_begin, *bucket_end);
+            }
+            return std::make_pair(first + bucket_begin, first + *bucket_end);
+        }
+
+        /*!
+            \brief
+                Поразрядный поиск n-го элемента, начиная с разряда `radix_number - 1`
+
+            \details
+                На каждом шаге подсчитывает значения текущего разряда, находит корзину, в
+                которую попадает n-й элемент, разбивает диапазон на три части (меньшие, равные и
+                большие значения разряда) и переходит к следующему разряду уже только внутри
+                найденной корзины. Разряды, значения которых одинаковы у всех элементов
+                оставшегося диапазона, пропускаются.
+                Когда диапазон становится достаточно коротким, оставшаяся работа выполняется
+                сравнениями. Если же разряды закончились, то все элементы оставшегося диапазона
+                имеют одинаковый образ, и больше ничего делать не нужно.
+         */
+        template <typename RandomAccessIterator, typename Map, typename Radix>
+        void
+            radix_select_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator nth,
+                RandomAccessIterator last,
+                Map map,
+                Radix radix,
+                std::size_t radix_number
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            auto counters = std::unique_ptr<difference_type[]>{};
+            while (last - first > radix_select_small_range_size)
+            {
+                if (radix_number == 0)
+                {
+                    return;
+                }
+                --radix_number;
+
+                if (not counters)
+                {
+                    counters = std::make_unique<difference_type[]>(traits::radix_value_range);
+                }
+                const auto ends = counters.get();
+                const auto digit = compose(nth_radix(radix_number, radix), map);
+
+                std::fill(ends, ends + traits::radix_value_range, 0);
+                count(first, last, digit, ends);
+                const auto maximum = partial_sum_max(ends, ends + traits::radix_value_range, ends).second;
+                if (maximum != last - first)
+                {
+                    const auto bucket = narrow_to_bucket(first, nth, last, digit, ends, traits::radix_value_range);
+                    first = bucket.first;
+                    last = bucket.second;
+                }
+            }
+
+            std::nth_element(first, nth, last,
+                [& map] (const auto & left, const auto & right)
+                {
+                    return map(left) < map(right);
+                });
+        }
+
+        template <typename RandomAccessIterator, typename Map, typename Radix>
+        void
+            radix_select_impl
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator nth,
+                RandomAccessIterator last,
+                Map map,
+                Radix radix
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+
+            if (nth != last)
+            {
+                radix_select_impl(first, nth, last, map, radix, traits::radix_count);
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__RADIX_SELECT_HPP
@@ -4,9 +4,11 @@
 #include <burst/algorithm/detail/counting_sort.hpp>
 #include <burst/algorithm/detail/nth_radix.hpp>
 #include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/algorithm/detail/write_combining.hpp>
 #include <burst/algorithm/partial_sum_max.hpp>
 #include <burst/functional/compose.hpp>
 #include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_category.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
 #include <burst/type_traits/iterator_value.hpp>
 #include <burst/variadic.hpp>
@@ -14,6 +16,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <type_traits>
 #include <utility>
@@ -22,6 +26,170 @@ namespace burst
 {
     namespace detail
     {
+        /*!
+            \brief
+                Подсчёт значений сразу для всех разрядов
+
+            \details
+                Для каждого элемента входного диапазона и для каждого разряда `i` его образа
+                увеличивает на единицу счётчик `counters[i][r]`, где `r` — значение этого разряда.
+                Заодно проверяет образы входной последовательности на упорядоченность.
+
+            \returns
+                `true`, если образы входного диапазона упорядочены по неубыванию, и `false` в
+                противном случае.
+        */
+        template <typename ForwardIterator, typename Map, typename Radix, typename RandomAccessIterator, std::size_t ... Radices>
+        bool count_plain_impl (ForwardIterator first, ForwardIterator last, Map map, Radix radix, RandomAccessIterator counters, std::index_sequence<Radices...>)
+        {
+            using value_type = iterator_value_t<ForwardIterator>;
+
+            auto previous = std::numeric_limits<invoke_result_t<Map, value_type>>::min();
+            auto is_sorted = true;
+            std::for_each(first, last,
+                [& counters, & map, & radix, & previous, & is_sorted] (const auto & preimage)
+                {
+                    auto image = map(preimage);
+                    is_sorted &= (image >= previous);
+                    previous = image;
+
+                    BURST_EXPAND_VARIADIC(++counters[Radices][nth_radix(Radices, radix)(image)]);
+                });
+
+            return is_sorted;
+        }
+
+        //!     Количество копий счётчиков при подсчёте с чередованием.
+        constexpr auto interleaved_histogram_count = std::size_t{4};
+
+        //!     Размер диапазона, начиная с которого счётчики собираются с чередованием.
+        constexpr auto interleaved_histogram_threshold = std::ptrdiff_t{1} << 15;
+
+        /*!
+            \brief
+                Подсчёт значений с чередованием копий счётчиков
+
+            \details
+                Результат тот же, что и у `count_plain_impl`, но соседние элементы увеличивают
+                счётчики в разных копиях: `k`-й элемент каждой четвёрки — в `k`-й копии.
+                Если у многих элементов совпадают значения разряда (например, старшие байты
+                небольших чисел), то при обычном подсчёте каждое следующее увеличение счётчика
+                вынуждено дожидаться записи предыдущего. Чередование копий разрывает эту
+                зависимость, и процессор может увеличивать счётчики параллельно.
+                Нулевой копией служат сами счётчики `counters`, а остальные копии в конце
+                прибавляются к ним.
+
+            \see count_plain_impl
+        */
+        template <typename RandomAccessIterator1, typename Map, typename Radix, typename RandomAccessIterator2, std::size_t ... Radices>
+        bool count_interleaved_impl (RandomAccessIterator1 first, RandomAccessIterator1 last, Map map, Radix radix, RandomAccessIterator2 counters, std::index_sequence<Radices...>)
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using counter_type = std::decay_t<decltype(counters[0][0])>;
+            constexpr auto radix_count = sizeof...(Radices);
+            constexpr auto radix_value_range = radix_sort_traits<value_type, Map, Radix>::radix_value_range;
+            constexpr auto copy_count = interleaved_histogram_count;
+
+            auto copies = std::make_unique<counter_type[]>((copy_count - 1) * radix_count * radix_value_range);
+            const auto copy =
+                [& copies] (std::size_t copy_number, std::size_t radix_number)
+                {
+                    return copies.get() + ((copy_number - 1) * radix_count + radix_number) * radix_value_range;
+                };
+
+            auto previous = std::numeric_limits<invoke_result_t<Map, value_type>>::min();
+            auto is_sorted = true;
+            const auto count_one =
+                [& map, & radix, & previous, & is_sorted] (const auto & preimage, auto && increment)
+                {
+                    auto image = map(preimage);
+                    is_sorted &= (image >= previous);
+                    previous = image;
+
+                    BURST_EXPAND_VARIADIC(increment(Radices, nth_radix(Radices, radix)(image)));
+                };
+
+            const auto in_counters = [& counters] (std::size_t r, auto d) {++counters[r][d];};
+            const auto in_copy_1 = [& copy] (std::size_t r, auto d) {++copy(1, r)[d];};
+            const auto in_copy_2 = [& copy] (std::size_t r, auto d) {++copy(2, r)[d];};
+            const auto in_copy_3 = [& copy] (std::size_t r, auto d) {++copy(3, r)[d];};
+            static_assert(copy_count == 4, "");
+
+            while (last - first >= static_cast<std::ptrdiff_t>(copy_count))
+            {
+                count_one(*first, in_counters);
+                count_one(*(first + 1), in_copy_1);
+                count_one(*(first + 2), in_copy_2);
+                count_one(*(first + 3), in_copy_3);
+                first += static_cast<std::ptrdiff_t>(copy_count);
+            }
+            std::for_each(first, last, [& count_one, & in_counters] (const auto & preimage) {count_one(preimage, in_counters);});
+
+            for (std::size_t copy_number = 1; copy_number < copy_count; ++copy_number)
+            {
+                for (std::size_t radix_number = 0; radix_number < radix_count; ++radix_number)
+                {
+                    const auto copy_counters = copy(copy_number, radix_number);
+                    for (std::size_t value = 0; value < radix_value_range; ++value)
+                    {
+                        counters[radix_number][value] += copy_counters[value];
+                    }
+                }
+            }
+
+            return is_sorted;
+        }
+
+        template <typename RandomAccessIterator1, typename Map, typename Radix, typename RandomAccessIterator2, std::size_t ... Radices>
+        bool count_impl (RandomAccessIterator1 first, RandomAccessIterator1 last, Map map, Radix radix, RandomAccessIterator2 counters, std::index_sequence<Radices...> radices, std::true_type)
+        {
+            if (last - first >= interleaved_histogram_threshold)
+            {
+                return count_interleaved_impl(first, last, map, radix, counters, radices);
+            }
+            else
+            {
+                return count_plain_impl(first, last, map, radix, counters, radices);
+            }
+        }
+
+        template <typename ForwardIterator, typename Map, typename Radix, typename RandomAccessIterator, std::size_t ... Radices>
+        bool count_impl (ForwardIterator first, ForwardIterator last, Map map, Radix radix, RandomAccessIterator counters, std::index_sequence<Radices...> radices, std::false_type)
+        {
+            return count_plain_impl(first, last, map, radix, counters, radices);
+        }
+
+        /*!
+            \brief
+                Подсчёт значений сразу для всех разрядов с выбором стратегии
+
+            \details
+                На больших диапазонах с произвольным доступом и при разрядах не шире байта
+                счётчики собираются с чередованием копий (см. `count_interleaved_impl`), а в
+                остальных случаях — обычным образом (см. `count_plain_impl`). Более широкие
+                разряды не нуждаются в чередовании: их значения реже совпадают у соседних
+                элементов, а копии счётчиков не поместились бы в кэш.
+        */
+        template <typename ForwardIterator, typename Map, typename Radix, typename RandomAccessIterator, std::size_t ... Radices>
+        bool count_impl (ForwardIterator first, ForwardIterator last, Map map, Radix radix, RandomAccessIterator counters, std::index_sequence<Radices...> radices)
+        {
+            using value_type = iterator_value_t<ForwardIterator>;
+            constexpr auto radix_value_range = radix_sort_traits<value_type, Map, Radix>::radix_value_range;
+            using is_interleavable =
+                std::integral_constant
+                <
+                    bool,
+                    std::is_base_of
+                    <
+                        std::random_access_iterator_tag,
+                        iterator_category_t<ForwardIterator>
+                    >
+                    ::value &&
+                    radix_value_range <= 256
+                >;
+            return count_impl(first, last, map, radix, counters, radices, is_interleavable{});
+        }
+
         /*!
             \brief
                 Сбор счётчиков для поразрядной сортировки
@@ -51,17 +219,7 @@ namespace burst
             using value_type = iterator_value_t<ForwardIterator>;
             constexpr auto radix_value_range = radix_sort_traits<value_type, Map, Radix>::radix_value_range;
 
-            auto previous = std::numeric_limits<invoke_result_t<Map, value_type>>::min();
-            auto is_sorted = true;
-            std::for_each(first, last,
-                [& counters, & map, & radix, & previous, & is_sorted] (const auto & preimage)
-                {
-                    auto image = map(preimage);
-                    is_sorted &= (image >= previous);
-                    previous = image;
-
-                    BURST_EXPAND_VARIADIC(++counters[Radices][nth_radix(Radices, radix)(image)]);
-                });
+            const auto is_sorted = count_impl(first, last, map, radix, counters, std::index_sequence<Radices...>{});
 
             BURST_EXPAND_VARIADIC(maximums[Radices] = partial_sum_max(counters[Radices], counters[Radices] + radix_value_range, counters[Radices]).second);
 
@@ -86,7 +244,7 @@ namespace burst
                 Вызывает сортировку подсчётом из входного диапазона в буфер, а потом переносит
             результат из буфера обратно во входной диапазон.
          */
-        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Scatter = direct_scatter_fn>
         typename std::enable_if
         <
             radix_sort_traits
@@ -98,34 +256,68 @@ namespace burst
             ::radix_count == 1,
             void
         >
-        ::type radix_sort_impl (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, Map map, Radix radix)
+        ::type radix_sort_impl (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, Map map, Radix radix, Scatter scatter = Scatter{})
         {
             using counter_type = Counter;
             auto buffer_end =
                 counting_sort_impl<counter_type>(std::make_move_iterator(first), std::make_move_iterator(last), buffer,
-                    [& map, & radix] (const auto & value)
-                    {
-                        return radix(map(value));
-                    });
+                    compose(std::move(radix), std::move(map)), scatter);
 
             std::move(buffer, buffer_end, first);
         }
 
         /*!
             \brief
-                Би-итерация поразрядной сортировки
+                Счётчики для всех разрядов сортируемых чисел
+
+            \details
+                Двумерный массив `RadixCount x RadixValueRange`, заполненный нулями. Небольшие
+                массивы счётчиков размещаются на стеке, а большие (например, при 16-битных
+                разрядах) — в куче, чтобы не переполнить стек.
+                Метод `data` возвращает указатель на первую строку массива.
+         */
+        template
+        <
+            typename Counter,
+            std::size_t RadixCount,
+            std::size_t RadixValueRange,
+            bool OnStack = (sizeof(Counter) * RadixCount * RadixValueRange <= 64 * 1024)
+        >
+        struct radix_counters
+        {
+            auto data ()
+            {
+                return values;
+            }
+
+            Counter values[RadixCount][RadixValueRange] = {{0}};
+        };
+
+        template <typename Counter, std::size_t RadixCount, std::size_t RadixValueRange>
+        struct radix_counters<Counter, RadixCount, RadixValueRange, false>
+        {
+            auto data ()
+            {
+                return values.get();
+            }
+
+            std::unique_ptr<Counter[][RadixValueRange]> values =
+                std::make_unique<Counter[][RadixValueRange]>(RadixCount);
+        };
+
+        /*!
+            \brief
+                Одна итерация поразрядной сортировки
 
             \details
-                "Би-" означает, что обрабатываются два разряда: чётный и следующий за ним нечётный.
+                Элементы перекладываются из входного диапазона в буфер и обратно. Флаг
+                `sorted_in_buffer` показывает, где находится текущая последовательность.
 
-                Если каждый из разрядов содержит одинаковые значения (максимумы равны размеру
-                исходного диапазона), то это значит, что на результат сортировки эти разряды никак
-                не повлияют (например, и там, и там сплошные нули), следовательно, можно ничего не
-                делать.
-                Если хотя бы один из разрядов содержит разные значения, то тот разряд, который
-                содержит разные значения, должен быть распределён по общему правилу, а тот разряд,
-                который содержит одинаковые значения (если такой есть), может быть просто
-                скопирован.
+                Если значения разряда одинаковы у всех элементов (максимум равен размеру
+                исходного диапазона), то этот разряд не влияет на результат сортировки, поэтому
+                ничего не происходит, и последовательность остаётся там же, где и была.
+                Иначе последовательность распределяется по значению разряда в другую половину
+                (из входного диапазона в буфер или из буфера во входной диапазон).
 
             \see collect_impl
         */
@@ -136,10 +328,11 @@ namespace burst
             typename Map,
             typename Radix,
             typename RandomAccessIterator3,
-            typename RandomAccessIterator4
+            typename RandomAccessIterator4,
+            typename Scatter
         >
         void
-            radix_sort_impl_bi_iteration
+            radix_sort_iteration
             (
                 RandomAccessIterator1 first,
                 RandomAccessIterator1 last,
@@ -148,83 +341,141 @@ namespace burst
                 Radix radix,
                 RandomAccessIterator3 counters,
                 RandomAccessIterator4 maximums,
-                std::size_t radix_number
+                std::size_t radix_number,
+                bool & sorted_in_buffer,
+                Scatter scatter
             )
         {
             using std::distance;
             const auto range_size = distance(first, last);
-            const auto buffer_end = std::next(buffer_begin, range_size);
-
-            const auto nth_is_single = maximums[radix_number] == range_size;
-            const auto n1th_is_single = maximums[radix_number + 1] == range_size;
-
-            if (nth_is_single && n1th_is_single)
+            if (maximums[radix_number] == range_size)
             {
                 return;
             }
 
-            if (nth_is_single)
+            const auto buffer_end = std::next(buffer_begin, range_size);
+            const auto nth = compose(nth_radix(radix_number, radix), map);
+            if (sorted_in_buffer)
             {
-                std::move(first, last, buffer_begin);
+                dispose_backward(std::make_move_iterator(buffer_begin), std::make_move_iterator(buffer_end), first, nth, std::begin(counters[radix_number]), scatter);
             }
             else
             {
-                dispose_backward(std::make_move_iterator(first), std::make_move_iterator(last), buffer_begin, compose(nth_radix(radix_number, radix), map), std::begin(counters[radix_number]));
+                dispose_backward(std::make_move_iterator(first), std::make_move_iterator(last), buffer_begin, nth, std::begin(counters[radix_number]), scatter);
             }
+            sorted_in_buffer = not sorted_in_buffer;
+        }
+
+        /*!
+            \brief
+                Проходы поразрядной сортировки без переноса результата
+
+            \details
+                Собирает счётчики и распределяет элементы по всем разрядам, но не переносит
+                результат из буфера обратно во входной диапазон. Массив счётчиков
+                `RadixCount x RadixValueRange` выделяется вызывающей стороной и должен быть
+                заполнен нулями. Память, нужная стратегии распределения, выделяется один раз
+                на все проходы.
+
+            \returns
+                `true`, если упорядоченная последовательность оказалась в буфере, и `false`, если
+                она находится во входном диапазоне.
+
+            \see radix_sort_with_counters
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename RandomAccessIterator3, typename Scatter>
+        bool
+            radix_sort_passes
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer_begin,
+                Map map,
+                Radix radix,
+                RandomAccessIterator3 counters,
+                Scatter scatter
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
 
-            if (n1th_is_single)
+            using counter_type = std::decay_t<decltype(counters[0][0])>;
+            counter_type maximums[traits::radix_count] = {0};
+            auto sorted_in_buffer = false;
+            const auto is_sorted = collect(first, last, map, radix, counters, maximums);
+            if (not is_sorted)
             {
-                std::move(buffer_begin, buffer_end, first);
+                const auto buffers = scatter_buffers<value_type, traits::radix_value_range, Scatter>(scatter, 1);
+                for (std::size_t radix_number = 0; radix_number < traits::radix_count; ++radix_number)
+                {
+                    radix_sort_iteration(first, last, buffer_begin, map, radix, counters, maximums, radix_number, sorted_in_buffer, buffers.get());
+                }
             }
-            else
+
+            return sorted_in_buffer;
+        }
+
+        /*!
+            \brief
+                Поразрядная сортировка с внешними счётчиками
+
+            \details
+                То же, что и `radix_sort_impl`, но массив счётчиков `RadixCount x RadixValueRange`
+                выделяется вызывающей стороной и должен быть заполнен нулями. Это позволяет не
+                выделять счётчики заново при сортировке множества небольших диапазонов.
+
+            \see radix_sort_impl
+            \see segmented_radix_sort_impl
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename RandomAccessIterator3, typename Scatter>
+        void
+            radix_sort_with_counters
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer_begin,
+                Map map,
+                Radix radix,
+                RandomAccessIterator3 counters,
+                Scatter scatter
+            )
+        {
+            const auto sorted_in_buffer = radix_sort_passes(first, last, buffer_begin, map, radix, counters, scatter);
+            if (sorted_in_buffer)
             {
-                dispose_backward(std::make_move_iterator(buffer_begin), std::make_move_iterator(buffer_end), first, compose(nth_radix(radix_number + 1, radix), map), std::begin(counters[radix_number + 1]));
+                std::move(buffer_begin, std::next(buffer_begin, std::distance(first, last)), first);
             }
         }
 
-        //!     Специализация для случая, когда количество разрядов сортируемых чисел чётно.
+        //!     Специализация для случая, когда в сортируемом числе больше одного разряда.
         /*!
-                Других случаев не существует по построению. Либо разряд один, либо их количество
-            чётно.
-
-                Сортировка происходит между и входным диапазоном и буфером по следующей схеме:
-                Перед обработкой каждого чётного разряда (отсчёт от нуля) во входном диапазоне
-            лежит неотсортированная по этому разряду последовательность. Она сортируется, и
-            результат складывается в буфер.
-                Перед обработкой каждого нечётного разряда в буфере лежит неотсортированная
-            по этому разряду последовательность. Она сортируется, а результат складывается во
-            входной диапазон.
-                Таким образом, в итоге во входном диапазоне оказывается отсортированная
-            последовательность.
+                Сначала за один проход собираются счётчики для всех разрядов. Если входной
+            диапазон уже упорядочен, то на этом сортировка заканчивается.
+                Иначе разряды обрабатываются от младшего к старшему: каждый разряд, значения
+            которого различны, распределяется из той половины (входной диапазон или буфер), где
+            сейчас лежит последовательность, в другую.
+                Если по окончании распределений последовательность оказалась в буфере (например,
+            при нечётном количестве разрядов), то она переносится обратно во входной диапазон.
          */
-        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Scatter = direct_scatter_fn>
         typename std::enable_if
         <
-            radix_sort_traits
+            (radix_sort_traits
             <
                 iterator_value_t<RandomAccessIterator1>,
                 Map,
                 Radix
             >
-            ::radix_count % 2 == 0,
+            ::radix_count > 1),
             void
         >
-        ::type radix_sort_impl (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer_begin, Map map, Radix radix)
+        ::type radix_sort_impl (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer_begin, Map map, Radix radix, Scatter scatter = Scatter{})
         {
             using value_type = iterator_value_t<RandomAccessIterator1>;
             using traits = radix_sort_traits<value_type, Map, Radix>;
 
-            using counter_type = Counter;
-            counter_type counters[traits::radix_count][traits::radix_value_range] = {{0}};
-            counter_type maximums[traits::radix_count] = {0};
-            const auto is_sorted = collect(first, last, map, radix, counters, maximums);
-            if (not is_sorted)
-            {
-                for (std::size_t radix_number = 0; radix_number < traits::radix_count; radix_number += 2)
-                {
-                    radix_sort_impl_bi_iteration(first, last, buffer_begin, map, radix, counters, maximums, radix_number);
-                }
-            }
+            radix_counters<Counter, traits::radix_count, traits::radix_value_range> counters;
+            radix_sort_with_counters(first, last, buffer_begin, map, radix, counters.data(), scatter);
         }
     } // namespace detail
 } // namespace burst
@@ -0,0 +1,189 @@
+#ifndef BURST__ALGORITHM__DETAIL__RADIX_SORT_INPLACE_HPP
+#define BURST__ALGORITHM__DETAIL__RADIX_SORT_INPLACE_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/detail/nth_radix.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/algorithm/partial_sum_max.hpp>
+#include <burst/container/shaped_array_view.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер диапазона, который сортируется сравнениями, а не поразрядно.
+        constexpr auto radix_sort_inplace_small_range_size = 64;
+
+        //!     Сортировка короткого диапазона по образам элементов.
+        template <typename RandomAccessIterator, typename Map>
+        void small_range_sort (RandomAccessIterator first, RandomAccessIterator last, Map map)
+        {
+            std::sort(first, last,
+                [& map] (const auto & left, const auto & right)
+                {
+                    return map(left) < map(right);
+                });
+        }
+
+        /*!
+            \brief
+                Распределение по корзинам на месте
+
+            \details
+                Переставляет элементы диапазона, начинающегося с `first`, так, что все элементы с
+                одинаковым значением `map` оказываются в одной корзине, а корзины идут в порядке
+                возрастания этого значения (американский флаг).
+
+                Элементы переставляются циклами: элемент, стоящий не в своей корзине, меняется
+                местами с первым нераспределённым элементом той корзины, куда он должен попасть,
+                и так до тех пор, пока на освободившееся место не придёт подходящий элемент.
+
+            \param heads
+                Для каждой корзины `i` содержит индекс первого нераспределённого элемента этой
+                корзины. Изначально это индекс начала корзины, после распределения — индекс её
+                конца.
+            \param ends
+                Индексы концов корзин.
+            \param value_range
+                Количество корзин.
+         */
+        template
+        <
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2,
+            typename RandomAccessIterator3
+        >
+        void
+            dispose_inplace
+            (
+                RandomAccessIterator1 first,
+                Map map,
+                RandomAccessIterator2 heads,
+                RandomAccessIterator3 ends,
+                std::size_t value_range
+            )
+        {
+            for (auto bucket = 0ul; bucket < value_range; ++bucket)
+            {
+                while (heads[bucket] != ends[bucket])
+                {
+                    auto & slot = first[heads[bucket]];
+                    auto digit = static_cast<std::size_t>(map(slot));
+                    if (digit != bucket)
+                    {
+                        auto value = std::move(slot);
+                        do
+                        {
+                            using std::swap;
+                            swap(value, first[heads[digit]++]);
+                            digit = static_cast<std::size_t>(map(value));
+                        }
+                        while (digit != bucket);
+                        slot = std::move(value);
+                    }
+                    ++heads[bucket];
+                }
+            }
+        }
+
+        /*!
+            \brief
+                Поразрядная сортировка на месте, начиная со старшего разряда
+
+            \details
+                Распределяет элементы по корзинам в соответствии со значением разряда
+                `radix_number`, а затем рекурсивно сортирует каждую корзину по следующему
+                (младшему) разряду.
+                Если все элементы имеют одно и то же значение текущего разряда, то распределение
+                пропускается. Короткие корзины сортируются сравнениями.
+
+            \param counters
+                Двумерный массив счётчиков размера `(radix_count + 1) x radix_value_range`.
+                Строка с номером `r` хранит концы корзин при распределении по разряду `r`, а
+                последняя строка используется как рабочая для всех разрядов.
+         */
+        template <typename RandomAccessIterator, typename Map, typename Radix, typename Counters>
+        void
+            american_flag_sort
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Map map,
+                Radix radix,
+                std::size_t radix_number,
+                Counters counters
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+
+            using std::distance;
+            const auto range_size = distance(first, last);
+            if (range_size <= radix_sort_inplace_small_range_size)
+            {
+                small_range_sort(first, last, map);
+                return;
+            }
+
+            const auto ends = counters[radix_number];
+            const auto heads = counters[traits::radix_count];
+            const auto nth = compose(nth_radix(radix_number, radix), map);
+
+            std::fill(ends, ends + traits::radix_value_range, 0);
+            count(first, last, nth, ends);
+            const auto maximum = partial_sum_max(ends, ends + traits::radix_value_range, ends).second;
+
+            if (maximum == range_size)
+            {
+                if (radix_number > 0)
+                {
+                    american_flag_sort(first, last, map, radix, radix_number - 1, counters);
+                }
+                return;
+            }
+
+            heads[0] = 0;
+            std::copy(ends, ends + traits::radix_value_range - 1, heads + 1);
+            dispose_inplace(first, nth, heads, ends, traits::radix_value_range);
+
+            if (radix_number > 0)
+            {
+                auto bucket_begin = iterator_difference_t<RandomAccessIterator>{0};
+                for (auto bucket = 0ul; bucket < traits::radix_value_range; ++bucket)
+                {
+                    const auto bucket_end = ends[bucket];
+                    if (bucket_end - bucket_begin > 1)
+                    {
+                        american_flag_sort(first + bucket_begin, first + bucket_end, map, radix, radix_number - 1, counters);
+                    }
+                    bucket_begin = bucket_end;
+                }
+            }
+        }
+
+        template <typename RandomAccessIterator, typename Map, typename Radix>
+        void radix_sort_inplace_impl (RandomAccessIterator first, RandomAccessIterator last, Map map, Radix radix)
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            auto counters = std::make_unique<difference_type[]>((traits::radix_count + 1) * traits::radix_value_range);
+            auto counters_view = make_shaped_array_view(counters.get(), make_shape(traits::radix_count + 1, traits::radix_value_range));
+
+            american_flag_sort(first, last, map, radix, traits::radix_count - 1, counters_view);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__RADIX_SORT_INPLACE_HPP
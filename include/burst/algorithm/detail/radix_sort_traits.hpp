@@ -1,12 +1,12 @@
 #ifndef BURST__ALGORITHM__DETAIL__RADIX_SORT_TRAITS_HPP
 #define BURST__ALGORITHM__DETAIL__RADIX_SORT_TRAITS_HPP
 
-#include <burst/integer/intlog2.hpp>
+#include <burst/algorithm/detail/image_bit_count.hpp>
+#include <burst/integer/divceil.hpp>
 #include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/is_integer.hpp>
 
-#include <climits>
-#include <cstdint>
-#include <limits>
+#include <cstddef>
 #include <type_traits>
 
 namespace burst
@@ -19,20 +19,23 @@ namespace burst
             using integer_type = std::decay_t<invoke_result_t<Map, Value>>;
             static_assert
             (
-                std::is_integral<integer_type>::value && std::is_unsigned<integer_type>::value,
+                is_unsigned_integer<integer_type>::value,
                 "Сортируемые элементы должны быть отображены в целые беззнаковые числа."
             );
 
             using radix_type = std::decay_t<invoke_result_t<Radix, integer_type>>;
             static_assert
             (
-                std::is_integral<radix_type>::value,
+                is_integer<radix_type>::value,
                 "Тип разряда, выделяемого из целого числа, тоже должен быть целым."
             );
 
-            constexpr static auto radix_value_range = std::numeric_limits<radix_type>::max() + 1;
-            constexpr static auto radix_size = intlog2<std::uint64_t>(radix_value_range);
-            constexpr static auto radix_count = sizeof(integer_type) * CHAR_BIT / radix_size;
+            constexpr static auto radix_size = image_bit_count<Radix, integer_type>::value;
+            constexpr static auto radix_value_range = std::size_t{1} << radix_size;
+            //!     Количество значащих битов в числе (см. `image_bit_count`).
+            constexpr static auto integer_size = image_bit_count<Map, Value>::value;
+            //!     Старший разряд может оказаться неполным, если ширина разряда не делит ширину числа.
+            constexpr static auto radix_count = divceil(integer_size, radix_size);
         };
     } // namespace detail
 } // namespace burst
@@ -0,0 +1,262 @@
+#ifndef BURST__ALGORITHM__DETAIL__RADIX_SORT_UNIQUE_HPP
+#define BURST__ALGORITHM__DETAIL__RADIX_SORT_UNIQUE_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Перебор групп подряд идущих элементов с равными образами
+
+            \details
+                Для каждой группы `[run_first, run_last)` вызывает `f(run_first, run_last)`.
+                Отображение `map` вычисляется ровно один раз для каждого элемента.
+         */
+        template <typename ForwardIterator, typename Map, typename BinaryFunction>
+        void for_each_run (ForwardIterator first, ForwardIterator last, Map & map, BinaryFunction f)
+        {
+            while (first != last)
+            {
+                const auto image = map(*first);
+                auto run_last = std::next(first);
+                while (run_last != last && map(*run_last) == image)
+                {
+                    ++run_last;
+                }
+
+                f(first, run_last);
+                first = run_last;
+            }
+        }
+
+        /*!
+            \brief
+                Завершение сортировки удалением повторов
+
+            \details
+                Из каждой группы элементов с равными образами во входном диапазоне остаётся
+                только первый элемент.
+                Если упорядоченная последовательность находится в буфере, то удаление повторов
+                совмещено с её переносом во входной диапазон, и отдельного прохода не требуется.
+
+            \returns
+                Итератор на конец диапазона неповторяющихся элементов.
+         */
+        template <typename RandomAccessIterator, typename Map>
+        struct unique_finish
+        {
+            RandomAccessIterator in_place (RandomAccessIterator sorted_first, RandomAccessIterator sorted_last)
+            {
+                auto result = first;
+                for_each_run(sorted_first, sorted_last, map,
+                    [& result] (auto run_first, auto)
+                    {
+                        if (result != run_first)
+                        {
+                            *result = std::move(*run_first);
+                        }
+                        ++result;
+                    });
+
+                return result;
+            }
+
+            template <typename RandomAccessIterator2>
+            RandomAccessIterator from_buffer (RandomAccessIterator2 buffer_first, RandomAccessIterator2 buffer_last)
+            {
+                auto result = first;
+                for_each_run(buffer_first, buffer_last, map,
+                    [& result] (auto run_first, auto)
+                    {
+                        *result = std::move(*run_first);
+                        ++result;
+                    });
+
+                return result;
+            }
+
+            RandomAccessIterator first;
+            Map map;
+        };
+
+        /*!
+            \brief
+                Завершение сортировки подсчётом повторов
+
+            \details
+                Упорядоченная последовательность остаётся во входном диапазоне, а для каждой
+                группы элементов с равными образами в выходной итератор записывается пара из
+                первого элемента группы и размера группы.
+                Если упорядоченная последовательность находится в буфере, то подсчёт совмещён с
+                её переносом во входной диапазон.
+
+            \returns
+                Итератор за последней записанной парой.
+         */
+        template <typename RandomAccessIterator, typename OutputIterator, typename Map>
+        struct count_finish
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            OutputIterator in_place (RandomAccessIterator sorted_first, RandomAccessIterator sorted_last)
+            {
+                auto output = result;
+                for_each_run(sorted_first, sorted_last, map,
+                    [& output] (auto run_first, auto run_last)
+                    {
+                        *output = std::pair<value_type, difference_type>(*run_first, std::distance(run_first, run_last));
+                        ++output;
+                    });
+
+                return output;
+            }
+
+            template <typename RandomAccessIterator2>
+            OutputIterator from_buffer (RandomAccessIterator2 buffer_first, RandomAccessIterator2 buffer_last)
+            {
+                auto output = result;
+                auto destination = first;
+                for_each_run(buffer_first, buffer_last, map,
+                    [& output, & destination] (auto run_first, auto run_last)
+                    {
+                        const auto run_destination = destination;
+                        destination = std::move(run_first, run_last, destination);
+
+                        const auto run_size = static_cast<difference_type>(std::distance(run_first, run_last));
+                        *output = std::pair<value_type, difference_type>(*run_destination, run_size);
+                        ++output;
+                    });
+
+                return output;
+            }
+
+            RandomAccessIterator first;
+            OutputIterator result;
+            Map map;
+        };
+
+        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Finish>
+        auto
+            radix_sort_and_finish_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                Finish finish,
+                std::true_type
+            )
+        {
+            const auto buffer_end =
+                counting_sort_impl<Counter>(std::make_move_iterator(first), std::make_move_iterator(last), buffer,
+                    compose(std::move(radix), std::move(map)), direct_scatter);
+
+            return finish.from_buffer(buffer, buffer_end);
+        }
+
+        template <typename Counter, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Finish>
+        auto
+            radix_sort_and_finish_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                Finish finish,
+                std::false_type
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+
+            radix_counters<Counter, traits::radix_count, traits::radix_value_range> counters;
+            const auto sorted_in_buffer = radix_sort_passes(first, last, buffer, map, radix, counters.data(), direct_scatter);
+            if (sorted_in_buffer)
+            {
+                return finish.from_buffer(buffer, std::next(buffer, std::distance(first, last)));
+            }
+            else
+            {
+                return finish.in_place(first, last);
+            }
+        }
+
+        /*!
+            \brief
+                Поразрядная сортировка с завершающим проходом
+
+            \details
+                Сортирует диапазон, но не переносит результат из буфера во входной диапазон, а
+                передаёт упорядоченную последовательность завершающей функции `finish`:
+                `finish.from_buffer(buffer_first, buffer_last)`, если последовательность
+                оказалась в буфере, и `finish.in_place(first, last)`, если во входном диапазоне.
+                Так завершающая обработка (например, удаление повторов) совмещается с переносом
+                из буфера.
+
+                Если в образе всего один разряд, то сортировка подсчётом всегда складывает
+                результат в буфер.
+
+            \returns
+                Результат завершающей функции.
+
+            \see unique_finish
+            \see count_finish
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix, typename Finish>
+        auto
+            radix_sort_and_finish
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                Finish finish
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using traits = radix_sort_traits<value_type, Map, Radix>;
+            using is_single_radix = std::integral_constant<bool, traits::radix_count == 1>;
+
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            using min_type =
+                typename std::conditional
+                <
+                    sizeof(std::int32_t) < sizeof(difference_type),
+                    std::int32_t,
+                    difference_type
+                >
+                ::type;
+
+            using std::distance;
+            if (distance(first, last) <= std::numeric_limits<min_type>::max())
+            {
+                return radix_sort_and_finish_impl<min_type>(first, last, buffer, std::move(map), radix, std::move(finish), is_single_radix{});
+            }
+            else
+            {
+                return radix_sort_and_finish_impl<difference_type>(first, last, buffer, std::move(map), radix, std::move(finish), is_single_radix{});
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__RADIX_SORT_UNIQUE_HPP
@@ -0,0 +1,71 @@
+#ifndef BURST__ALGORITHM__DETAIL__RESERVE_OUTPUT_HPP
+#define BURST__ALGORITHM__DETAIL__RESERVE_OUTPUT_HPP
+
+#include <burst/type_traits/void_t.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename Container, typename = void>
+        struct has_reserve: std::false_type {};
+
+        template <typename Container>
+        struct has_reserve
+            <
+                Container,
+                void_t<decltype(std::declval<Container &>().reserve(std::declval<Container &>().size()))>
+            >:
+            std::true_type {};
+
+        //!     Доступ к контейнеру, в который вставляет `std::back_insert_iterator`.
+        template <typename Container>
+        struct back_insert_container: std::back_insert_iterator<Container>
+        {
+            static Container & get (const std::back_insert_iterator<Container> & iterator)
+            {
+                return *(iterator.*&back_insert_container::container);
+            }
+        };
+
+        template <typename Container, typename Size>
+        void reserve_output_impl (std::back_insert_iterator<Container> & result, Size size, std::true_type)
+        {
+            auto & container = back_insert_container<Container>::get(result);
+            container.reserve(container.size() + static_cast<typename Container::size_type>(size()));
+        }
+
+        template <typename Container, typename Size>
+        void reserve_output_impl (std::back_insert_iterator<Container> &, Size, std::false_type)
+        {
+        }
+
+        /*!
+            \brief
+                Зарезервировать место в контейнере, в который вставляет выходной итератор
+
+            \details
+                Если `result` — это `std::back_insert_iterator` контейнера, у которого есть
+                функция `reserve`, то в контейнере резервируется место ещё под `size()`
+                элементов. Размер вычисляется только в этом случае, потому что вычислить его
+                может быть дорого.
+         */
+        template <typename Container, typename Size>
+        void reserve_output (std::back_insert_iterator<Container> & result, Size size)
+        {
+            reserve_output_impl(result, std::move(size), has_reserve<Container>{});
+        }
+
+        template <typename OutputIterator, typename Size>
+        void reserve_output (OutputIterator &, Size)
+        {
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__RESERVE_OUTPUT_HPP
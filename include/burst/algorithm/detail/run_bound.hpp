@@ -0,0 +1,72 @@
+#ifndef BURST__ALGORITHM__DETAIL__RUN_BOUND_HPP
+#define BURST__ALGORITHM__DETAIL__RUN_BOUND_HPP
+
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/functional/non_strict.hpp>
+#include <burst/type_traits/iterator_category.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessIterator, typename Value, typename Compare>
+        RandomAccessIterator
+            run_lower_bound_impl
+            (
+                RandomAccessIterator first, RandomAccessIterator last,
+                const Value & value,
+                Compare compare,
+                std::random_access_iterator_tag
+            )
+        {
+            return galloping_search(std::next(first), last, value, compare);
+        }
+
+        template <typename ForwardIterator, typename Value, typename Compare>
+        ForwardIterator
+            run_lower_bound_impl
+            (
+                ForwardIterator first, ForwardIterator last,
+                const Value & value,
+                Compare compare,
+                std::forward_iterator_tag
+            )
+        {
+            return
+                std::find_if_not(std::next(first), last,
+                    [& value, & compare] (const auto & x) {return compare(x, value);});
+        }
+
+        /*!
+            \brief
+                Конец серии элементов, меньших `value`
+
+            \details
+                Серия обычно начинается в начале диапазона и коротка по сравнению с ним, поэтому
+                в диапазоне произвольного доступа её конец ищется скачущим поиском, а в остальных —
+                поэлементно.
+
+            \pre
+                Диапазон `[first, last)` непуст, и его первый элемент меньше `value`, то есть серия
+                содержит по меньшей мере один элемент. Поэтому поиск начинается со второго
+                элемента.
+         */
+        template <typename ForwardIterator, typename Value, typename Compare>
+        ForwardIterator run_lower_bound (ForwardIterator first, ForwardIterator last, const Value & value, Compare compare)
+        {
+            return run_lower_bound_impl(first, last, value, compare, iterator_category_t<ForwardIterator>{});
+        }
+
+        //!     Конец серии элементов, не больших `value`. Первый элемент не больше `value`.
+        template <typename ForwardIterator, typename Value, typename Compare>
+        ForwardIterator run_upper_bound (ForwardIterator first, ForwardIterator last, const Value & value, Compare compare)
+        {
+            return run_lower_bound(first, last, value, non_strict(compare));
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__RUN_BOUND_HPP
@@ -0,0 +1,323 @@
+#ifndef BURST__ALGORITHM__DETAIL__SAMPLE_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__SAMPLE_SORT_HPP
+
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/integer/intlog2.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер диапазона, начиная с которого сортировка выборкой выгоднее `std::sort`.
+        constexpr auto sample_sort_threshold = std::size_t{1} << 12;
+
+        //!     Желаемый размер корзины.
+        constexpr auto sample_sort_bucket_size = std::size_t{1} << 10;
+
+        //!     Наибольшее количество уровней дерева разделителей.
+        /*!
+                Номер корзины должен помещаться в байт. Вместе с корзинами равенства (см.
+            `splitter_tree`) корзин получается `2 * 2^L - 1`, поэтому уровней не больше семи.
+         */
+        constexpr auto sample_sort_max_level_count = std::size_t{7};
+
+        //!     Во сколько раз выборка больше количества корзин.
+        constexpr auto sample_sort_oversampling = std::size_t{16};
+
+        using sample_sort_bucket_type = std::uint8_t;
+
+        /*!
+            \brief
+                Количество уровней дерева разделителей
+
+            \details
+                Корзин должно быть столько, чтобы средняя корзина имела размер порядка
+                `sample_sort_bucket_size`. При параллельной сортировке корзин должно быть ещё и
+                хотя бы вчетверо больше, чем потоков, чтобы потоки, которые сортируют корзины,
+                были загружены равномерно.
+         */
+        inline std::size_t sample_sort_level_count (std::size_t range_size, std::size_t thread_count)
+        {
+            const auto desired_bucket_count = std::max(range_size / sample_sort_bucket_size, thread_count * 4);
+            return std::min(std::max(intlog2(std::max(desired_bucket_count, std::size_t{2})), std::size_t{1}),
+                sample_sort_max_level_count);
+        }
+
+        /*!
+            \brief
+                Дерево разделителей
+
+            \details
+                Хранит `2^L - 1` разделителей в виде неявного сбалансированного двоичного дерева
+                поиска: корень лежит на первой позиции, а потомки `i`-го узла — на позициях
+                `2i` и `2i + 1` (нумерация с единицы). Такое расположение позволяет определять
+                корзину элемента без ветвлений: на каждом уровне к номеру узла дописывается
+                результат сравнения элемента с разделителем, и через `L` шагов номер узла
+                превращается в номер корзины.
+
+                Элементы, равные разделителю, попадают в корзину слева от него. Если среди
+                разделителей есть равные, то во входных данных много повторов, и все они попали
+                бы в одну корзину. Тогда у каждого разделителя заводится своя корзина равенства:
+                корзина `b` превращается в пару корзин `2b` и `2b + 1`, и во вторую из них
+                попадают элементы, равные `b`-му разделителю. Корзины равенства сортировать не
+                нужно.
+         */
+        template <typename Value, typename Compare>
+        struct splitter_tree
+        {
+            std::size_t bucket_index (const Value & value) const
+            {
+                auto node = std::size_t{1};
+                for (auto level = std::size_t{0}; level < level_count; ++level)
+                {
+                    node = 2 * node + static_cast<std::size_t>(compare(nodes[node - 1], value));
+                }
+                const auto bucket = node - (std::size_t{1} << level_count);
+                if (not equality_buckets)
+                {
+                    return bucket;
+                }
+                else
+                {
+                    const auto is_equal = bucket < splitters.size() && not compare(value, splitters[bucket]);
+                    return 2 * bucket + static_cast<std::size_t>(is_equal);
+                }
+            }
+
+            std::size_t bucket_count () const
+            {
+                const auto leaf_count = std::size_t{1} << level_count;
+                return equality_buckets ? 2 * leaf_count - 1 : leaf_count;
+            }
+
+            //!     Все элементы корзины равны между собой, и её не нужно сортировать.
+            bool is_equality_bucket (std::size_t bucket) const
+            {
+                return equality_buckets && bucket % 2 == 1;
+            }
+
+            std::vector<Value> nodes;
+            std::vector<Value> splitters;
+            std::size_t level_count;
+            bool equality_buckets;
+            Compare compare;
+        };
+
+        /*!
+            \brief
+                Построение дерева разделителей по случайной выборке
+
+            \details
+                Из диапазона выбирается `sample_sort_oversampling * 2^L` случайных элементов.
+                Выборка сортируется, и из неё равномерно берутся `2^L - 1` разделителей, которые
+                затем раскладываются по узлам дерева уровень за уровнем. Если соседние
+                разделители равны, то включаются корзины равенства.
+                Разделители копируются, поэтому элементы должны быть копируемыми.
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        auto
+            make_splitter_tree
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                std::size_t level_count,
+                Compare compare
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator>;
+            using difference_type = iterator_difference_t<RandomAccessIterator>;
+
+            const auto bucket_count = std::size_t{1} << level_count;
+            const auto sample_size = bucket_count * sample_sort_oversampling;
+
+            using std::distance;
+            auto generator = std::minstd_rand{};
+            auto position = std::uniform_int_distribution<difference_type>(0, distance(first, last) - 1);
+
+            auto sample = std::vector<value_type>{};
+            sample.reserve(sample_size);
+            std::generate_n(std::back_inserter(sample), sample_size,
+                [& first, & generator, & position] {return first[position(generator)];});
+            std::sort(sample.begin(), sample.end(), compare);
+
+            auto splitters = std::vector<value_type>{};
+            splitters.reserve(bucket_count - 1);
+            for (auto splitter = std::size_t{1}; splitter < bucket_count; ++splitter)
+            {
+                splitters.push_back(sample[splitter * sample_sort_oversampling - 1]);
+            }
+            const auto equality_buckets =
+                std::adjacent_find(splitters.begin(), splitters.end(),
+                    [& compare] (const auto & left, const auto & right) {return not compare(left, right);})
+                != splitters.end();
+
+            auto nodes = std::vector<value_type>{};
+            nodes.reserve(bucket_count - 1);
+            for (auto level = std::size_t{0}; level < level_count; ++level)
+            {
+                const auto level_width = std::size_t{1} << level;
+                for (auto node = std::size_t{0}; node < level_width; ++node)
+                {
+                    const auto splitter = (2 * node + 1) * bucket_count / (2 * level_width);
+                    nodes.push_back(splitters[splitter - 1]);
+                }
+            }
+
+            return
+                splitter_tree<value_type, Compare>
+                {
+                    std::move(nodes),
+                    std::move(splitters),
+                    level_count,
+                    equality_buckets,
+                    std::move(compare)
+                };
+        }
+
+        /*!
+            \brief
+                Определить корзины элементов и подсчитать размеры корзин
+
+            \details
+                Номера корзин запоминаются, а размеры корзин подсчитываются по ним функцией
+                `count` из сортировки подсчётом.
+         */
+        template <typename RandomAccessIterator, typename Tree, typename BucketIterator, typename CounterIterator>
+        void
+            classify
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                const Tree & tree,
+                BucketIterator buckets,
+                CounterIterator counters
+            )
+        {
+            const auto buckets_end =
+                std::transform(first, last, buckets,
+                    [& tree] (const auto & value)
+                    {
+                        return static_cast<sample_sort_bucket_type>(tree.bucket_index(value));
+                    });
+            count(buckets, buckets_end, [] (sample_sort_bucket_type bucket) {return bucket;}, counters);
+        }
+
+        /*!
+            \brief
+                Распределить элементы по корзинам при проходе в обратном порядке
+
+            \details
+                Счётчик `counters[i]` указывает на позицию за последним ещё не занятым местом
+                корзины `i` в выходном диапазоне, как в `dispose_backward`. Отличие в том, что
+                номер корзины не вычисляется по элементу, а берётся из запомненных номеров по
+                позиции элемента, которую отображение в `dispose_backward` не видит.
+         */
+        template
+        <
+            typename RandomAccessIterator1,
+            typename BucketIterator,
+            typename RandomAccessIterator2,
+            typename CounterIterator
+        >
+        void
+            scatter_backward
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                BucketIterator buckets,
+                RandomAccessIterator2 result,
+                CounterIterator counters
+            )
+        {
+            using std::distance;
+            auto bucket = std::next(buckets, distance(first, last));
+            while (last != first)
+            {
+                --last;
+                --bucket;
+                result[--counters[*bucket]] = std::move(*last);
+            }
+        }
+
+        /*!
+            \brief
+                Отсортировать корзину в буфере и перенести её на место в исходном диапазоне
+
+            \details
+                Корзина равенства только переносится.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Tree>
+        void
+            sort_bucket
+            (
+                const Tree & tree,
+                std::size_t bucket,
+                RandomAccessIterator1 bucket_first,
+                RandomAccessIterator1 bucket_last,
+                RandomAccessIterator2 result
+            )
+        {
+            if (not tree.is_equality_bucket(bucket))
+            {
+                std::sort(bucket_first, bucket_last, tree.compare);
+            }
+            std::move(bucket_first, bucket_last, result);
+        }
+
+        /*!
+            \brief
+                Сортировка выборкой
+
+            \details
+                1.  По случайной выборке строится дерево разделителей.
+                2.  Для каждого элемента определяется номер корзины. Номера запоминаются, поэтому
+                    каждый элемент сравнивается с разделителями только один раз.
+                3.  Размеры корзин превращаются в границы, и элементы распределяются в буфер.
+                4.  Каждая корзина, кроме корзин равенства, сортируется и переносится обратно в
+                    исходный диапазон.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+        void
+            sample_sort_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Compare compare
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            using std::distance;
+            const auto range_size = static_cast<std::size_t>(distance(first, last));
+            const auto tree = make_splitter_tree(first, last, sample_sort_level_count(range_size, 1), compare);
+            const auto bucket_count = tree.bucket_count();
+
+            auto buckets = std::vector<sample_sort_bucket_type>(range_size);
+            auto counters = std::vector<difference_type>(bucket_count + 1, 0);
+            classify(first, last, tree, buckets.data(), counters.data());
+            std::partial_sum(counters.begin(), counters.end(), counters.begin());
+
+            scatter_backward(first, last, buckets.data(), buffer, counters.data());
+
+            for (auto bucket = std::size_t{0}; bucket < bucket_count; ++bucket)
+            {
+                sort_bucket(tree, bucket, buffer + counters[bucket], buffer + counters[bucket + 1], first + counters[bucket]);
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__SAMPLE_SORT_HPP
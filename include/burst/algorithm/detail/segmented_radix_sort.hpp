@@ -0,0 +1,142 @@
+#ifndef BURST__ALGORITHM__DETAIL__SEGMENTED_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__SEGMENTED_RADIX_SORT_HPP
+
+#include <burst/algorithm/detail/binary_insertion_sort.hpp>
+#include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/algorithm/detail/radix_sort_traits.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер отрезка, который упорядочивается вставками, а не поразрядно.
+        constexpr auto segmented_radix_sort_small_size = std::ptrdiff_t{64};
+
+        //!     Сравнение элементов по их образам, согласованное с поразрядной сортировкой.
+        template <typename Map>
+        struct image_less_fn
+        {
+            template <typename Value>
+            bool operator () (const Value & left, const Value & right) const
+            {
+                return map(left) < map(right);
+            }
+
+            Map map;
+        };
+
+        /*!
+            \brief
+                Сортировщик отрезков с общими счётчиками
+
+            \details
+                Счётчики выделяются один раз на все отрезки и обнуляются перед сортировкой
+                каждого отрезка, который достаточно велик для поразрядной сортировки. Короткие
+                отрезки упорядочиваются устойчивой сортировкой вставками, потому что для них
+                обработка счётчиков обходится дороже самой сортировки.
+         */
+        template <typename Counter, typename Value, typename Map, typename Radix>
+        struct segment_sorter
+        {
+            using traits = radix_sort_traits<Value, Map, Radix>;
+
+            segment_sorter (Map map, Radix radix):
+                map(std::move(map)),
+                radix(std::move(radix))
+            {
+            }
+
+            template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+            void operator () (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer)
+            {
+                using std::distance;
+                if (distance(first, last) < segmented_radix_sort_small_size)
+                {
+                    binary_insertion_sort(first, last, image_less_fn<Map>{map});
+                }
+                else
+                {
+                    sort_large(first, last, buffer, std::integral_constant<bool, (traits::radix_count > 1)>{});
+                }
+            }
+
+            template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+            void sort_large (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, std::true_type)
+            {
+                const auto rows = counters.data();
+                std::for_each(rows, rows + traits::radix_count,
+                    [] (auto & row)
+                    {
+                        std::fill(std::begin(row), std::end(row), Counter{0});
+                    });
+                radix_sort_with_counters(first, last, buffer, map, radix, rows, direct_scatter);
+            }
+
+            //!     Для однобайтовых ключей сортировка подсчётом обходится небольшим массивом счётчиков.
+            template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+            void sort_large (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, std::false_type)
+            {
+                radix_sort_impl<Counter>(first, last, buffer, map, radix);
+            }
+
+            Map map;
+            Radix radix;
+            radix_counters<Counter, traits::radix_count, traits::radix_value_range> counters;
+        };
+
+        /*!
+            \brief
+                Сортировка отрезков, заданных границами
+
+            \details
+                Отрезок с номером `i` — это `[first + offsets[i], first + offsets[i + 1])`.
+                Каждый отрезок сортируется независимо от остальных, и все они используют начало
+                буфера: так буфер остаётся в кэше, а не прочитывается целиком.
+
+            \see segment_sorter
+         */
+        template <typename Counter, typename RandomAccessIterator1, typename ForwardIterator, typename RandomAccessIterator2, typename Map, typename Radix>
+        void
+            segmented_radix_sort_impl
+            (
+                RandomAccessIterator1 first,
+                ForwardIterator offsets_first,
+                ForwardIterator offsets_last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            if (offsets_first == offsets_last)
+            {
+                return;
+            }
+
+            // Счётчики могут занимать десятки килобайт, поэтому сортировщик размещается в куче.
+            auto sort_segment = std::make_unique<segment_sorter<Counter, value_type, Map, Radix>>(std::move(map), std::move(radix));
+
+            auto segment_begin = static_cast<difference_type>(*offsets_first);
+            for (auto offset = std::next(offsets_first); offset != offsets_last; ++offset)
+            {
+                const auto segment_end = static_cast<difference_type>(*offset);
+                (*sort_segment)(std::next(first, segment_begin), std::next(first, segment_end), buffer);
+                segment_begin = segment_end;
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__SEGMENTED_RADIX_SORT_HPP
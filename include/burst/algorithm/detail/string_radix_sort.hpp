@@ -0,0 +1,195 @@
+#ifndef BURST__ALGORITHM__DETAIL__STRING_RADIX_SORT_HPP
+#define BURST__ALGORITHM__DETAIL__STRING_RADIX_SORT_HPP
+
+#include <burst/algorithm/detail/binary_insertion_sort.hpp>
+#include <burst/algorithm/detail/counting_sort.hpp>
+#include <burst/algorithm/partial_sum_max.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Количество значений символа: 256 значений байта и признак конца строки.
+        constexpr auto string_radix_value_range = std::size_t{257};
+
+        //!     Размер диапазона, который упорядочивается сравнениями, а не поразрядно.
+        constexpr auto string_radix_small_range_size = 32;
+
+        /*!
+            \brief
+                Символ строки на заданной глубине
+
+            \details
+                Возвращает `0`, если строка, полученная отображением `map`, закончилась раньше
+                позиции `depth`, и `1 + b`, где `b` — беззнаковое значение байта на этой позиции,
+                в противном случае. Таким образом, более короткая строка предшествует всем
+                строкам, для которых она является префиксом.
+         */
+        template <typename Map>
+        struct string_digit_fn
+        {
+            template <typename Value>
+            std::size_t operator () (const Value & value) const
+            {
+                using std::begin;
+                using std::end;
+
+                decltype(auto) key = map(value);
+                const auto key_begin = begin(key);
+                const auto key_size = static_cast<std::size_t>(end(key) - key_begin);
+                static_assert(sizeof(*key_begin) == 1, "");
+
+                return depth < key_size ? 1 + static_cast<unsigned char>(*std::next(key_begin, static_cast<std::ptrdiff_t>(depth))) : 0;
+            }
+
+            Map map;
+            std::size_t depth;
+        };
+
+        template <typename Map>
+        string_digit_fn<Map> string_digit (Map map, std::size_t depth)
+        {
+            return {std::move(map), depth};
+        }
+
+        /*!
+            \brief
+                Сравнение строк, начиная с заданной глубины
+
+            \details
+                Первые `depth` символов сравниваемых строк заведомо совпадают, поэтому они не
+                просматриваются. Байты сравниваются как беззнаковые числа, как в `std::memcmp`.
+         */
+        template <typename Map>
+        struct suffix_less_fn
+        {
+            template <typename Value>
+            bool operator () (const Value & left, const Value & right) const
+            {
+                using std::begin;
+                using std::end;
+
+                decltype(auto) left_key = map(left);
+                decltype(auto) right_key = map(right);
+                return
+                    std::lexicographical_compare
+                    (
+                        std::next(begin(left_key), static_cast<std::ptrdiff_t>(std::min(depth, static_cast<std::size_t>(end(left_key) - begin(left_key))))),
+                        end(left_key),
+                        std::next(begin(right_key), static_cast<std::ptrdiff_t>(std::min(depth, static_cast<std::size_t>(end(right_key) - begin(right_key))))),
+                        end(right_key),
+                        [] (auto l, auto r)
+                        {
+                            return static_cast<unsigned char>(l) < static_cast<unsigned char>(r);
+                        }
+                    );
+            }
+
+            Map map;
+            std::size_t depth;
+        };
+
+        /*!
+            \brief
+                Поразрядная сортировка строк начиная со старшего символа
+
+            \details
+                Все строки диапазона `[first, last)` совпадают в первых `depth` символах.
+                На каждом шаге подсчитываются символы на позиции `depth`, элементы распределяются
+                по корзинам через буфер и переносятся обратно. Корзина строк, закончившихся на
+                этой позиции, уже упорядочена. Остальные корзины сортируются по следующему
+                символу: все, кроме самой большой, — рекурсивно, а самая большая — на следующей
+                итерации цикла, поэтому глубина рекурсии не превышает `log2(N)`.
+                Если все строки имеют одинаковый символ на позиции `depth`, то распределение
+                пропускается. Короткие диапазоны досортировываются вставками с пропуском общего
+                префикса.
+
+                Алгоритм устойчив.
+         */
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+        void
+            string_radix_sort_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                std::size_t depth
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+
+            while (last - first > string_radix_small_range_size)
+            {
+                const auto range_size = last - first;
+                const auto digit = string_digit(map, depth);
+
+                // Единица для дополнительного нуля в начале массива.
+                difference_type counters[string_radix_value_range + 1] = {0};
+                const auto ends = std::next(std::begin(counters));
+                count(first, last, digit, ends);
+                const auto maximum = partial_sum_max(ends, ends + string_radix_value_range, ends).second;
+
+                if (maximum == range_size)
+                {
+                    if (digit(*first) == 0)
+                    {
+                        return;
+                    }
+                    ++depth;
+                    continue;
+                }
+
+                dispose(std::make_move_iterator(first), std::make_move_iterator(last), buffer, digit, std::begin(counters));
+                std::move(buffer, std::next(buffer, range_size), first);
+
+                // После распределения `counters[b]` — конец корзины `b`.
+                auto largest_bucket = std::make_pair(counters[0], counters[0]);
+                for (auto bucket = 1ul; bucket < string_radix_value_range; ++bucket)
+                {
+                    const auto bucket_begin = counters[bucket - 1];
+                    const auto bucket_end = counters[bucket];
+                    if (bucket_end - bucket_begin > largest_bucket.second - largest_bucket.first)
+                    {
+                        if (largest_bucket.second - largest_bucket.first > 1)
+                        {
+                            string_radix_sort_impl(first + largest_bucket.first, first + largest_bucket.second, buffer, map, depth + 1);
+                        }
+                        largest_bucket = std::make_pair(bucket_begin, bucket_end);
+                    }
+                    else if (bucket_end - bucket_begin > 1)
+                    {
+                        string_radix_sort_impl(first + bucket_begin, first + bucket_end, buffer, map, depth + 1);
+                    }
+                }
+
+                last = first + largest_bucket.second;
+                first = first + largest_bucket.first;
+                ++depth;
+            }
+
+            binary_insertion_sort(first, last, suffix_less_fn<Map>{map, depth});
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+        void
+            string_radix_sort_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map
+            )
+        {
+            string_radix_sort_impl(first, last, buffer, map, 0);
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__STRING_RADIX_SORT_HPP
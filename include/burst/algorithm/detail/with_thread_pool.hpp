@@ -0,0 +1,43 @@
+#ifndef BURST__ALGORITHM__DETAIL__WITH_THREAD_POOL_HPP
+#define BURST__ALGORITHM__DETAIL__WITH_THREAD_POOL_HPP
+
+#include <burst/execution/parallel_policy.hpp>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Вызвать функцию от пула потоков
+
+            \details
+                Если в параллельной политике задан пул, принадлежащий вызывающей стороне, то
+                функция вызывается от него. Иначе создаётся временный пул на `thread_count`
+                потоков, который будет остановлен сразу после завершения функции.
+
+            \returns
+                Результат функции `f`.
+         */
+        template <typename UnaryFunction>
+        decltype(auto) with_thread_pool (parallel_policy par, std::size_t thread_count, UnaryFunction && f)
+        {
+            if (par.pool != nullptr)
+            {
+                return std::forward<UnaryFunction>(f)(*par.pool);
+            }
+            else
+            {
+                boost::asio::thread_pool pool(thread_count);
+                return std::forward<UnaryFunction>(f)(pool);
+            }
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__WITH_THREAD_POOL_HPP
@@ -0,0 +1,307 @@
+#ifndef BURST__ALGORITHM__DETAIL__WRITE_COMBINING_HPP
+#define BURST__ALGORITHM__DETAIL__WRITE_COMBINING_HPP
+
+#include <burst/algorithm/detail/counting_sort_traits.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace burst
+{
+    namespace detail
+    {
+        //!     Размер буфера объединения записи в байтах (одна строка кэша).
+        constexpr auto write_combining_buffer_bytes = std::size_t{64};
+
+        //!     Количество элементов в буфере объединения записи.
+        template <typename Value>
+        constexpr std::size_t write_combining_buffer_size ()
+        {
+            return sizeof(Value) < write_combining_buffer_bytes
+                ? write_combining_buffer_bytes / sizeof(Value)
+                : 1;
+        }
+
+        /*!
+            \brief
+                Буферы объединения записи
+
+            \details
+                По одному буферу на каждое значение `[0, ValueRange)` разряда. Каждый буфер
+                вмещает `write_combining_buffer_size<Value>()` элементов.
+                После распределения все буферы пусты, поэтому одни и те же буферы можно
+                использовать на всех проходах сортировки.
+         */
+        template <typename Value, std::size_t ValueRange>
+        struct write_combining_buffers
+        {
+            static_assert(std::is_trivial<Value>::value, "");
+            constexpr static auto buffer_size = write_combining_buffer_size<Value>();
+
+            Value * operator [] (std::size_t digit)
+            {
+                return values.get() + digit * buffer_size;
+            }
+
+            std::unique_ptr<Value[]> values = std::unique_ptr<Value[]>(new Value[ValueRange * buffer_size]);
+            std::unique_ptr<std::size_t[]> sizes = std::make_unique<std::size_t[]>(ValueRange);
+        };
+
+        /*!
+            \brief
+                Расставить по местам через буферы объединения записи
+
+            \details
+                Аналог `dispose`: элементы копятся в буфере своей корзины и переносятся в
+                выходной диапазон, когда буфер заполняется. Остатки переносятся в конце.
+                Порядок элементов внутри корзины сохраняется.
+         */
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2,
+            typename Value,
+            std::size_t ValueRange
+        >
+        void
+            dispose_write_combining
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_buffers<Value, ValueRange> & buffers
+            )
+        {
+            static_assert(std::is_same<iterator_value_t<ForwardIterator>, Value>::value, "");
+            static_assert(counting_sort_traits<Value, Map>::value_range == ValueRange, "");
+            using counter_type = iterator_value_t<RandomAccessIterator2>;
+            constexpr auto buffer_size = write_combining_buffers<Value, ValueRange>::buffer_size;
+
+            std::for_each(first, last,
+                [& result, & counters, & map, & buffers] (const auto & preimage)
+                {
+                    const auto digit = static_cast<std::size_t>(map(preimage));
+                    const auto buffer = buffers[digit];
+                    auto & size = buffers.sizes[digit];
+                    buffer[size++] = preimage;
+                    if (size == buffer_size)
+                    {
+                        std::copy(buffer, buffer + buffer_size, result + counters[digit]);
+                        counters[digit] += static_cast<counter_type>(buffer_size);
+                        size = 0;
+                    }
+                });
+
+            for (auto digit = std::size_t{0}; digit < ValueRange; ++digit)
+            {
+                const auto buffer = buffers[digit];
+                auto & size = buffers.sizes[digit];
+                std::copy(buffer, buffer + size, result + counters[digit]);
+                counters[digit] += static_cast<counter_type>(size);
+                size = 0;
+            }
+        }
+
+        template
+        <
+            typename ForwardIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose_write_combining
+            (
+                ForwardIterator first,
+                ForwardIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters
+            )
+        {
+            using value_type = iterator_value_t<ForwardIterator>;
+            using traits = counting_sort_traits<value_type, Map>;
+
+            write_combining_buffers<value_type, traits::value_range> buffers;
+            dispose_write_combining(first, last, result, map, counters, buffers);
+        }
+
+        /*!
+            \brief
+                Расставить по местам при проходе в обратном порядке через буферы объединения записи
+
+            \details
+                Аналог `dispose_backward`. Так как элементы поступают в обратном порядке, то
+                буфер переносится в выходной диапазон задом наперёд.
+         */
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2,
+            typename Value,
+            std::size_t ValueRange
+        >
+        void
+            dispose_backward_write_combining
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters,
+                write_combining_buffers<Value, ValueRange> & buffers
+            )
+        {
+            static_assert(std::is_same<iterator_value_t<BidirectionalIterator>, Value>::value, "");
+            static_assert(counting_sort_traits<Value, Map>::value_range == ValueRange, "");
+            using counter_type = iterator_value_t<RandomAccessIterator2>;
+            constexpr auto buffer_size = write_combining_buffers<Value, ValueRange>::buffer_size;
+
+            std::for_each(std::make_reverse_iterator(last), std::make_reverse_iterator(first),
+                [& result, & counters, & map, & buffers] (const auto & preimage)
+                {
+                    const auto digit = static_cast<std::size_t>(map(preimage));
+                    const auto buffer = buffers[digit];
+                    auto & size = buffers.sizes[digit];
+                    buffer[size++] = preimage;
+                    if (size == buffer_size)
+                    {
+                        counters[digit] -= static_cast<counter_type>(buffer_size);
+                        std::reverse_copy(buffer, buffer + buffer_size, result + counters[digit]);
+                        size = 0;
+                    }
+                });
+
+            for (auto digit = std::size_t{0}; digit < ValueRange; ++digit)
+            {
+                const auto buffer = buffers[digit];
+                auto & size = buffers.sizes[digit];
+                counters[digit] -= static_cast<counter_type>(size);
+                std::reverse_copy(buffer, buffer + size, result + counters[digit]);
+                size = 0;
+            }
+        }
+
+        template
+        <
+            typename BidirectionalIterator,
+            typename RandomAccessIterator1,
+            typename Map,
+            typename RandomAccessIterator2
+        >
+        void
+            dispose_backward_write_combining
+            (
+                BidirectionalIterator first,
+                BidirectionalIterator last,
+                RandomAccessIterator1 result,
+                Map map,
+                RandomAccessIterator2 counters
+            )
+        {
+            using value_type = iterator_value_t<BidirectionalIterator>;
+            using traits = counting_sort_traits<value_type, Map>;
+
+            write_combining_buffers<value_type, traits::value_range> buffers;
+            dispose_backward_write_combining(first, last, result, map, counters, buffers);
+        }
+
+        /*!
+            \brief
+                Распределение через заранее выделенные буферы объединения записи
+
+            \details
+                Ссылается на массив буферов, по одному на каждый кусок диапазона, который
+                распределяется в отдельной задаче. Последовательное распределение пользуется
+                первым буфером массива.
+
+            \see scatter_buffers
+         */
+        template <typename Value, std::size_t ValueRange>
+        struct write_combining_scatter
+        {
+            write_combining_buffers<Value, ValueRange> * buffers;
+        };
+
+        //!     Стратегия распределения для куска с номером `chunk_index`.
+        template <typename Scatter>
+        Scatter nth_scatter (Scatter scatter, std::size_t)
+        {
+            return scatter;
+        }
+
+        template <typename Value, std::size_t ValueRange>
+        write_combining_scatter<Value, ValueRange>
+            nth_scatter (write_combining_scatter<Value, ValueRange> scatter, std::size_t chunk_index)
+        {
+            return {scatter.buffers + chunk_index};
+        }
+
+        /*!
+            \brief
+                Память для распределения, выделяемая один раз на всю сортировку
+
+            \details
+                Многопроходная сортировка заводит этот объект до первого прохода и на каждом
+                проходе распределяет элементы через стратегию `get()`. Для прямого распределения
+                память не нужна, и `get()` возвращает исходную стратегию.
+
+            \see write_combining_scatter
+         */
+        template <typename Value, std::size_t ValueRange, typename Scatter, typename = void>
+        class scatter_buffers
+        {
+        public:
+            scatter_buffers (Scatter scatter, std::size_t /* chunk_count */):
+                m_scatter(scatter)
+            {
+            }
+
+            Scatter get () const
+            {
+                return m_scatter;
+            }
+
+        private:
+            Scatter m_scatter;
+        };
+
+        //!     Буферы объединения записи заводятся для каждого куска.
+        template <typename Value, std::size_t ValueRange>
+        class scatter_buffers
+        <
+            Value,
+            ValueRange,
+            write_combining_fn,
+            std::enable_if_t<std::is_trivial<Value>::value>
+        >
+        {
+        public:
+            scatter_buffers (write_combining_fn, std::size_t chunk_count):
+                m_buffers(std::make_unique<write_combining_buffers<Value, ValueRange>[]>(chunk_count))
+            {
+            }
+
+            write_combining_scatter<Value, ValueRange> get () const
+            {
+                return {m_buffers.get()};
+            }
+
+        private:
+            std::unique_ptr<write_combining_buffers<Value, ValueRange>[]> m_buffers;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DETAIL__WRITE_COMBINING_HPP
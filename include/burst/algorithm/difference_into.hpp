@@ -0,0 +1,87 @@
+#ifndef BURST__ALGORITHM__DIFFERENCE_INTO_HPP
+#define BURST__ALGORITHM__DIFFERENCE_INTO_HPP
+
+#include <burst/algorithm/detail/copy_run.hpp>
+#include <burst/algorithm/detail/run_bound.hpp>
+
+#include <functional>
+#include <iterator>
+
+namespace burst
+{
+    /*!
+        \brief
+            Разность с записью в выходной итератор
+
+        \details
+            Записывает в `result` те элементы уменьшаемого, которых нет в вычитаемом, в порядке
+            неубывания относительно `compare`. Как и в ленивой разности (см. `difference`),
+            каждый элемент вычитаемого вычёркивает из уменьшаемого не более одного
+            эквивалентного ему элемента. Сами входные диапазоны не изменяются.
+
+            Элементы уменьшаемого, меньшие текущего элемента вычитаемого, копируются одной
+            серией, а элементы вычитаемого, меньшие текущего элемента уменьшаемого, пропускаются
+            за один раз. Концы серий в диапазонах произвольного доступа ищутся скачущим поиском.
+
+        \param minuend
+            Уменьшаемое.
+        \param subtrahend
+            Вычитаемое.
+        \param compare
+            Отношение строгого порядка, относительно которого упорядочены диапазоны.
+        \param result
+            Итератор, в который будет записана разность.
+
+        \returns
+            Итератор за последним записанным элементом.
+
+        \see difference
+        \see difference_iterator
+     */
+    template <typename ForwardRange1, typename ForwardRange2, typename Compare, typename OutputIterator>
+    OutputIterator
+        difference_into
+        (
+            const ForwardRange1 & minuend,
+            const ForwardRange2 & subtrahend,
+            Compare compare,
+            OutputIterator result
+        )
+    {
+        using std::begin;
+        using std::end;
+        auto minuend_begin = begin(minuend);
+        const auto minuend_end = end(minuend);
+        auto subtrahend_begin = begin(subtrahend);
+        const auto subtrahend_end = end(subtrahend);
+
+        while (minuend_begin != minuend_end && subtrahend_begin != subtrahend_end)
+        {
+            if (compare(*minuend_begin, *subtrahend_begin))
+            {
+                const auto run_end = detail::run_lower_bound(minuend_begin, minuend_end, *subtrahend_begin, compare);
+                result = detail::copy_run(minuend_begin, run_end, result);
+                minuend_begin = run_end;
+            }
+            else if (compare(*subtrahend_begin, *minuend_begin))
+            {
+                subtrahend_begin = detail::run_lower_bound(subtrahend_begin, subtrahend_end, *minuend_begin, compare);
+            }
+            else
+            {
+                ++minuend_begin;
+                ++subtrahend_begin;
+            }
+        }
+
+        return detail::copy_run(minuend_begin, minuend_end, result);
+    }
+
+    template <typename ForwardRange1, typename ForwardRange2, typename OutputIterator>
+    OutputIterator difference_into (const ForwardRange1 & minuend, const ForwardRange2 & subtrahend, OutputIterator result)
+    {
+        return difference_into(minuend, subtrahend, std::less<>{}, result);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DIFFERENCE_INTO_HPP
@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__DISTRIBUTE_HPP
+#define BURST__ALGORITHM__DISTRIBUTE_HPP
+
+#include <burst/algorithm/distribute/distribute_par.hpp>
+#include <burst/algorithm/distribute/distribute_seq.hpp>
+
+#endif // BURST__ALGORITHM__DISTRIBUTE_HPP
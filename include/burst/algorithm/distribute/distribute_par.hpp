@@ -0,0 +1,124 @@
+#ifndef BURST__ALGORITHM__DISTRIBUTE__DISTRIBUTE_PAR_HPP
+#define BURST__ALGORITHM__DISTRIBUTE__DISTRIBUTE_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_distribute.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/distribute/distribute_seq.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант распределения по корзинам
+
+        \details
+            Устроен так же, как параллельная сортировка подсчётом: каждый поток собирает
+            счётчики своего куска, счётчики синхронизируются между кусками, и каждый поток
+            распределяет свои элементы на известные заранее места. Порядок элементов внутри
+            корзины сохраняется.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see distribute_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    auto
+        distribute
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result,
+            Map map
+        )
+    {
+        return distribute(par, first, last, result, std::move(map), direct_scatter);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Scatter>
+    auto
+        distribute
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result,
+            Map map,
+            Scatter scatter
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            return
+                detail::with_thread_pool(par, thread_count,
+                    [& shape, & first, & last, & result, & map, & scatter] (auto & pool)
+                    {
+                        return
+                            detail::distribute_impl(pool, shape, first, last, result,
+                                compose(shift_to_unsigned, std::move(map)), scatter);
+                    });
+        }
+        else
+        {
+            return distribute(first, last, result, map, scatter);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    auto distribute (parallel_policy par, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 result)
+    {
+        return distribute(par, first, last, result, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельного распределения по корзинам
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    auto distribute (parallel_policy par, RandomAccessRange && range, RandomAccessIterator result, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            distribute
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    auto distribute (parallel_policy par, RandomAccessRange && range, RandomAccessIterator result)
+    {
+        using std::begin;
+        using std::end;
+        return
+            distribute
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DISTRIBUTE__DISTRIBUTE_PAR_HPP
@@ -0,0 +1,119 @@
+#ifndef BURST__ALGORITHM__DISTRIBUTE__DISTRIBUTE_SEQ_HPP
+#define BURST__ALGORITHM__DISTRIBUTE__DISTRIBUTE_SEQ_HPP
+
+#include <burst/algorithm/detail/distribute.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Распределение по корзинам
+
+        \details
+            Копирует элементы входного диапазона в выходной, группируя их по значению образа:
+            сначала все элементы с образом `0`, затем с образом `1` и т.д. Порядок элементов
+            внутри корзины совпадает с их порядком во входном диапазоне.
+            По сути это устойчивая сортировка подсчётом, которая вместо конца выходного диапазона
+            возвращает границы всех корзин, так что каждую корзину можно обрабатывать отдельно,
+            не просматривая выходной диапазон заново. Например, так делается поразрядное
+            разбиение входов при соединении хешированием.
+
+            Образ приводится к беззнаковому виду так же, как в `histogram`.
+
+        \param [first, last)
+            Распределяемый диапазон. Должен быть хотя бы однонаправленным диапазоном.
+        \param result
+            Начало выходного диапазона размера не меньше `|[first, last)|`. Должен быть
+            итератором произвольного доступа.
+        \param map
+            Отображение элементов в номера корзин — целые числа небольшой разрядности.
+
+        \returns
+            `std::vector` из `M + 1` границ, где `M` — количество значений образа. Корзина `i`
+            занимает полуинтервал `[result + b[i], result + b[i + 1])`, `b[0] == 0`,
+            `b[M] == |[first, last)|`.
+
+        \see histogram
+        \see counting_sort_copy
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator, typename Map>
+    auto distribute (ForwardIterator first, ForwardIterator last, RandomAccessIterator result, Map map)
+    {
+        return detail::distribute_impl(first, last, result, compose(shift_to_unsigned, std::move(map)), direct_scatter);
+    }
+
+    /*!
+        \brief
+            Распределение по корзинам с выбранной стратегией записи
+
+        \details
+            Последний аргумент задаёт способ, которым элементы записываются в выходной диапазон:
+            `direct_scatter` (по умолчанию) или `write_combining`.
+
+        \see write_combining
+     */
+    template <typename ForwardIterator, typename RandomAccessIterator, typename Map, typename Scatter>
+    auto
+        distribute
+        (
+            ForwardIterator first,
+            ForwardIterator last,
+            RandomAccessIterator result,
+            Map map,
+            Scatter scatter
+        )
+    {
+        return detail::distribute_impl(first, last, result, compose(shift_to_unsigned, std::move(map)), scatter);
+    }
+
+    template <typename ForwardIterator, typename RandomAccessIterator>
+    auto distribute (ForwardIterator first, ForwardIterator last, RandomAccessIterator result)
+    {
+        return distribute(first, last, result, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант распределения по корзинам
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename ForwardRange, typename RandomAccessIterator, typename Map>
+    auto distribute (ForwardRange && range, RandomAccessIterator result, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            distribute
+            (
+                begin(std::forward<ForwardRange>(range)),
+                end(std::forward<ForwardRange>(range)),
+                result,
+                map
+            );
+    }
+
+    template <typename ForwardRange, typename RandomAccessIterator>
+    auto distribute (ForwardRange && range, RandomAccessIterator result)
+    {
+        using std::begin;
+        using std::end;
+        return
+            distribute
+            (
+                begin(std::forward<ForwardRange>(range)),
+                end(std::forward<ForwardRange>(range)),
+                result
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__DISTRIBUTE__DISTRIBUTE_SEQ_HPP
@@ -0,0 +1,86 @@
+#ifndef BURST__ALGORITHM__EXTERNAL_RADIX_SORT__EXTERNAL_RADIX_SORT_PAR_HPP
+#define BURST__ALGORITHM__EXTERNAL_RADIX_SORT__EXTERNAL_RADIX_SORT_PAR_HPP
+
+#include <burst/algorithm/detail/external_radix_sort.hpp>
+#include <burst/algorithm/external_radix_sort/external_radix_sort_seq.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_par.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант внешней поразрядной сортировки
+
+        \details
+            Блоки сортируются параллельной поразрядной сортировкой. Если в `par` передан пул
+            потоков, то все блоки сортируются в нём. Чтение, запись и слияние серий выполняются
+            в вызывающем потоке.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see external_radix_sort_seq.hpp
+        \see parallel_policy
+     */
+    template <typename Value, typename MakeRun, typename Map, typename Radix>
+    void
+        external_radix_sort
+        (
+            parallel_policy par,
+            std::istream & input,
+            std::ostream & output,
+            std::size_t memory_budget,
+            MakeRun make_run,
+            Map map,
+            Radix radix
+        )
+    {
+        detail::external_radix_sort_impl<Value>(input, output, memory_budget, std::move(make_run),
+            compose(shift_to_unsigned, map),
+            [& par, & map, & radix] (auto first, auto last, auto buffer)
+            {
+                radix_sort(par, first, last, buffer, map, radix);
+            });
+    }
+
+    template <typename Value, typename MakeRun, typename Map>
+    void
+        external_radix_sort
+        (
+            parallel_policy par,
+            std::istream & input,
+            std::ostream & output,
+            std::size_t memory_budget,
+            MakeRun make_run,
+            Map map
+        )
+    {
+        external_radix_sort<Value>(par, input, output, memory_budget, std::move(make_run), map, low_byte);
+    }
+
+    template <typename Value, typename MakeRun>
+    void
+        external_radix_sort
+        (
+            parallel_policy par,
+            std::istream & input,
+            std::ostream & output,
+            std::size_t memory_budget,
+            MakeRun make_run
+        )
+    {
+        external_radix_sort<Value>(par, input, output, memory_budget, std::move(make_run), identity, low_byte);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__EXTERNAL_RADIX_SORT__EXTERNAL_RADIX_SORT_PAR_HPP
@@ -0,0 +1,116 @@
+#ifndef BURST__ALGORITHM__EXTERNAL_RADIX_SORT__EXTERNAL_RADIX_SORT_SEQ_HPP
+#define BURST__ALGORITHM__EXTERNAL_RADIX_SORT__EXTERNAL_RADIX_SORT_SEQ_HPP
+
+#include <burst/algorithm/detail/external_radix_sort.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_seq.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Внешняя поразрядная сортировка
+
+        \details
+            Сортирует последовательность объектов типа `Value`, записанных в бинарном виде в поток
+            `input`, и записывает результат в бинарном виде в поток `output`. Предназначена для
+            данных, которые не помещаются в оперативную память.
+
+            Алгоритм работы
+
+            1.  Входной поток читается блоками. Размер блока выбирается так, чтобы блок вместе с
+                буфером для поразрядной сортировки укладывался в бюджет памяти.
+            2.  Каждый блок сортируется поразрядной сортировкой и записывается во временное
+                хранилище — серию.
+            3.  Серии лениво сливаются итератором слияния и записываются в выходной поток.
+
+            Если вся последовательность уместилась в один блок, то серии не создаются.
+            Алгоритм неустойчив: равные по образу `map` элементы разных серий могут поменяться
+            местами.
+
+        \tparam Value
+            Тип сортируемых объектов. Должен быть тривиальным.
+        \param input
+            Поток, из которого читаются сортируемые объекты.
+        \param output
+            Поток, в который записывается результат.
+        \param memory_budget
+            Количество байтов, которое разрешено занять данными во время сортировки. Должно быть
+            не меньше размера двух объектов `Value`.
+        \param make_run
+            Функция без аргументов, создающая хранилище для очередной серии. Должна возвращать
+            владеющий указатель (например, `std::unique_ptr`) на поток ввода-вывода
+            `std::iostream`, доступный для записи и последующего чтения с начала. Хранилища
+            разрушаются по окончании сортировки.
+        \param map
+            Отображение входных объектов в целые числа. Имеет тот же смысл, что и в `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в `radix_sort`.
+
+        \throws std::invalid_argument
+            Если бюджет памяти меньше размера двух объектов.
+        \throws std::runtime_error
+            Если чтение из входного потока или из серии либо запись в серию или в выходной поток
+            не удались (например, закончилось место на диске). Содержимое выходного потока в этом
+            случае не определено.
+
+        \see radix_sort
+        \see merge_iterator
+     */
+    template <typename Value, typename MakeRun, typename Map, typename Radix>
+    void
+        external_radix_sort
+        (
+            std::istream & input,
+            std::ostream & output,
+            std::size_t memory_budget,
+            MakeRun make_run,
+            Map map,
+            Radix radix
+        )
+    {
+        detail::external_radix_sort_impl<Value>(input, output, memory_budget, std::move(make_run),
+            compose(shift_to_unsigned, map),
+            [& map, & radix] (auto first, auto last, auto buffer)
+            {
+                radix_sort(first, last, buffer, map, radix);
+            });
+    }
+
+    template <typename Value, typename MakeRun, typename Map>
+    void
+        external_radix_sort
+        (
+            std::istream & input,
+            std::ostream & output,
+            std::size_t memory_budget,
+            MakeRun make_run,
+            Map map
+        )
+    {
+        external_radix_sort<Value>(input, output, memory_budget, std::move(make_run), map, low_byte);
+    }
+
+    template <typename Value, typename MakeRun>
+    void
+        external_radix_sort
+        (
+            std::istream & input,
+            std::ostream & output,
+            std::size_t memory_budget,
+            MakeRun make_run
+        )
+    {
+        external_radix_sort<Value>(input, output, memory_budget, std::move(make_run), identity, low_byte);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__EXTERNAL_RADIX_SORT__EXTERNAL_RADIX_SORT_SEQ_HPP
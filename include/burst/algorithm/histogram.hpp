@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__HISTOGRAM_HPP
+#define BURST__ALGORITHM__HISTOGRAM_HPP
+
+#include <burst/algorithm/histogram/histogram_par.hpp>
+#include <burst/algorithm/histogram/histogram_seq.hpp>
+
+#endif // BURST__ALGORITHM__HISTOGRAM_HPP
@@ -0,0 +1,94 @@
+#ifndef BURST__ALGORITHM__HISTOGRAM__HISTOGRAM_PAR_HPP
+#define BURST__ALGORITHM__HISTOGRAM__HISTOGRAM_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_distribute.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/histogram/histogram_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант гистограммы
+
+        \details
+            Каждый поток строит гистограмму своего куска в собственных счётчиках, а затем
+            гистограммы кусков складываются.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see histogram_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator, typename Map>
+    auto histogram (parallel_policy par, RandomAccessIterator first, RandomAccessIterator last, Map map)
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            return
+                detail::with_thread_pool(par, thread_count,
+                    [& shape, & first, & last, & map] (auto & pool)
+                    {
+                        return detail::histogram_impl(pool, shape, first, last, compose(shift_to_unsigned, std::move(map)));
+                    });
+        }
+        else
+        {
+            return histogram(first, last, map);
+        }
+    }
+
+    template <typename RandomAccessIterator>
+    auto histogram (parallel_policy par, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        return histogram(par, first, last, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной гистограммы
+     */
+    template <typename RandomAccessRange, typename Map>
+    auto histogram (parallel_policy par, RandomAccessRange && range, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            histogram
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                map
+            );
+    }
+
+    template <typename RandomAccessRange>
+    auto histogram (parallel_policy par, RandomAccessRange && range)
+    {
+        using std::begin;
+        using std::end;
+        return
+            histogram
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range))
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__HISTOGRAM__HISTOGRAM_PAR_HPP
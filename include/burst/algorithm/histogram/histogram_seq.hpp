@@ -0,0 +1,89 @@
+#ifndef BURST__ALGORITHM__HISTOGRAM__HISTOGRAM_SEQ_HPP
+#define BURST__ALGORITHM__HISTOGRAM__HISTOGRAM_SEQ_HPP
+
+#include <burst/algorithm/detail/distribute.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Гистограмма образов
+
+        \details
+            Подсчитывает, сколько элементов диапазона отображается в каждое из возможных
+            значений. Это первый шаг сортировки подсчётом, вынесенный в отдельную функцию, —
+            например, для того, чтобы заранее узнать размеры корзин при разбиении данных.
+
+            Отображение должно возвращать целые числа небольшой разрядности (как правило, не
+            больше 16 битов), потому что под каждое возможное значение заводится свой счётчик.
+            Как и в сортировке подсчётом, образ приводится к беззнаковому виду функцией
+            `shift_to_unsigned`, поэтому для знаковых образов индекс счётчика смещён на
+            половину диапазона значений.
+
+        \param [first, last)
+            Диапазон, по которому строится гистограмма. Должен быть хотя бы однонаправленным
+            диапазоном.
+        \param map
+            Отображение элементов в целые числа.
+
+        \returns
+            `std::vector` счётчиков, количество которых равно количеству значений образа.
+            Тип счётчиков — `difference_type` входного итератора.
+
+        \see distribute
+        \see counting_sort_copy
+     */
+    template <typename ForwardIterator, typename Map>
+    auto histogram (ForwardIterator first, ForwardIterator last, Map map)
+    {
+        return detail::histogram_impl(first, last, compose(shift_to_unsigned, std::move(map)));
+    }
+
+    template <typename ForwardIterator>
+    auto histogram (ForwardIterator first, ForwardIterator last)
+    {
+        return histogram(first, last, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант гистограммы
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename ForwardRange, typename Map>
+    auto histogram (ForwardRange && range, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            histogram
+            (
+                begin(std::forward<ForwardRange>(range)),
+                end(std::forward<ForwardRange>(range)),
+                map
+            );
+    }
+
+    template <typename ForwardRange>
+    auto histogram (ForwardRange && range)
+    {
+        using std::begin;
+        using std::end;
+        return
+            histogram
+            (
+                begin(std::forward<ForwardRange>(range)),
+                end(std::forward<ForwardRange>(range))
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__HISTOGRAM__HISTOGRAM_SEQ_HPP
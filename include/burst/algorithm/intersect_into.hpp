@@ -0,0 +1,116 @@
+#ifndef BURST__ALGORITHM__INTERSECT_INTO_HPP
+#define BURST__ALGORITHM__INTERSECT_INTO_HPP
+
+#include <burst/algorithm/detail/inner_range_vector.hpp>
+#include <burst/algorithm/detail/integer_intersect.hpp>
+#include <burst/iterator/intersect_iterator.hpp>
+#include <burst/range/own_as_range.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+#include <burst/type_traits/range_iterator.hpp>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename Range, typename Compare, typename OutputIterator>
+        OutputIterator
+            intersect_into_impl
+            (
+                std::vector<Range> ranges,
+                Compare compare,
+                OutputIterator result,
+                std::false_type
+            )
+        {
+            auto first = make_intersect_iterator(burst::own_as_range(std::move(ranges)), compare);
+            auto last = make_intersect_iterator(iterator::end_tag, first);
+            return std::copy(std::move(first), std::move(last), result);
+        }
+
+        template <typename Range, typename Compare, typename OutputIterator>
+        OutputIterator
+            intersect_into_impl
+            (
+                std::vector<Range> ranges,
+                Compare,
+                OutputIterator result,
+                std::true_type
+            )
+        {
+            using value_type = iterator_value_t<range_iterator_t<Range>>;
+
+            auto arrays = std::vector<boost::iterator_range<const value_type *>>{};
+            arrays.reserve(ranges.size());
+            for (const auto & range: ranges)
+            {
+                if (range.empty())
+                {
+                    return result;
+                }
+                const auto first = std::addressof(*range.begin());
+                arrays.push_back(boost::make_iterator_range(first, first + range.size()));
+            }
+
+            return intersect_arrays(std::move(arrays), result);
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Пересечение с записью в выходной итератор
+
+        \details
+            Записывает в `result` те, и только те элементы входных диапазонов, которые есть
+            одновременно во всех этих диапазонах, в порядке их неубывания относительно
+            `compare`. Результат совпадает с ленивым пересечением (см. `intersect`), но элементы
+            не проходят по одному через итератор пересечения, а сами входные диапазоны не
+            изменяются.
+
+            Если элементы всех диапазонов — 32- или 64-битные целые числа, лежащие в памяти
+            подряд (массивы, `std::vector`), а порядок естественный (`std::less`), то пересечение
+            выполняется специальными ядрами. Диапазоны пересекаются попарно от самых коротких
+            к самым длинным. Если длины двух пересекаемых диапазонов близки, то они пересекаются
+            блоками по 128 бит с помощью векторных инструкций SSE2 (там, где они доступны), а
+            если один диапазон намного длиннее другого — скачущим поиском.
+
+        \param ranges
+            Диапазон произвольного доступа, состоящий из упорядоченных диапазонов, либо кортеж
+            ссылок на упорядоченные диапазоны. Диапазоны из кортежа могут быть разных типов, но
+            их элементы должны быть одного типа.
+        \param compare
+            Отношение строгого порядка, относительно которого упорядочены диапазоны.
+        \param result
+            Итератор, в который будет записано пересечение.
+
+        \returns
+            Итератор за последним записанным элементом.
+
+        \see intersect
+        \see intersect_iterator
+     */
+    template <typename Ranges, typename Compare, typename OutputIterator>
+    OutputIterator intersect_into (const Ranges & ranges, Compare compare, OutputIterator result)
+    {
+        auto inner_ranges = detail::make_inner_range_vector(ranges);
+
+        using inner_iterator = range_iterator_t<typename decltype(inner_ranges)::value_type>;
+        using is_applicable = detail::is_intersect_kernel_applicable<inner_iterator, Compare>;
+        return detail::intersect_into_impl(std::move(inner_ranges), compare, result, is_applicable{});
+    }
+
+    template <typename Ranges, typename OutputIterator>
+    OutputIterator intersect_into (const Ranges & ranges, OutputIterator result)
+    {
+        return intersect_into(ranges, std::less<>{}, result);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__INTERSECT_INTO_HPP
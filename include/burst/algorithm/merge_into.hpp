@@ -0,0 +1,148 @@
+#ifndef BURST__ALGORITHM__MERGE_INTO_HPP
+#define BURST__ALGORITHM__MERGE_INTO_HPP
+
+#include <burst/algorithm/detail/copy_run.hpp>
+#include <burst/algorithm/detail/inner_range_vector.hpp>
+#include <burst/algorithm/detail/reserve_output.hpp>
+#include <burst/algorithm/detail/run_bound.hpp>
+#include <burst/iterator/detail/loser_tree.hpp>
+
+#include <boost/range/size.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Сколько раз подряд должен победить один и тот же диапазон, чтобы слияние перешло
+                к копированию серий
+
+            \details
+                Как и в сортировке Тима Петерса: пока диапазоны чередуются, поиск конца серии
+                только мешает, а когда один диапазон раз за разом оказывается наименьшим, его
+                элементы выгоднее копировать целыми сериями. Слияние продолжает копировать серии,
+                пока они не короче этого порога.
+         */
+        constexpr auto merge_gallop_threshold = 7;
+
+        template <typename Range, typename Compare, typename OutputIterator>
+        OutputIterator merge_into_impl (std::vector<Range> ranges, Compare compare, OutputIterator result)
+        {
+            ranges.erase(std::remove_if(ranges.begin(), ranges.end(), [] (const auto & r) {return r.empty();}),
+                ranges.end());
+            if (ranges.empty())
+            {
+                return result;
+            }
+            if (ranges.size() == 1)
+            {
+                return copy_run(ranges.front().begin(), ranges.front().end(), result);
+            }
+
+            auto tree = loser_tree<typename std::vector<Range>::iterator, Compare>(ranges.begin(), ranges.end(), compare);
+            const Range * previous_winner = std::addressof(tree.top());
+            auto win_count = 0;
+            auto galloping = false;
+            while (not tree.empty())
+            {
+                const auto & winner = tree.top();
+                if (not galloping)
+                {
+                    win_count = std::addressof(winner) == previous_winner ? win_count + 1 : 0;
+                    previous_winner = std::addressof(winner);
+                    galloping = win_count >= merge_gallop_threshold;
+                }
+
+                if (not galloping)
+                {
+                    *result++ = winner.front();
+                    tree.pop();
+                }
+                else
+                {
+                    const auto runner_up = tree.runner_up();
+                    const auto run_end =
+                        runner_up != nullptr
+                            ? run_upper_bound(winner.begin(), winner.end(), runner_up->front(), compare)
+                            : winner.end();
+                    const auto run_length = std::distance(winner.begin(), run_end);
+                    result = copy_run(winner.begin(), run_end, result);
+                    tree.pop(run_length);
+
+                    if (run_length < merge_gallop_threshold)
+                    {
+                        galloping = false;
+                        win_count = 0;
+                        previous_winner = nullptr;
+                    }
+                }
+            }
+            return result;
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Слияние с записью в выходной итератор
+
+        \details
+            Записывает в `result` все элементы всех входных диапазонов в порядке их неубывания
+            относительно `compare`. Результат совпадает с ленивым слиянием (см. `merge`) с
+            точностью до порядка эквивалентных элементов из разных диапазонов, но элементы не
+            проходят по одному через итератор слияния, а сами входные диапазоны не изменяются.
+
+            Слияние ведётся с помощью дерева проигравших. Если один и тот же диапазон несколько раз
+            подряд оказывается наименьшим, то дальше из него сразу копируется вся серия элементов,
+            не превосходящих первого элемента следующего по величине диапазона. Конец серии
+            ищется скачущим поиском, поэтому на слияние длинных слабо перемешанных диапазонов
+            уходит намного меньше сравнений, чем на поэлементное слияние.
+
+            Размер слияния известен заранее, поэтому если `result` вставляет в конец контейнера
+            (`std::back_inserter`), то место в контейнере резервируется сразу на всё слияние.
+
+        \param ranges
+            Диапазон произвольного доступа, состоящий из упорядоченных диапазонов, либо кортеж
+            ссылок на упорядоченные диапазоны.
+        \param compare
+            Отношение строгого порядка, относительно которого упорядочены диапазоны.
+        \param result
+            Итератор, в который будет записано слияние.
+
+        \returns
+            Итератор за последним записанным элементом.
+
+        \see merge
+        \see merge_iterator
+     */
+    template <typename Ranges, typename Compare, typename OutputIterator>
+    OutputIterator merge_into (const Ranges & ranges, Compare compare, OutputIterator result)
+    {
+        auto inner_ranges = detail::make_inner_range_vector(ranges);
+        detail::reserve_output(result,
+            [& inner_ranges]
+            {
+                auto size = std::size_t{0};
+                for (const auto & range: inner_ranges)
+                {
+                    size += static_cast<std::size_t>(boost::size(range));
+                }
+                return size;
+            });
+        return detail::merge_into_impl(std::move(inner_ranges), compare, result);
+    }
+
+    template <typename Ranges, typename OutputIterator>
+    OutputIterator merge_into (const Ranges & ranges, OutputIterator result)
+    {
+        return merge_into(ranges, std::less<>{}, result);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__MERGE_INTO_HPP
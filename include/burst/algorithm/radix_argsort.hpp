@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__RADIX_ARGSORT_HPP
+#define BURST__ALGORITHM__RADIX_ARGSORT_HPP
+
+#include <burst/algorithm/radix_argsort/radix_argsort_par.hpp>
+#include <burst/algorithm/radix_argsort/radix_argsort_seq.hpp>
+
+#endif // BURST__ALGORITHM__RADIX_ARGSORT_HPP
@@ -0,0 +1,191 @@
+#ifndef BURST__ALGORITHM__RADIX_ARGSORT__RADIX_ARGSORT_PAR_HPP
+#define BURST__ALGORITHM__RADIX_ARGSORT__RADIX_ARGSORT_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_radix_argsort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_argsort/radix_argsort_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант косвенной поразрядной сортировки
+
+        \details
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+        \param result
+            Итератор, в который будет записана перестановка индексов.
+            Должен быть итератором произвольного доступа.
+
+        \see radix_argsort_seq.hpp
+        \see parallel_policy
+     */
+    template
+    <
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename Map,
+        typename Radix
+    >
+    RandomAccessIterator2
+        radix_argsort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result,
+            Map map,
+            Radix radix
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            return
+                detail::with_thread_pool(par, thread_count,
+                    [& shape, & first, & last, & result, & map, & radix] (auto & pool)
+                    {
+                        using std::distance;
+                        const auto size = static_cast<std::size_t>(distance(first, last));
+                        if (size <= std::numeric_limits<std::uint32_t>::max())
+                        {
+                            return
+                                detail::radix_argsort_impl<std::uint32_t>
+                                (
+                                    pool,
+                                    shape,
+                                    first,
+                                    last,
+                                    result,
+                                    compose(shift_to_unsigned, std::move(map)),
+                                    radix
+                                );
+                        }
+                        else
+                        {
+                            return
+                                detail::radix_argsort_impl<std::size_t>
+                                (
+                                    pool,
+                                    shape,
+                                    first,
+                                    last,
+                                    result,
+                                    compose(shift_to_unsigned, std::move(map)),
+                                    radix
+                                );
+                        }
+                    });
+        }
+        else
+        {
+            return radix_argsort(first, last, result, map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    RandomAccessIterator2
+        radix_argsort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result,
+            Map map
+        )
+    {
+        return radix_argsort(par, first, last, result, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator2
+        radix_argsort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 result
+        )
+    {
+        return radix_argsort(par, first, last, result, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной косвенной поразрядной сортировки
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    RandomAccessIterator
+        radix_argsort
+        (
+            parallel_policy par,
+            RandomAccessRange && range,
+            RandomAccessIterator result,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_argsort
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result,
+                map,
+                radix
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    RandomAccessIterator radix_argsort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator result, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_argsort
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    RandomAccessIterator radix_argsort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator result)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_argsort
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_ARGSORT__RADIX_ARGSORT_PAR_HPP
@@ -0,0 +1,172 @@
+#ifndef BURST__ALGORITHM__RADIX_ARGSORT__RADIX_ARGSORT_SEQ_HPP
+#define BURST__ALGORITHM__RADIX_ARGSORT__RADIX_ARGSORT_SEQ_HPP
+
+#include <burst/algorithm/detail/radix_argsort.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Косвенная поразрядная сортировка
+
+        \details
+            Не переставляет элементы входного диапазона, а записывает в выходной итератор
+            перестановку индексов `p` такую, что последовательность `first[p[0]]`, `first[p[1]]`,
+            ... упорядочена по образам `map`. Сортировка устойчива: индексы элементов с равными
+            образами идут по возрастанию.
+
+            Полезна, когда сортируемые объекты велики: при обычной поразрядной сортировке на
+            каждом проходе переносятся сами объекты, а здесь — только пары из ключа и индекса.
+            Полученную перестановку можно применить к диапазону с помощью `apply_permutation`.
+
+            Использует `O(N)` дополнительной памяти под пары из ключа и индекса.
+
+        \param first
+            Итератор на начало сортируемого диапазона.
+            Должен быть итератором произвольного доступа.
+        \param last
+            Итератор конца сортируемого диапазона.
+        \param result
+            Итератор, в который будет записана перестановка индексов.
+        \param map
+            Отображение входных объектов в целые числа. Имеет тот же смысл, что и в
+            `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в
+            `radix_sort`.
+
+        \returns
+            Итератор за последним записанным индексом.
+
+        \see radix_sort
+        \see apply_permutation
+     */
+    template
+    <
+        typename RandomAccessIterator,
+        typename OutputIterator,
+        typename Map,
+        typename Radix
+    >
+    OutputIterator
+        radix_argsort
+        (
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            OutputIterator result,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::distance;
+        const auto size = static_cast<std::size_t>(distance(first, last));
+        if (size <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+        {
+            return
+                detail::radix_argsort_impl<std::int32_t, std::uint32_t>
+                (
+                    first,
+                    last,
+                    result,
+                    compose(shift_to_unsigned, std::move(map)),
+                    radix
+                );
+        }
+        else
+        {
+            return
+                detail::radix_argsort_impl<std::ptrdiff_t, std::size_t>
+                (
+                    first,
+                    last,
+                    result,
+                    compose(shift_to_unsigned, std::move(map)),
+                    radix
+                );
+        }
+    }
+
+    template <typename RandomAccessIterator, typename OutputIterator, typename Map>
+    OutputIterator
+        radix_argsort
+        (
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            OutputIterator result,
+            Map map
+        )
+    {
+        return radix_argsort(first, last, result, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator, typename OutputIterator>
+    OutputIterator radix_argsort (RandomAccessIterator first, RandomAccessIterator last, OutputIterator result)
+    {
+        return radix_argsort(first, last, result, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант косвенной поразрядной сортировки
+
+        \details
+            Отличается только тем, что сортируемые значения задаются не парой итераторов, а
+            диапазоном.
+     */
+    template <typename RandomAccessRange, typename OutputIterator, typename Map, typename Radix>
+    OutputIterator radix_argsort (RandomAccessRange && range, OutputIterator result, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_argsort
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result,
+                map,
+                radix
+            );
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator, typename Map>
+    OutputIterator radix_argsort (RandomAccessRange && range, OutputIterator result, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_argsort
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename OutputIterator>
+    OutputIterator radix_argsort (RandomAccessRange && range, OutputIterator result)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_argsort
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                result
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_ARGSORT__RADIX_ARGSORT_SEQ_HPP
@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__RADIX_PARTIAL_SORT_HPP
+#define BURST__ALGORITHM__RADIX_PARTIAL_SORT_HPP
+
+#include <burst/algorithm/radix_partial_sort/radix_partial_sort_par.hpp>
+#include <burst/algorithm/radix_partial_sort/radix_partial_sort_seq.hpp>
+
+#endif // BURST__ALGORITHM__RADIX_PARTIAL_SORT_HPP
@@ -0,0 +1,167 @@
+#ifndef BURST__ALGORITHM__RADIX_PARTIAL_SORT__RADIX_PARTIAL_SORT_PAR_HPP
+#define BURST__ALGORITHM__RADIX_PARTIAL_SORT__RADIX_PARTIAL_SORT_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_by_chunks.hpp>
+#include <burst/algorithm/detail/parallel_radix_select.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort_inplace.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_partial_sort/radix_partial_sort_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант поразрядной частичной сортировки
+
+        \details
+            Поиск границы префикса выполняется параллельным `radix_select`, а сам префикс
+            упорядочивается параллельной сортировкой на месте. Оба этапа исполняются в одном и
+            том же пуле потоков.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see radix_partial_sort_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_partial_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last,
+            Map map,
+            Radix radix
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1 && first != middle)
+        {
+            detail::with_thread_pool(par, thread_count,
+                [& par, & shape, & first, & middle, & last, & map, & radix] (auto & pool)
+                {
+                    const auto nth = std::prev(middle);
+                    auto unsigned_map = compose(shift_to_unsigned, std::move(map));
+                    detail::radix_select_impl(pool, shape, first, nth, last, unsigned_map, radix);
+
+                    const auto prefix_shape = detail::get_shape(par, first, nth);
+                    if (prefix_shape[0] > 1)
+                    {
+                        detail::radix_sort_inplace_impl(pool, prefix_shape, first, nth, unsigned_map, radix);
+                    }
+                    else
+                    {
+                        detail::post(pool,
+                            [& first, & nth, & unsigned_map, & radix]
+                            {
+                                detail::radix_sort_inplace_impl(first, nth, unsigned_map, radix);
+                            }).get();
+                    }
+                });
+        }
+        else
+        {
+            radix_partial_sort(first, middle, last, map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator, typename Map>
+    void
+        radix_partial_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last,
+            Map map
+        )
+    {
+        radix_partial_sort(par, first, middle, last, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator>
+    void
+        radix_partial_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last
+        )
+    {
+        radix_partial_sort(par, first, middle, last, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной поразрядной частичной сортировки
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_partial_sort
+        (
+            parallel_policy par,
+            RandomAccessRange && range,
+            RandomAccessIterator middle,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::begin;
+        using std::end;
+        radix_partial_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            middle,
+            end(std::forward<RandomAccessRange>(range)),
+            map,
+            radix
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void radix_partial_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator middle, Map map)
+    {
+        using std::begin;
+        using std::end;
+        radix_partial_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            middle,
+            end(std::forward<RandomAccessRange>(range)),
+            map
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void radix_partial_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator middle)
+    {
+        using std::begin;
+        using std::end;
+        radix_partial_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            middle,
+            end(std::forward<RandomAccessRange>(range))
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_PARTIAL_SORT__RADIX_PARTIAL_SORT_PAR_HPP
@@ -0,0 +1,128 @@
+#ifndef BURST__ALGORITHM__RADIX_PARTIAL_SORT__RADIX_PARTIAL_SORT_SEQ_HPP
+#define BURST__ALGORITHM__RADIX_PARTIAL_SORT__RADIX_PARTIAL_SORT_SEQ_HPP
+
+#include <burst/algorithm/detail/radix_select.hpp>
+#include <burst/algorithm/detail/radix_sort_inplace.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Поразрядная частичная сортировка
+
+        \details
+            Аналог `std::partial_sort` для элементов, отображаемых в целые числа. После вызова
+            диапазон `[first, middle)` содержит `|[first, middle)|` наименьших по образам `map`
+            элементов в упорядоченном виде, а остальные элементы лежат в `[middle, last)` в
+            неопределённом порядке.
+
+            Сначала поразрядным поиском (см. `radix_select`) на место `middle - 1` ставится
+            нужный элемент, а затем поразрядной сортировкой на месте упорядочивается только
+            префикс перед ним. Поэтому время работы близко к `O(N + K)`, где `N` — размер всего
+            диапазона, `K` — размер префикса. Буфер не нужен.
+
+            Алгоритм неустойчив.
+
+        \param [first, last)
+            Диапазон, в котором ищутся наименьшие элементы. Должен быть диапазоном произвольного
+            доступа.
+        \param middle
+            Конец упорядочиваемого префикса.
+        \param map
+            Отображение входных объектов в целые числа. Имеет тот же смысл, что и в `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в `radix_sort`.
+
+        \see radix_select
+        \see radix_sort_inplace
+     */
+    template <typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_partial_sort
+        (
+            RandomAccessIterator first,
+            RandomAccessIterator middle,
+            RandomAccessIterator last,
+            Map map,
+            Radix radix
+        )
+    {
+        if (first != middle)
+        {
+            const auto nth = std::prev(middle);
+            auto unsigned_map = compose(shift_to_unsigned, std::move(map));
+            detail::radix_select_impl(first, nth, last, unsigned_map, radix);
+            detail::radix_sort_inplace_impl(first, nth, unsigned_map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator, typename Map>
+    void radix_partial_sort (RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Map map)
+    {
+        radix_partial_sort(first, middle, last, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator>
+    void radix_partial_sort (RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+    {
+        radix_partial_sort(first, middle, last, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант поразрядной частичной сортировки
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    void radix_partial_sort (RandomAccessRange && range, RandomAccessIterator middle, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        radix_partial_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            middle,
+            end(std::forward<RandomAccessRange>(range)),
+            map,
+            radix
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void radix_partial_sort (RandomAccessRange && range, RandomAccessIterator middle, Map map)
+    {
+        using std::begin;
+        using std::end;
+        radix_partial_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            middle,
+            end(std::forward<RandomAccessRange>(range)),
+            map
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void radix_partial_sort (RandomAccessRange && range, RandomAccessIterator middle)
+    {
+        using std::begin;
+        using std::end;
+        radix_partial_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            middle,
+            end(std::forward<RandomAccessRange>(range))
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_PARTIAL_SORT__RADIX_PARTIAL_SORT_SEQ_HPP
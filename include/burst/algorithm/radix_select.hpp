@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__RADIX_SELECT_HPP
+#define BURST__ALGORITHM__RADIX_SELECT_HPP
+
+#include <burst/algorithm/radix_select/radix_select_par.hpp>
+#include <burst/algorithm/radix_select/radix_select_seq.hpp>
+
+#endif // BURST__ALGORITHM__RADIX_SELECT_HPP
@@ -0,0 +1,158 @@
+#ifndef BURST__ALGORITHM__RADIX_SELECT__RADIX_SELECT_PAR_HPP
+#define BURST__ALGORITHM__RADIX_SELECT__RADIX_SELECT_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_radix_select.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_select/radix_select_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант поразрядного поиска n-го элемента
+
+        \details
+            Пока диапазон, в котором ведётся поиск, велик, счётчики разряда собираются
+            параллельно, каждым потоком для своего куска. Когда диапазон сужается, поиск
+            продолжается последовательно.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see radix_select_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_select
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator nth,
+            RandomAccessIterator last,
+            Map map,
+            Radix radix
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & nth, & last, & map, & radix] (auto & pool)
+                {
+                    detail::radix_select_impl
+                    (
+                        pool,
+                        shape,
+                        first,
+                        nth,
+                        last,
+                        compose(shift_to_unsigned, std::move(map)),
+                        radix
+                    );
+                });
+        }
+        else
+        {
+            radix_select(first, nth, last, map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator, typename Map>
+    void
+        radix_select
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator nth,
+            RandomAccessIterator last,
+            Map map
+        )
+    {
+        radix_select(par, first, nth, last, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator>
+    void
+        radix_select
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator nth,
+            RandomAccessIterator last
+        )
+    {
+        radix_select(par, first, nth, last, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельного поразрядного поиска n-го элемента
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_select
+        (
+            parallel_policy par,
+            RandomAccessRange && range,
+            RandomAccessIterator nth,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::begin;
+        using std::end;
+        radix_select
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            nth,
+            end(std::forward<RandomAccessRange>(range)),
+            map,
+            radix
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void radix_select (parallel_policy par, RandomAccessRange && range, RandomAccessIterator nth, Map map)
+    {
+        using std::begin;
+        using std::end;
+        radix_select
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            nth,
+            end(std::forward<RandomAccessRange>(range)),
+            map
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void radix_select (parallel_policy par, RandomAccessRange && range, RandomAccessIterator nth)
+    {
+        using std::begin;
+        using std::end;
+        radix_select
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            nth,
+            end(std::forward<RandomAccessRange>(range))
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SELECT__RADIX_SELECT_PAR_HPP
@@ -0,0 +1,129 @@
+#ifndef BURST__ALGORITHM__RADIX_SELECT__RADIX_SELECT_SEQ_HPP
+#define BURST__ALGORITHM__RADIX_SELECT__RADIX_SELECT_SEQ_HPP
+
+#include <burst/algorithm/detail/radix_select.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Поразрядный поиск n-го элемента
+
+        \details
+            Аналог `std::nth_element` для элементов, отображаемых в целые числа. После вызова на
+            месте `nth` стоит тот элемент, который стоял бы там, если бы весь диапазон был
+            упорядочен по образам `map`. Все элементы до `nth` не больше его, а все элементы после
+            `nth` — не меньше.
+
+            Алгоритм работы
+
+            Разряды перебираются начиная со старшего. Для каждого разряда подсчитывается
+            количество элементов с каждым его значением, по этим счётчикам находится корзина, в
+            которую попадает n-й элемент, и диапазон разбивается на три части: элементы с
+            меньшим, равным и большим значением разряда. Дальнейший поиск ведётся только внутри
+            средней части. Короткие диапазоны досматриваются сравнениями.
+
+            Время работы — `O(N * R)` в худшем случае, где `N` — размер диапазона, `R` —
+            количество разрядов, а на практике, как правило, близко к `O(N)`, потому что уже после
+            первого разряда остаётся малая часть диапазона. Дополнительная память — `O(M)`, где
+            `M` — количество значений одного разряда. Буфер не нужен.
+
+            Алгоритм неустойчив.
+
+        \param [first, last)
+            Диапазон, в котором ищется элемент. Должен быть диапазоном произвольного доступа.
+        \param nth
+            Позиция искомого элемента в упорядоченном диапазоне. Если `nth == last`, то ничего не
+            происходит.
+        \param map
+            Отображение входных объектов в целые числа. Имеет тот же смысл, что и в `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в `radix_sort`.
+
+        \see radix_sort
+        \see radix_partial_sort
+     */
+    template <typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_select
+        (
+            RandomAccessIterator first,
+            RandomAccessIterator nth,
+            RandomAccessIterator last,
+            Map map,
+            Radix radix
+        )
+    {
+        detail::radix_select_impl(first, nth, last, compose(shift_to_unsigned, std::move(map)), radix);
+    }
+
+    template <typename RandomAccessIterator, typename Map>
+    void radix_select (RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Map map)
+    {
+        radix_select(first, nth, last, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator>
+    void radix_select (RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+    {
+        radix_select(first, nth, last, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант поразрядного поиска n-го элемента
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    void radix_select (RandomAccessRange && range, RandomAccessIterator nth, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        radix_select
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            nth,
+            end(std::forward<RandomAccessRange>(range)),
+            map,
+            radix
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void radix_select (RandomAccessRange && range, RandomAccessIterator nth, Map map)
+    {
+        using std::begin;
+        using std::end;
+        radix_select
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            nth,
+            end(std::forward<RandomAccessRange>(range)),
+            map
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void radix_select (RandomAccessRange && range, RandomAccessIterator nth)
+    {
+        using std::begin;
+        using std::end;
+        radix_select
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            nth,
+            end(std::forward<RandomAccessRange>(range))
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SELECT__RADIX_SELECT_SEQ_HPP
@@ -0,0 +1,116 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT__ADAPTIVE_RADIX_HPP
+#define BURST__ALGORITHM__RADIX_SORT__ADAPTIVE_RADIX_HPP
+
+#include <burst/functional/low_bits.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/type_traits/is_integer.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+
+namespace burst
+{
+    /*!
+        \brief
+            Адаптивный выбор ширины разряда поразрядной сортировки
+
+        \details
+            Если передать этот тег в поразрядную сортировку вместо функции выделения разряда, то
+            ширина разряда будет выбрана исходя из разрядности сортируемых чисел и размера
+            сортируемого диапазона:
+
+            -   На небольших диапазонах используются 8-битные разряды: счётчиков мало, и их
+                обработка почти ничего не стоит.
+            -   На средних диапазонах 32- и 64-битных чисел используются 11-битные разряды. Так
+                32-битные числа сортируются за три прохода вместо четырёх, а все счётчики всё ещё
+                помещаются в кэш.
+            -   На больших диапазонах используются 16-битные разряды, потому что стоимость прохода
+                по массиву начинает преобладать над стоимостью обработки 65536 счётчиков.
+
+            Ширина выбирается во время исполнения среди нескольких вариантов, каждый из которых
+            инстанцируется на этапе компиляции.
+
+        \see low_bits
+     */
+    struct adaptive_radix_fn
+    {
+    };
+    constexpr auto adaptive_radix = adaptive_radix_fn{};
+
+    namespace detail
+    {
+        //!     Размер диапазона, начиная с которого используются 11-битные разряды.
+        template <std::size_t IntegerBitCount>
+        struct adaptive_radix_thresholds
+        {
+            constexpr static std::size_t eleven_bits = std::size_t{1} << (IntegerBitCount <= 32 ? 14 : 18);
+            constexpr static std::size_t sixteen_bits = std::size_t{1} << (IntegerBitCount <= 16 ? 23 : 22);
+        };
+
+        template <typename UnaryFunction>
+        decltype(auto) with_adaptive_radix (std::size_t, UnaryFunction && f, std::integral_constant<std::size_t, 8>)
+        {
+            return f(low_byte);
+        }
+
+        //!     11-битные разряды не уменьшают количество проходов для 16-битных чисел.
+        template <typename UnaryFunction>
+        decltype(auto) with_adaptive_radix (std::size_t range_size, UnaryFunction && f, std::integral_constant<std::size_t, 16>)
+        {
+            using thresholds = adaptive_radix_thresholds<16>;
+            if (range_size < thresholds::sixteen_bits)
+            {
+                return f(low_byte);
+            }
+            else
+            {
+                return f(low_bits<16>);
+            }
+        }
+
+        template <typename UnaryFunction, std::size_t IntegerBitCount>
+        decltype(auto) with_adaptive_radix (std::size_t range_size, UnaryFunction && f, std::integral_constant<std::size_t, IntegerBitCount>)
+        {
+            using thresholds = adaptive_radix_thresholds<IntegerBitCount>;
+            if (range_size < thresholds::eleven_bits)
+            {
+                return f(low_byte);
+            }
+            else if (range_size < thresholds::sixteen_bits)
+            {
+                return f(low_bits<11>);
+            }
+            else
+            {
+                return f(low_bits<16>);
+            }
+        }
+
+        /*!
+            \brief
+                Вызов функции с выбранной функцией выделения разряда
+
+            \details
+                Выбирает ширину разряда для сортировки `range_size` чисел типа `Integer` и
+                вызывает `f` с соответствующей функцией выделения разряда.
+
+            \see adaptive_radix
+         */
+        template <typename Integer, typename UnaryFunction>
+        decltype(auto) with_adaptive_radix (std::size_t range_size, UnaryFunction && f)
+        {
+            static_assert(is_unsigned_integer<Integer>::value, "");
+            constexpr auto bit_count = sizeof(Integer) * CHAR_BIT;
+            return
+                with_adaptive_radix
+                (
+                    range_size,
+                    std::forward<UnaryFunction>(f),
+                    std::integral_constant<std::size_t, bit_count>{}
+                );
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT__ADAPTIVE_RADIX_HPP
@@ -0,0 +1,33 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT__CACHE_KEYS_HPP
+#define BURST__ALGORITHM__RADIX_SORT__CACHE_KEYS_HPP
+
+namespace burst
+{
+    /*!
+        \brief
+            Сортировка по заранее вычисленным ключам
+
+        \details
+            Если передать этот тег в поразрядную сортировку вместо стратегии распределения, то
+            отображение `map` будет вызвано ровно один раз для каждого элемента. Полученные
+            ключи вместе с номерами элементов записываются в отдельный массив, который и
+            сортируется поразрядно, а исходные элементы переставляются в нужном порядке один
+            раз в самом конце.
+
+            Выгодно, если отображение дорогое (например, разыменовывает указатель или
+            преобразует число с плавающей запятой), или если элементы велики по сравнению с
+            ключом, потому что на каждом проходе переносятся только пары из ключа и номера.
+            Требует дополнительной памяти под два массива таких пар.
+
+            Для крупных элементов этот режим включается автоматически (см. `direct_scatter`).
+
+        \see direct_scatter
+        \see write_combining
+     */
+    struct cache_keys_fn
+    {
+    };
+    constexpr auto cache_keys = cache_keys_fn{};
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT__CACHE_KEYS_HPP
@@ -1,19 +1,26 @@
 #ifndef BURST__ALGORITHM__RADIX_SORT__RADIX_SORT_PAR_HPP
 #define BURST__ALGORITHM__RADIX_SORT__RADIX_SORT_PAR_HPP
 
+#include <burst/algorithm/detail/composite_key.hpp>
 #include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_cached_key_radix_sort.hpp>
 #include <burst/algorithm/detail/parallel_radix_sort.hpp>
 #include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_sort/adaptive_radix.hpp>
 #include <burst/algorithm/radix_sort/radix_sort_seq.hpp>
+#include <burst/algorithm/write_combining.hpp>
 #include <burst/execution/parallel_policy.hpp>
 #include <burst/functional/compose.hpp>
 #include <burst/functional/identity.hpp>
 #include <burst/functional/low_byte.hpp>
 #include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_value.hpp>
 
-#include <boost/asio/thread_pool.hpp>
-
+#include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace burst
@@ -24,7 +31,8 @@ namespace burst
 
         \details
             Пытается создать пул с указанным количеством рабочих потоков и вызвать параллельную
-            реализацию поразрядки.
+            реализацию поразрядки. Если в `par` передан пул потоков, то новый пул не создаётся, а
+            сортировка исполняется в переданном.
             Если потоков указано слишком мало (меньше двух) или диапазон слишком маленький, чтобы
             сортировать его в указанном количестве потоков, то происходит откат на последовательный
             вариант алгоритма.
@@ -53,29 +61,110 @@ namespace burst
             Map map,
             Radix radix
         )
+    {
+        radix_sort(par, first, last, buffer, std::move(map), std::move(radix), direct_scatter);
+    }
+
+    /*!
+        \brief
+            Параллельная поразрядная сортировка с выбранной стратегией распределения
+
+        \details
+            Каждый поток распределяет элементы своего куска способом, заданным последним
+            аргументом: `direct_scatter` (по умолчанию) или `write_combining`. Тег `cache_keys`
+            включает сортировку по заранее вычисленным ключам, которые вычисляются, а затем
+            переставляются тоже параллельно.
+
+        \see write_combining
+        \see cache_keys
+     */
+    template
+    <
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename Map,
+        typename Radix,
+        typename Scatter
+    >
+    void
+        radix_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            Radix radix,
+            Scatter scatter
+        )
     {
         const auto shape = detail::get_shape(par, first, last);
         const auto thread_count = shape[0];
         if (thread_count > 1)
         {
-            boost::asio::thread_pool pool(thread_count);
-            detail::radix_sort_impl
-            (
-                pool,
-                shape,
-                first,
-                last,
-                buffer,
-                compose(shift_to_unsigned, std::move(map)),
-                radix
-            );
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & last, & buffer, & map, & radix, & scatter] (auto & pool)
+                {
+                    detail::for_each_key_word<value_type>(std::move(map),
+                        [& pool, & shape, & first, & last, & buffer, & radix, & scatter] (auto key)
+                        {
+                            detail::radix_sort_by_key(pool, shape, first, last, buffer, std::move(key), radix, scatter);
+                        });
+                });
         }
         else
         {
-            radix_sort(first, last, buffer, map, radix);
+            radix_sort(first, last, buffer, map, radix, scatter);
         }
     }
 
+    /*!
+        \brief
+            Параллельная поразрядная сортировка с адаптивной шириной разряда
+
+        \see adaptive_radix
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    void
+        radix_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            adaptive_radix_fn
+        )
+    {
+        radix_sort(par, first, last, buffer, std::move(map), adaptive_radix, direct_scatter);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Scatter>
+    void
+        radix_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            adaptive_radix_fn,
+            Scatter scatter
+        )
+    {
+        using value_type = iterator_value_t<RandomAccessIterator1>;
+        using first_word_type = std::decay_t<invoke_result_t<decltype(detail::first_key_word<value_type>(map)), value_type>>;
+
+        using std::distance;
+        const auto range_size = static_cast<std::size_t>(distance(first, last));
+        detail::with_adaptive_radix<first_word_type>(range_size,
+            [& par, & first, & last, & buffer, & map, & scatter] (auto radix)
+            {
+                radix_sort(par, first, last, buffer, map, radix, scatter);
+            });
+    }
+
     template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
     void
         radix_sort
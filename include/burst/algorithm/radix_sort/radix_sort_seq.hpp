@@ -1,13 +1,21 @@
 #ifndef BURST__ALGORITHM__RADIX_SORT__RADIX_SORT_SEQ_HPP
 #define BURST__ALGORITHM__RADIX_SORT__RADIX_SORT_SEQ_HPP
 
+#include <burst/algorithm/detail/cached_key_radix_sort.hpp>
+#include <burst/algorithm/detail/composite_key.hpp>
 #include <burst/algorithm/detail/radix_sort.hpp>
+#include <burst/algorithm/radix_sort/adaptive_radix.hpp>
+#include <burst/algorithm/radix_sort/cache_keys.hpp>
+#include <burst/algorithm/write_combining.hpp>
 #include <burst/functional/compose.hpp>
 #include <burst/functional/identity.hpp>
 #include <burst/functional/low_byte.hpp>
 #include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
@@ -110,39 +118,249 @@ namespace burst
             Radix radix
         )
     {
-        using difference_type = iterator_difference_t<RandomAccessIterator1>;
-        using min_type =
-            typename std::conditional
-            <
-                sizeof(std::int32_t) < sizeof(difference_type),
-                std::int32_t,
-                difference_type
-            >
-            ::type;
+        radix_sort(first, last, buffer, std::move(map), std::move(radix), direct_scatter);
+    }
 
-        using std::distance;
-        if (distance(first, last) <= std::numeric_limits<min_type>::max())
+    namespace detail
+    {
+        template
+        <
+            typename Counter,
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Key,
+            typename Radix,
+            typename Scatter
+        >
+        void
+            radix_sort_by_key_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                Scatter scatter
+            )
         {
-            detail::radix_sort_impl<min_type>
+            radix_sort_impl<Counter>(first, last, buffer, std::move(key), radix, scatter);
+        }
+
+        /*!
+            \brief
+                Прямое распределение с автоматическим выбором сортировки по вычисленным ключам
+
+            \details
+                Если элементы велики по сравнению с ключом, проходов больше двух, а диапазон
+                достаточно большой, то вместо самих элементов поразрядно сортируются пары из
+                ключа и номера элемента.
+
+            \see is_key_cache_profitable
+            \see cache_keys
+         */
+        template
+        <
+            typename Counter,
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Key,
+            typename Radix
+        >
+        void
+            radix_sort_by_key_impl
             (
-                first,
-                last,
-                buffer,
-                compose(shift_to_unsigned, std::move(map)),
-                radix
-            );
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                direct_scatter_fn scatter
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+
+            using std::distance;
+            if (is_key_cache_profitable<value_type, Key, Radix>::value && distance(first, last) >= key_cache_threshold)
+            {
+                cached_key_radix_sort_impl<Counter>(first, last, buffer, std::move(key), radix);
+            }
+            else
+            {
+                radix_sort_impl<Counter>(first, last, buffer, std::move(key), radix, scatter);
+            }
         }
-        else
+
+        template
+        <
+            typename Counter,
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Key,
+            typename Radix
+        >
+        void
+            radix_sort_by_key_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                cache_keys_fn
+            )
         {
-            detail::radix_sort_impl<difference_type>
+            cached_key_radix_sort_impl<Counter>(first, last, buffer, std::move(key), radix);
+        }
+
+        /*!
+            \brief
+                Поразрядная сортировка по ключу, уже приведённому к беззнаковому целому
+
+            \details
+                Выбирает тип счётчиков: если диапазон позволяет, то используются 32-битные
+                счётчики, которые занимают меньше места в кэше.
+         */
+        template
+        <
+            typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Key,
+            typename Radix,
+            typename Scatter
+        >
+        void
+            radix_sort_by_key
             (
-                first,
-                last,
-                buffer,
-                compose(shift_to_unsigned, std::move(map)),
-                radix
-            );
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Key key,
+                Radix radix,
+                Scatter scatter
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            using min_type =
+                typename std::conditional
+                <
+                    sizeof(std::int32_t) < sizeof(difference_type),
+                    std::int32_t,
+                    difference_type
+                >
+                ::type;
+
+            using std::distance;
+            if (distance(first, last) <= std::numeric_limits<min_type>::max())
+            {
+                radix_sort_by_key_impl<min_type>(first, last, buffer, std::move(key), radix, scatter);
+            }
+            else
+            {
+                radix_sort_by_key_impl<difference_type>(first, last, buffer, std::move(key), radix, scatter);
+            }
         }
+    } // namespace detail
+
+    /*!
+        \brief
+            Поразрядная сортировка с выбранной стратегией распределения
+
+        \details
+            Последний аргумент задаёт способ, которым элементы распределяются по корзинам на каждом
+            проходе: `direct_scatter` (по умолчанию) или `write_combining`. Кроме того, можно
+            передать `cache_keys`, и тогда сортироваться будут не сами элементы, а заранее
+            вычисленные ключи вместе с номерами элементов. При прямом распределении так
+            происходит автоматически, если элементы хотя бы вдвое больше таких пар.
+
+            Отображение `map` может возвращать не только целое число, но и составной ключ —
+            `std::tuple` или `std::pair` из целых чисел и чисел с плавающей запятой. Тогда элементы
+            упорядочиваются лексикографически по полям ключа. Каждое поле приводится к
+            упорядоченному беззнаковому целому (см. `to_ordered_integral`), и поля упаковываются
+            в число из стольких битов, сколько они занимают в сумме. Сортировка делает проходы
+            только по этим битам. Ключ шире 64 битов делится на 64-битные слова, и элементы
+            сортируются по словам начиная с младшего.
+
+        \see write_combining
+        \see cache_keys
+        \see to_ordered_integral
+     */
+    template
+    <
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename Map,
+        typename Radix,
+        typename Scatter
+    >
+    void
+        radix_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            Radix radix,
+            Scatter scatter
+        )
+    {
+        using value_type = iterator_value_t<RandomAccessIterator1>;
+        detail::for_each_key_word<value_type>(std::move(map),
+            [& first, & last, & buffer, & radix, & scatter] (auto key)
+            {
+                detail::radix_sort_by_key(first, last, buffer, std::move(key), radix, scatter);
+            });
+    }
+
+    /*!
+        \brief
+            Поразрядная сортировка с адаптивной шириной разряда
+
+        \details
+            Вместо фиксированной функции выделения разряда ширина разряда выбирается исходя из
+            разрядности образов `map` и размера сортируемого диапазона.
+
+        \see adaptive_radix
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    void
+        radix_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            adaptive_radix_fn
+        )
+    {
+        radix_sort(first, last, buffer, std::move(map), adaptive_radix, direct_scatter);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Scatter>
+    void
+        radix_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            adaptive_radix_fn,
+            Scatter scatter
+        )
+    {
+        using value_type = iterator_value_t<RandomAccessIterator1>;
+
+        using std::distance;
+        const auto range_size = static_cast<std::size_t>(distance(first, last));
+        detail::for_each_key_word<value_type>(std::move(map),
+            [range_size, & first, & last, & buffer, & scatter] (auto key)
+            {
+                using integer_type = std::decay_t<invoke_result_t<decltype(key), value_type>>;
+                detail::with_adaptive_radix<integer_type>(range_size,
+                    [& first, & last, & buffer, & key, & scatter] (auto radix)
+                    {
+                        detail::radix_sort_by_key(first, last, buffer, key, radix, scatter);
+                    });
+            });
     }
 
     template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_COUNT_HPP
+#define BURST__ALGORITHM__RADIX_SORT_COUNT_HPP
+
+#include <burst/algorithm/radix_sort_count/radix_sort_count_par.hpp>
+#include <burst/algorithm/radix_sort_count/radix_sort_count_seq.hpp>
+
+#endif // BURST__ALGORITHM__RADIX_SORT_COUNT_HPP
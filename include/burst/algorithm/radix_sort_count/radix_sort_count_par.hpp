@@ -0,0 +1,227 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_COUNT__RADIX_SORT_COUNT_PAR_HPP
+#define BURST__ALGORITHM__RADIX_SORT_COUNT__RADIX_SORT_COUNT_PAR_HPP
+
+#include <burst/algorithm/detail/composite_key.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort_unique.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_par.hpp>
+#include <burst/algorithm/radix_sort_count/radix_sort_count_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Map, typename Radix>
+        RandomAccessIterator3
+            radix_sort_count_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                RandomAccessIterator3 result,
+                Map map,
+                Radix radix,
+                std::false_type
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            const auto chunk_size = static_cast<difference_type>(shape[1]);
+
+            auto key = compose(shift_to_unsigned, std::move(map));
+            auto finish = parallel_count_finish<RandomAccessIterator1, RandomAccessIterator3, decltype(key)>{&pool, chunk_size, first, result, key};
+            return radix_sort_and_finish(pool, shape, first, last, buffer, std::move(key), radix, std::move(finish));
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Map, typename Radix>
+        RandomAccessIterator3
+            radix_sort_count_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                RandomAccessIterator3 result,
+                Map map,
+                Radix radix,
+                std::true_type
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            const auto chunk_size = static_cast<difference_type>(shape[1]);
+
+            for_each_key_word<value_type>(map,
+                [& pool, & shape, & first, & last, & buffer, & radix] (auto key)
+                {
+                    radix_sort_by_key(pool, shape, first, last, buffer, std::move(key), radix, direct_scatter);
+                });
+
+            auto finish = parallel_count_finish<RandomAccessIterator1, RandomAccessIterator3, Map>{&pool, chunk_size, first, result, std::move(map)};
+            return finish.in_place(first, last);
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Параллельный вариант поразрядной сортировки с подсчётом повторов
+
+        \details
+            Сортирует диапазон параллельно, после чего каждый поток находит начала групп
+            равных образов в своём куске и записывает пары для групп, которые в нём начинаются.
+            Группа, пересекающая границу кусков, учитывается один раз, целиком.
+            Номера пар вычисляются заранее, поэтому выходной итератор должен быть итератором
+            произвольного доступа.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \see radix_sort_count_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Map, typename Radix>
+    RandomAccessIterator3
+        radix_sort_count
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            RandomAccessIterator3 result,
+            Map map,
+            Radix radix
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using key_type = std::decay_t<invoke_result_t<Map, value_type>>;
+
+            return
+                detail::with_thread_pool(par, thread_count,
+                    [& shape, & first, & last, & buffer, & result, & map, & radix] (auto & pool)
+                    {
+                        return
+                            detail::radix_sort_count_impl(pool, shape, first, last, buffer, result, std::move(map), radix,
+                                detail::is_composite_key<key_type>{});
+                    });
+        }
+        else
+        {
+            return radix_sort_count(first, last, buffer, result, map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Map>
+    RandomAccessIterator3
+        radix_sort_count
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            RandomAccessIterator3 result,
+            Map map
+        )
+    {
+        return radix_sort_count(par, first, last, buffer, result, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3>
+    RandomAccessIterator3
+        radix_sort_count
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            RandomAccessIterator3 result
+        )
+    {
+        return radix_sort_count(par, first, last, buffer, result, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной поразрядной сортировки с подсчётом повторов
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+    RandomAccessIterator2
+        radix_sort_count
+        (
+            parallel_policy par,
+            RandomAccessRange && range,
+            RandomAccessIterator1 buffer,
+            RandomAccessIterator2 result,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_count
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                result,
+                map,
+                radix
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    RandomAccessIterator2 radix_sort_count (parallel_policy par, RandomAccessRange && range, RandomAccessIterator1 buffer, RandomAccessIterator2 result, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_count
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                result,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator2 radix_sort_count (parallel_policy par, RandomAccessRange && range, RandomAccessIterator1 buffer, RandomAccessIterator2 result)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_count
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                result
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT_COUNT__RADIX_SORT_COUNT_PAR_HPP
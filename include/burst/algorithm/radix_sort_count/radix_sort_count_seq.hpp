@@ -0,0 +1,192 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_COUNT__RADIX_SORT_COUNT_SEQ_HPP
+#define BURST__ALGORITHM__RADIX_SORT_COUNT__RADIX_SORT_COUNT_SEQ_HPP
+
+#include <burst/algorithm/detail/composite_key.hpp>
+#include <burst/algorithm/detail/radix_sort_unique.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_seq.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Map, typename Radix>
+        OutputIterator
+            radix_sort_count_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                OutputIterator result,
+                Map map,
+                Radix radix,
+                std::false_type
+            )
+        {
+            auto key = compose(shift_to_unsigned, std::move(map));
+            auto finish = count_finish<RandomAccessIterator1, OutputIterator, decltype(key)>{first, result, key};
+            return radix_sort_and_finish(first, last, buffer, std::move(key), radix, std::move(finish));
+        }
+
+        //!     Составной ключ сортируется по словам, поэтому группы считаются отдельным проходом.
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Map, typename Radix>
+        OutputIterator
+            radix_sort_count_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                OutputIterator result,
+                Map map,
+                Radix radix,
+                std::true_type
+            )
+        {
+            radix_sort(first, last, buffer, map, radix);
+            return count_finish<RandomAccessIterator1, OutputIterator, Map>{first, result, std::move(map)}.in_place(first, last);
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Поразрядная сортировка с подсчётом повторов
+
+        \details
+            Упорядочивает диапазон так же, как `radix_sort`, и для каждой группы элементов с
+            равными образами `map` записывает в выходной итератор пару
+            `std::pair<value_type, difference_type>` из первого элемента группы и количества
+            элементов в ней. Пары идут в порядке возрастания образов.
+            Подсчёт совмещён с переносом отсортированной последовательности из буфера во входной
+            диапазон, поэтому по сравнению с одной лишь сортировкой дополнительных проходов по
+            диапазону не требуется, если последовательность после сортировки оказалась в буфере,
+            и требуется не больше одного в противном случае.
+
+        \param [first, last)
+            Сортируемый диапазон. Должен быть диапазоном произвольного доступа.
+        \param buffer
+            Итератор на начало буфера, размер которого не меньше размера сортируемого
+            диапазона.
+        \param result
+            Выходной итератор, в который записываются пары.
+        \param map
+            Отображение входных объектов в целые числа или составные ключи. Имеет тот же смысл,
+            что и в `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в `radix_sort`.
+
+        \returns
+            Итератор за последней записанной парой.
+
+        \see radix_sort
+        \see radix_sort_unique
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Map, typename Radix>
+    OutputIterator
+        radix_sort_count
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            OutputIterator result,
+            Map map,
+            Radix radix
+        )
+    {
+        using value_type = iterator_value_t<RandomAccessIterator1>;
+        using key_type = std::decay_t<invoke_result_t<Map, value_type>>;
+        return detail::radix_sort_count_impl(first, last, buffer, result, std::move(map), radix, detail::is_composite_key<key_type>{});
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Map>
+    OutputIterator
+        radix_sort_count
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            OutputIterator result,
+            Map map
+        )
+    {
+        return radix_sort_count(first, last, buffer, result, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+    OutputIterator
+        radix_sort_count
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            OutputIterator result
+        )
+    {
+        return radix_sort_count(first, last, buffer, result, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант поразрядной сортировки с подсчётом повторов
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename OutputIterator, typename Map, typename Radix>
+    OutputIterator radix_sort_count (RandomAccessRange && range, RandomAccessIterator buffer, OutputIterator result, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_count
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                result,
+                map,
+                radix
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename OutputIterator, typename Map>
+    OutputIterator radix_sort_count (RandomAccessRange && range, RandomAccessIterator buffer, OutputIterator result, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_count
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                result,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename OutputIterator>
+    OutputIterator radix_sort_count (RandomAccessRange && range, RandomAccessIterator buffer, OutputIterator result)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_count
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                result
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT_COUNT__RADIX_SORT_COUNT_SEQ_HPP
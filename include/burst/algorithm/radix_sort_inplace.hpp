@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_INPLACE_HPP
+#define BURST__ALGORITHM__RADIX_SORT_INPLACE_HPP
+
+#include <burst/algorithm/radix_sort_inplace/radix_sort_inplace_par.hpp>
+#include <burst/algorithm/radix_sort_inplace/radix_sort_inplace_seq.hpp>
+
+#endif // BURST__ALGORITHM__RADIX_SORT_INPLACE_HPP
@@ -0,0 +1,137 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_INPLACE__RADIX_SORT_INPLACE_PAR_HPP
+#define BURST__ALGORITHM__RADIX_SORT_INPLACE__RADIX_SORT_INPLACE_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort_inplace.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_sort_inplace/radix_sort_inplace_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант поразрядной сортировки на месте
+
+        \details
+            Счётчики всех разрядов собираются параллельно за один проход. Затем весь диапазон
+            распределяется по старшему из различающихся разрядов, после чего полученные корзины
+            сортируются независимо друг от друга в разных потоках.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see radix_sort_inplace_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        radix_sort_inplace
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            Map map,
+            Radix radix
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & last, & map, & radix] (auto & pool)
+                {
+                    detail::radix_sort_inplace_impl
+                    (
+                        pool,
+                        shape,
+                        first,
+                        last,
+                        compose(shift_to_unsigned, std::move(map)),
+                        radix
+                    );
+                });
+        }
+        else
+        {
+            radix_sort_inplace(first, last, map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator, typename Map>
+    void
+        radix_sort_inplace
+        (
+            parallel_policy par,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            Map map
+        )
+    {
+        radix_sort_inplace(par, first, last, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator>
+    void radix_sort_inplace (parallel_policy par, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        radix_sort_inplace(par, first, last, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной поразрядной сортировки на месте
+     */
+    template <typename RandomAccessRange, typename Map, typename Radix>
+    void radix_sort_inplace (parallel_policy par, RandomAccessRange && range, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        radix_sort_inplace
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            map,
+            radix
+        );
+    }
+
+    template <typename RandomAccessRange, typename Map>
+    void radix_sort_inplace (parallel_policy par, RandomAccessRange && range, Map map)
+    {
+        using std::begin;
+        using std::end;
+        radix_sort_inplace
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            map
+        );
+    }
+
+    template <typename RandomAccessRange>
+    void radix_sort_inplace (parallel_policy par, RandomAccessRange && range)
+    {
+        using std::begin;
+        using std::end;
+        radix_sort_inplace
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range))
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT_INPLACE__RADIX_SORT_INPLACE_PAR_HPP
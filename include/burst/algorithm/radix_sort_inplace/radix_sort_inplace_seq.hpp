@@ -0,0 +1,118 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_INPLACE__RADIX_SORT_INPLACE_SEQ_HPP
+#define BURST__ALGORITHM__RADIX_SORT_INPLACE__RADIX_SORT_INPLACE_SEQ_HPP
+
+#include <burst/algorithm/detail/radix_sort_inplace.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Поразрядная сортировка на месте
+
+        \details
+            Алгоритм поразрядной сортировки, начинающий со старшего разряда и переставляющий
+            элементы внутри исходного диапазона (так называемая сортировка "американский флаг").
+            В отличие от `radix_sort`, не требует буфера размера входного диапазона:
+            дополнительная память — `O(M * R)`, где `M` — количество значений одного разряда,
+            `R` — количество разрядов.
+
+            Алгоритм работы
+
+            1.  Подсчитывается количество элементов с каждым значением старшего разряда, и по
+                этим счётчикам вычисляются границы корзин.
+            2.  Элементы переставляются по корзинам циклами обменов прямо во входном диапазоне.
+            3.  Каждая корзина рекурсивно сортируется по следующему разряду.
+
+            Разряды, значения которых одинаковы у всех элементов сортируемого куска,
+            пропускаются. Короткие куски сортируются сравнениями.
+
+            Алгоритм неустойчив.
+
+        \param first
+            Итератор на начало сортируемого диапазона.
+            Должен быть итератором произвольного доступа.
+        \param last
+            Итератор конца сортируемого диапазона.
+        \param map
+            Отображение входных объектов в целые числа. Имеет тот же смысл, что и в
+            `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в
+            `radix_sort`.
+
+        \see radix_sort
+     */
+    template <typename RandomAccessIterator, typename Map, typename Radix>
+    void radix_sort_inplace (RandomAccessIterator first, RandomAccessIterator last, Map map, Radix radix)
+    {
+        detail::radix_sort_inplace_impl(first, last, compose(shift_to_unsigned, std::move(map)), radix);
+    }
+
+    template <typename RandomAccessIterator, typename Map>
+    void radix_sort_inplace (RandomAccessIterator first, RandomAccessIterator last, Map map)
+    {
+        radix_sort_inplace(first, last, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator>
+    void radix_sort_inplace (RandomAccessIterator first, RandomAccessIterator last)
+    {
+        radix_sort_inplace(first, last, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант поразрядной сортировки на месте
+
+        \details
+            Отличается только тем, что сортируемые значения задаются не парой итераторов, а
+            диапазоном.
+     */
+    template <typename RandomAccessRange, typename Map, typename Radix>
+    void radix_sort_inplace (RandomAccessRange && range, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        radix_sort_inplace
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            map,
+            radix
+        );
+    }
+
+    template <typename RandomAccessRange, typename Map>
+    void radix_sort_inplace (RandomAccessRange && range, Map map)
+    {
+        using std::begin;
+        using std::end;
+        radix_sort_inplace
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            map
+        );
+    }
+
+    template <typename RandomAccessRange>
+    void radix_sort_inplace (RandomAccessRange && range)
+    {
+        using std::begin;
+        using std::end;
+        radix_sort_inplace
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range))
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT_INPLACE__RADIX_SORT_INPLACE_SEQ_HPP
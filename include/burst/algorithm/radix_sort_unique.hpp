@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_UNIQUE_HPP
+#define BURST__ALGORITHM__RADIX_SORT_UNIQUE_HPP
+
+#include <burst/algorithm/radix_sort_unique/radix_sort_unique_par.hpp>
+#include <burst/algorithm/radix_sort_unique/radix_sort_unique_seq.hpp>
+
+#endif // BURST__ALGORITHM__RADIX_SORT_UNIQUE_HPP
@@ -0,0 +1,202 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_UNIQUE__RADIX_SORT_UNIQUE_PAR_HPP
+#define BURST__ALGORITHM__RADIX_SORT_UNIQUE__RADIX_SORT_UNIQUE_PAR_HPP
+
+#include <burst/algorithm/detail/composite_key.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_radix_sort_unique.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_par.hpp>
+#include <burst/algorithm/radix_sort_unique/radix_sort_unique_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        RandomAccessIterator1
+            radix_sort_unique_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                std::false_type
+            )
+        {
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            const auto chunk_size = static_cast<difference_type>(shape[1]);
+
+            auto key = compose(shift_to_unsigned, std::move(map));
+            auto finish = parallel_unique_finish<RandomAccessIterator1, RandomAccessIterator2, decltype(key)>{&pool, chunk_size, first, buffer, key};
+            return radix_sort_and_finish(pool, shape, first, last, buffer, std::move(key), radix, std::move(finish));
+        }
+
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        RandomAccessIterator1
+            radix_sort_unique_impl
+            (
+                boost::asio::thread_pool & pool,
+                const std::array<std::size_t, 2> & shape,
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                std::true_type
+            )
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using difference_type = iterator_difference_t<RandomAccessIterator1>;
+            const auto chunk_size = static_cast<difference_type>(shape[1]);
+
+            for_each_key_word<value_type>(map,
+                [& pool, & shape, & first, & last, & buffer, & radix] (auto key)
+                {
+                    radix_sort_by_key(pool, shape, first, last, buffer, std::move(key), radix, direct_scatter);
+                });
+
+            auto finish = parallel_unique_finish<RandomAccessIterator1, RandomAccessIterator2, Map>{&pool, chunk_size, first, buffer, std::move(map)};
+            return finish.in_place(first, last);
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Параллельный вариант поразрядной сортировки с удалением повторов
+
+        \details
+            Сортирует диапазон параллельно, после чего каждый поток находит начала групп
+            равных образов в своём куске, сравнивая первый элемент куска с последним элементом
+            предыдущего, так что группы, пересекающие границы кусков, не дробятся. Затем каждый
+            поток переносит свои неповторяющиеся элементы на заранее вычисленные места.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \see radix_sort_unique_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+    RandomAccessIterator1
+        radix_sort_unique
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            Radix radix
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            using value_type = iterator_value_t<RandomAccessIterator1>;
+            using key_type = std::decay_t<invoke_result_t<Map, value_type>>;
+
+            return
+                detail::with_thread_pool(par, thread_count,
+                    [& shape, & first, & last, & buffer, & map, & radix] (auto & pool)
+                    {
+                        return
+                            detail::radix_sort_unique_impl(pool, shape, first, last, buffer, std::move(map), radix,
+                                detail::is_composite_key<key_type>{});
+                    });
+        }
+        else
+        {
+            return radix_sort_unique(first, last, buffer, map, radix);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    RandomAccessIterator1
+        radix_sort_unique
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map
+        )
+    {
+        return radix_sort_unique(par, first, last, buffer, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator1 radix_sort_unique (parallel_policy par, RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer)
+    {
+        return radix_sort_unique(par, first, last, buffer, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной поразрядной сортировки с удалением повторов
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    auto radix_sort_unique (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_unique
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                map,
+                radix
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    auto radix_sort_unique (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_unique
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    auto radix_sort_unique (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_unique
+            (
+                par,
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT_UNIQUE__RADIX_SORT_UNIQUE_PAR_HPP
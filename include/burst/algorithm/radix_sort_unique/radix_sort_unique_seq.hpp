@@ -0,0 +1,170 @@
+#ifndef BURST__ALGORITHM__RADIX_SORT_UNIQUE__RADIX_SORT_UNIQUE_SEQ_HPP
+#define BURST__ALGORITHM__RADIX_SORT_UNIQUE__RADIX_SORT_UNIQUE_SEQ_HPP
+
+#include <burst/algorithm/detail/composite_key.hpp>
+#include <burst/algorithm/detail/radix_sort_unique.hpp>
+#include <burst/algorithm/radix_sort/radix_sort_seq.hpp>
+#include <burst/functional/compose.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/integer/shift_to_unsigned.hpp>
+#include <burst/type_traits/invoke_result.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        RandomAccessIterator1
+            radix_sort_unique_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                std::false_type
+            )
+        {
+            auto key = compose(shift_to_unsigned, std::move(map));
+            auto finish = unique_finish<RandomAccessIterator1, decltype(key)>{first, key};
+            return radix_sort_and_finish(first, last, buffer, std::move(key), radix, std::move(finish));
+        }
+
+        //!     Составной ключ сортируется по словам, поэтому повторы удаляются отдельным проходом.
+        template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+        RandomAccessIterator1
+            radix_sort_unique_impl
+            (
+                RandomAccessIterator1 first,
+                RandomAccessIterator1 last,
+                RandomAccessIterator2 buffer,
+                Map map,
+                Radix radix,
+                std::true_type
+            )
+        {
+            radix_sort(first, last, buffer, map, radix);
+            return unique_finish<RandomAccessIterator1, Map>{first, std::move(map)}.in_place(first, last);
+        }
+    } // namespace detail
+
+    /*!
+        \brief
+            Поразрядная сортировка с удалением повторов
+
+        \details
+            Упорядочивает диапазон так же, как `radix_sort`, и оставляет в его начале по одному
+            элементу из каждой группы элементов с равными образами `map` (первому в порядке
+            устойчивой сортировки). Результат тот же, что и у `radix_sort` с последующим
+            `std::unique`, но удаление повторов совмещено с переносом отсортированной
+            последовательности из буфера во входной диапазон, поэтому вместо двух
+            дополнительных проходов по диапазону делается не больше одного.
+
+            Элементы за возвращённым итератором остаются в допустимом, но неопределённом
+            состоянии.
+
+        \param [first, last)
+            Сортируемый диапазон. Должен быть диапазоном произвольного доступа.
+        \param buffer
+            Итератор на начало буфера, размер которого не меньше размера сортируемого
+            диапазона.
+        \param map
+            Отображение входных объектов в целые числа или составные ключи. Имеет тот же смысл,
+            что и в `radix_sort`.
+        \param radix
+            Функция выделения разряда из целого числа. Имеет тот же смысл, что и в `radix_sort`.
+
+        \returns
+            Итератор на конец диапазона неповторяющихся элементов.
+
+        \see radix_sort
+        \see radix_sort_count
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map, typename Radix>
+    RandomAccessIterator1
+        radix_sort_unique
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map,
+            Radix radix
+        )
+    {
+        using value_type = iterator_value_t<RandomAccessIterator1>;
+        using key_type = std::decay_t<invoke_result_t<Map, value_type>>;
+        return detail::radix_sort_unique_impl(first, last, buffer, std::move(map), radix, detail::is_composite_key<key_type>{});
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    RandomAccessIterator1 radix_sort_unique (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer, Map map)
+    {
+        return radix_sort_unique(first, last, buffer, map, low_byte);
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    RandomAccessIterator1 radix_sort_unique (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer)
+    {
+        return radix_sort_unique(first, last, buffer, identity, low_byte);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант поразрядной сортировки с удалением повторов
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map, typename Radix>
+    auto radix_sort_unique (RandomAccessRange && range, RandomAccessIterator buffer, Map map, Radix radix)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_unique
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                map,
+                radix
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    auto radix_sort_unique (RandomAccessRange && range, RandomAccessIterator buffer, Map map)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_unique
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer,
+                map
+            );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    auto radix_sort_unique (RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        return
+            radix_sort_unique
+            (
+                begin(std::forward<RandomAccessRange>(range)),
+                end(std::forward<RandomAccessRange>(range)),
+                buffer
+            );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__RADIX_SORT_UNIQUE__RADIX_SORT_UNIQUE_SEQ_HPP
@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__SAMPLE_SORT_HPP
+#define BURST__ALGORITHM__SAMPLE_SORT_HPP
+
+#include <burst/algorithm/sample_sort/sample_sort_par.hpp>
+#include <burst/algorithm/sample_sort/sample_sort_seq.hpp>
+
+#endif // BURST__ALGORITHM__SAMPLE_SORT_HPP
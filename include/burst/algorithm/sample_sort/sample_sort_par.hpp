@@ -0,0 +1,112 @@
+#ifndef BURST__ALGORITHM__SAMPLE_SORT__SAMPLE_SORT_PAR_HPP
+#define BURST__ALGORITHM__SAMPLE_SORT__SAMPLE_SORT_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_sample_sort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/sample_sort/sample_sort_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельная сортировка выборкой
+
+        \details
+            Корзины элементов определяются и элементы распределяются по корзинам параллельно
+            по кускам, как в параллельной сортировке подсчётом, после чего корзины сортируются
+            независимо друг от друга в разных потоках.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+            Порядок `compare` вызывается из нескольких потоков одновременно.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see sample_sort_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+    void
+        sample_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Compare compare
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+
+        using std::distance;
+        if (thread_count > 1 && static_cast<std::size_t>(distance(first, last)) >= detail::sample_sort_threshold)
+        {
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & last, & buffer, & compare] (auto & pool)
+                {
+                    detail::sample_sort_impl(pool, shape, first, last, buffer, compare);
+                });
+        }
+        else
+        {
+            sample_sort(first, last, buffer, compare);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void
+        sample_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer
+        )
+    {
+        sample_sort(par, first, last, buffer, std::less<>{});
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной сортировки выборкой
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Compare>
+    void sample_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer, Compare compare)
+    {
+        using std::begin;
+        using std::end;
+        sample_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            compare
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void sample_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        sample_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__SAMPLE_SORT__SAMPLE_SORT_PAR_HPP
@@ -0,0 +1,111 @@
+#ifndef BURST__ALGORITHM__SAMPLE_SORT__SAMPLE_SORT_SEQ_HPP
+#define BURST__ALGORITHM__SAMPLE_SORT__SAMPLE_SORT_SEQ_HPP
+
+#include <burst/algorithm/detail/sample_sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Сортировка выборкой
+
+        \details
+            [Сортировка выборкой](https://en.wikipedia.org/wiki/Samplesort) — сортировка
+            сравнениями, которая не требует отображать элементы в целые числа и потому подходит
+            для любых ключей: строк, сравниваемых с учётом локали, составных ключей со сложным
+            порядком и т.п.
+
+            Алгоритм работы:
+            1.  Из диапазона берётся случайная выборка, по которой выбираются `2^L - 1`
+                разделителей, разбивающих диапазон на `2^L` корзин примерно равного размера.
+            2.  Разделители укладываются в неявное дерево поиска, по которому корзина каждого
+                элемента определяется без ветвлений за `L` сравнений.
+            3.  Элементы распределяются по корзинам в буфер так же, как в сортировке
+                подсчётом.
+            4.  Каждая корзина сортируется отдельно и переносится обратно в исходный диапазон.
+
+            Корзины достаточно малы, чтобы помещаться в кэш, поэтому на больших диапазонах
+            такая сортировка обычно быстрее `std::sort`. Маленькие диапазоны сортируются
+            с помощью `std::sort` напрямую.
+            Сортировка неустойчивая. Элементы должны быть копируемыми: разделители хранятся
+            в виде копий элементов.
+
+        \param [first, last)
+            Диапазон, который нужно отсортировать. Должен быть диапазоном произвольного доступа.
+        \param buffer
+            Начало буфера размера не меньше `|[first, last)|`.
+        \param compare
+            Строгий слабый порядок на элементах.
+
+        \see radix_sort
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+    void
+        sample_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Compare compare
+        )
+    {
+        using std::distance;
+        if (static_cast<std::size_t>(distance(first, last)) < detail::sample_sort_threshold)
+        {
+            std::sort(first, last, compare);
+        }
+        else
+        {
+            detail::sample_sort_impl(first, last, buffer, compare);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void sample_sort (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer)
+    {
+        sample_sort(first, last, buffer, std::less<>{});
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант сортировки выборкой
+
+        \details
+            Отличается только тем, что сортируемые значения задаются не парой итераторов, а
+            диапазоном.
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Compare>
+    void sample_sort (RandomAccessRange && range, RandomAccessIterator buffer, Compare compare)
+    {
+        using std::begin;
+        using std::end;
+        sample_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            compare
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void sample_sort (RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        sample_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__SAMPLE_SORT__SAMPLE_SORT_SEQ_HPP
@@ -0,0 +1,107 @@
+#ifndef BURST__ALGORITHM__SEGMENTED_RADIX_SORT__SEGMENTED_RADIX_SORT_PAR_HPP
+#define BURST__ALGORITHM__SEGMENTED_RADIX_SORT__SEGMENTED_RADIX_SORT_PAR_HPP
+
+#include <burst/algorithm/detail/composite_key.hpp>
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_segmented_radix_sort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/segmented_radix_sort/segmented_radix_sort_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант поразрядной сортировки множества отрезков
+
+        \details
+            Отрезки распределяются между потоками пачками примерно равного суммарного размера,
+            начиная с самых больших пачек. Каждая пачка сортируется последовательно со своими
+            счётчиками.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see segmented_radix_sort_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessRange, typename ForwardRange, typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        segmented_radix_sort
+        (
+            parallel_policy par,
+            RandomAccessRange && values,
+            const ForwardRange & segment_offsets,
+            RandomAccessIterator buffer,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::begin;
+        using std::end;
+        const auto first = begin(std::forward<RandomAccessRange>(values));
+        const auto last = end(std::forward<RandomAccessRange>(values));
+
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            using value_type = iterator_value_t<decltype(first)>;
+            using difference_type = iterator_difference_t<decltype(first)>;
+            const auto batch_size = shape[1] / detail::max_chunks_per_thread;
+            detail::with_thread_pool(par, thread_count,
+                [& first, & segment_offsets, & buffer, & map, & radix, batch_size] (auto & pool)
+                {
+                    detail::for_each_key_word<value_type>(std::move(map),
+                        [& pool, & first, & segment_offsets, & buffer, & radix, batch_size] (auto key)
+                        {
+                            detail::segmented_radix_sort_impl<difference_type>(pool, batch_size, first,
+                                begin(segment_offsets), end(segment_offsets), buffer, std::move(key), radix);
+                        });
+                });
+        }
+        else
+        {
+            segmented_radix_sort(std::forward<RandomAccessRange>(values), segment_offsets, buffer, std::move(map), std::move(radix));
+        }
+    }
+
+    template <typename RandomAccessRange, typename ForwardRange, typename RandomAccessIterator, typename Map>
+    void
+        segmented_radix_sort
+        (
+            parallel_policy par,
+            RandomAccessRange && values,
+            const ForwardRange & segment_offsets,
+            RandomAccessIterator buffer,
+            Map map
+        )
+    {
+        segmented_radix_sort(par, std::forward<RandomAccessRange>(values), segment_offsets, buffer, std::move(map), low_byte);
+    }
+
+    template <typename RandomAccessRange, typename ForwardRange, typename RandomAccessIterator>
+    void
+        segmented_radix_sort
+        (
+            parallel_policy par,
+            RandomAccessRange && values,
+            const ForwardRange & segment_offsets,
+            RandomAccessIterator buffer
+        )
+    {
+        segmented_radix_sort(par, std::forward<RandomAccessRange>(values), segment_offsets, buffer, identity);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__SEGMENTED_RADIX_SORT__SEGMENTED_RADIX_SORT_PAR_HPP
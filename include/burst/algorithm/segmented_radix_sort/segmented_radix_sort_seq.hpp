@@ -0,0 +1,99 @@
+#ifndef BURST__ALGORITHM__SEGMENTED_RADIX_SORT__SEGMENTED_RADIX_SORT_SEQ_HPP
+#define BURST__ALGORITHM__SEGMENTED_RADIX_SORT__SEGMENTED_RADIX_SORT_SEQ_HPP
+
+#include <burst/algorithm/detail/composite_key.hpp>
+#include <burst/algorithm/detail/segmented_radix_sort.hpp>
+#include <burst/functional/identity.hpp>
+#include <burst/functional/low_byte.hpp>
+#include <burst/type_traits/iterator_difference.hpp>
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Поразрядная сортировка множества отрезков за один вызов
+
+        \details
+            Диапазон `values` разбит на отрезки границами `segment_offsets`: отрезок с номером
+            `i` — это элементы с номерами `[segment_offsets[i], segment_offsets[i + 1])`. Каждый
+            отрезок сортируется независимо от остальных так же, как это сделала бы
+            `radix_sort`, и результат тот же, что и при вызове `radix_sort` для каждого отрезка.
+
+            В отличие от последовательных вызовов `radix_sort`, счётчики выделяются один раз
+            на все отрезки, а короткие отрезки упорядочиваются устойчивой сортировкой
+            вставками, потому что на них подготовка счётчиков обходится дороже самой
+            сортировки. Поэтому сортировка миллионов небольших отрезков не тратит основное
+            время на обнуление и суммирование счётчиков.
+
+            Алгоритм устойчив.
+
+        \param values
+            Сортируемый диапазон. Должен быть диапазоном произвольного доступа.
+        \param segment_offsets
+            Неубывающая последовательность границ отрезков — смещений от начала `values`.
+            Если границ меньше двух, то сортировать нечего.
+        \param buffer
+            Итератор на начало буфера, размер которого не меньше размера `values`.
+        \param map
+            Отображение элементов в целые числа (или составные ключи, см. `radix_sort`).
+        \param radix
+            Функция выделения разряда из целого числа.
+
+        \see radix_sort
+     */
+    template <typename RandomAccessRange, typename ForwardRange, typename RandomAccessIterator, typename Map, typename Radix>
+    void
+        segmented_radix_sort
+        (
+            RandomAccessRange && values,
+            const ForwardRange & segment_offsets,
+            RandomAccessIterator buffer,
+            Map map,
+            Radix radix
+        )
+    {
+        using std::begin;
+        using std::end;
+        using std::distance;
+        const auto first = begin(std::forward<RandomAccessRange>(values));
+        const auto range_size = distance(first, end(std::forward<RandomAccessRange>(values)));
+
+        using value_type = iterator_value_t<decltype(first)>;
+        using difference_type = iterator_difference_t<decltype(first)>;
+        using min_type = std::conditional_t<sizeof(std::int32_t) < sizeof(difference_type), std::int32_t, difference_type>;
+
+        detail::for_each_key_word<value_type>(std::move(map),
+            [& first, & segment_offsets, & buffer, & radix, range_size] (auto key)
+            {
+                if (range_size <= std::numeric_limits<min_type>::max())
+                {
+                    detail::segmented_radix_sort_impl<min_type>(first, begin(segment_offsets), end(segment_offsets), buffer, std::move(key), radix);
+                }
+                else
+                {
+                    detail::segmented_radix_sort_impl<difference_type>(first, begin(segment_offsets), end(segment_offsets), buffer, std::move(key), radix);
+                }
+            });
+    }
+
+    template <typename RandomAccessRange, typename ForwardRange, typename RandomAccessIterator, typename Map>
+    void segmented_radix_sort (RandomAccessRange && values, const ForwardRange & segment_offsets, RandomAccessIterator buffer, Map map)
+    {
+        segmented_radix_sort(std::forward<RandomAccessRange>(values), segment_offsets, buffer, std::move(map), low_byte);
+    }
+
+    template <typename RandomAccessRange, typename ForwardRange, typename RandomAccessIterator>
+    void segmented_radix_sort (RandomAccessRange && values, const ForwardRange & segment_offsets, RandomAccessIterator buffer)
+    {
+        segmented_radix_sort(std::forward<RandomAccessRange>(values), segment_offsets, buffer, identity);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__SEGMENTED_RADIX_SORT__SEGMENTED_RADIX_SORT_SEQ_HPP
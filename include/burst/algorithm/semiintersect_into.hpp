@@ -0,0 +1,62 @@
+#ifndef BURST__ALGORITHM__SEMIINTERSECT_INTO_HPP
+#define BURST__ALGORITHM__SEMIINTERSECT_INTO_HPP
+
+#include <burst/algorithm/detail/inner_range_vector.hpp>
+#include <burst/iterator/end_tag.hpp>
+#include <burst/iterator/semiintersect_iterator.hpp>
+#include <burst/range/own_as_range.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Полупересечение с записью в выходной итератор
+
+        \details
+            Записывает в `result` те элементы, которые есть по меньшей мере в `min_items`
+            входных диапазонах, в порядке неубывания относительно `compare`. Результат совпадает
+            с ленивым полупересечением (см. `semiintersect`), но сами входные диапазоны не
+            изменяются.
+
+            В отличие от объединения или разности, у полупересечения нет длинных серий, которые
+            можно было бы копировать целиком: каждый элемент результата подтверждается
+            несколькими диапазонами. Поэтому запись идёт через итератор полупересечения, который
+            продвигает диапазоны так же, как и в ленивом варианте.
+
+        \param ranges
+            Диапазон произвольного доступа, состоящий из упорядоченных диапазонов, либо кортеж
+            ссылок на упорядоченные диапазоны.
+        \param min_items
+            Минимальное количество диапазонов, в которых должен встретиться элемент.
+        \param compare
+            Отношение строгого порядка, относительно которого упорядочены диапазоны.
+        \param result
+            Итератор, в который будет записано полупересечение.
+
+        \returns
+            Итератор за последним записанным элементом.
+
+        \see semiintersect
+        \see semiintersect_iterator
+     */
+    template <typename Ranges, typename Integral, typename Compare, typename OutputIterator>
+    OutputIterator semiintersect_into (const Ranges & ranges, Integral min_items, Compare compare, OutputIterator result)
+    {
+        auto inner_ranges = burst::own_as_range(detail::make_inner_range_vector(ranges));
+        auto first = make_semiintersect_iterator(std::move(inner_ranges), min_items, compare);
+        auto last = make_semiintersect_iterator(iterator::end_tag, first);
+        return std::copy(std::move(first), std::move(last), result);
+    }
+
+    template <typename Ranges, typename Integral, typename OutputIterator>
+    OutputIterator semiintersect_into (const Ranges & ranges, Integral min_items, OutputIterator result)
+    {
+        return semiintersect_into(ranges, min_items, std::less<>{}, result);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__SEMIINTERSECT_INTO_HPP
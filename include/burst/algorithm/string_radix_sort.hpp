@@ -0,0 +1,7 @@
+#ifndef BURST__ALGORITHM__STRING_RADIX_SORT_HPP
+#define BURST__ALGORITHM__STRING_RADIX_SORT_HPP
+
+#include <burst/algorithm/string_radix_sort/string_radix_sort_par.hpp>
+#include <burst/algorithm/string_radix_sort/string_radix_sort_seq.hpp>
+
+#endif // BURST__ALGORITHM__STRING_RADIX_SORT_HPP
@@ -0,0 +1,106 @@
+#ifndef BURST__ALGORITHM__STRING_RADIX_SORT__STRING_RADIX_SORT_PAR_HPP
+#define BURST__ALGORITHM__STRING_RADIX_SORT__STRING_RADIX_SORT_PAR_HPP
+
+#include <burst/algorithm/detail/get_shape.hpp>
+#include <burst/algorithm/detail/parallel_string_radix_sort.hpp>
+#include <burst/algorithm/detail/with_thread_pool.hpp>
+#include <burst/algorithm/string_radix_sort/string_radix_sort_seq.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/identity.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Параллельный вариант поразрядной сортировки строк
+
+        \details
+            Первый символ строк распределяется всеми потоками сразу, после чего получившиеся
+            корзины досортировываются независимо друг от друга в задачах пула.
+            Если потоков указано меньше двух или диапазон слишком мал, то происходит откат на
+            последовательный вариант алгоритма.
+
+        \param par
+            Тег, указывающий на то, что нужно вызвать параллельный вариант алгоритма.
+
+        \see string_radix_sort_seq.hpp
+        \see parallel_policy
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    void
+        string_radix_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map
+        )
+    {
+        const auto shape = detail::get_shape(par, first, last);
+        const auto thread_count = shape[0];
+        if (thread_count > 1)
+        {
+            detail::with_thread_pool(par, thread_count,
+                [& shape, & first, & last, & buffer, & map] (auto & pool)
+                {
+                    detail::string_radix_sort_impl(pool, shape, first, last, buffer, std::move(map));
+                });
+        }
+        else
+        {
+            string_radix_sort(first, last, buffer, map);
+        }
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void
+        string_radix_sort
+        (
+            parallel_policy par,
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer
+        )
+    {
+        string_radix_sort(par, first, last, buffer, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант параллельной поразрядной сортировки строк
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void string_radix_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer, Map map)
+    {
+        using std::begin;
+        using std::end;
+        string_radix_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            std::move(map)
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void string_radix_sort (parallel_policy par, RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        string_radix_sort
+        (
+            par,
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__STRING_RADIX_SORT__STRING_RADIX_SORT_PAR_HPP
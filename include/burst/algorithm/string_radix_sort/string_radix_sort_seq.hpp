@@ -0,0 +1,101 @@
+#ifndef BURST__ALGORITHM__STRING_RADIX_SORT__STRING_RADIX_SORT_SEQ_HPP
+#define BURST__ALGORITHM__STRING_RADIX_SORT__STRING_RADIX_SORT_SEQ_HPP
+
+#include <burst/algorithm/detail/string_radix_sort.hpp>
+#include <burst/functional/identity.hpp>
+
+#include <iterator>
+#include <utility>
+
+namespace burst
+{
+    /*!
+        \brief
+            Поразрядная сортировка строк
+
+        \details
+            Упорядочивает элементы по строкам, полученным отображением `map`, в лексикографическом
+            порядке байтов, причём байты сравниваются как беззнаковые числа (так же, как в
+            `std::memcmp`), а строка предшествует всем строкам, префиксом которых является.
+
+            Алгоритм работы
+
+            Строки обрабатываются начиная со старшего (первого) символа. Элементы распределяются
+            сортировкой подсчётом по текущему символу, после чего каждая корзина сортируется по
+            следующему символу независимо от остальных. Корзина строк, закончившихся на текущем
+            символе, дальше не рассматривается. Символ, одинаковый у всех строк корзины,
+            пропускается без распределения. Короткие корзины досортировываются вставками, причём
+            общий префикс строк при сравнении пропускается.
+
+            Время работы — `O(D + N)`, где `D` — суммарная длина различающих префиксов строк, `N` —
+            количество строк. Дополнительная память — буфер размера `N`.
+
+            Алгоритм устойчив.
+
+        \param [first, last)
+            Сортируемый диапазон. Должен быть диапазоном произвольного доступа.
+        \param buffer
+            Итератор на начало буфера, размер которого не меньше размера сортируемого диапазона.
+            Должен быть итератором произвольного доступа.
+        \param map
+            Отображение сортируемых элементов в строки. Результат должен быть диапазоном
+            произвольного доступа из однобайтовых элементов, например, `const std::string &`,
+            `boost::string_view` или `boost::iterator_range<const char *>`.
+
+        \see radix_sort
+     */
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Map>
+    void
+        string_radix_sort
+        (
+            RandomAccessIterator1 first,
+            RandomAccessIterator1 last,
+            RandomAccessIterator2 buffer,
+            Map map
+        )
+    {
+        detail::string_radix_sort_impl(first, last, buffer, std::move(map));
+    }
+
+    template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+    void string_radix_sort (RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 buffer)
+    {
+        string_radix_sort(first, last, buffer, identity);
+    }
+
+    /*!
+        \brief
+            Диапазонный вариант поразрядной сортировки строк
+
+        \details
+            Отличается только тем, что вместо пары итераторов принимает диапазон.
+     */
+    template <typename RandomAccessRange, typename RandomAccessIterator, typename Map>
+    void string_radix_sort (RandomAccessRange && range, RandomAccessIterator buffer, Map map)
+    {
+        using std::begin;
+        using std::end;
+        string_radix_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer,
+            std::move(map)
+        );
+    }
+
+    template <typename RandomAccessRange, typename RandomAccessIterator>
+    void string_radix_sort (RandomAccessRange && range, RandomAccessIterator buffer)
+    {
+        using std::begin;
+        using std::end;
+        string_radix_sort
+        (
+            begin(std::forward<RandomAccessRange>(range)),
+            end(std::forward<RandomAccessRange>(range)),
+            buffer
+        );
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__STRING_RADIX_SORT__STRING_RADIX_SORT_SEQ_HPP
@@ -0,0 +1,53 @@
+#ifndef BURST__ALGORITHM__SYMMETRIC_DIFFERENCE_INTO_HPP
+#define BURST__ALGORITHM__SYMMETRIC_DIFFERENCE_INTO_HPP
+
+#include <burst/algorithm/detail/front_heap_into.hpp>
+#include <burst/algorithm/detail/inner_range_vector.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace burst
+{
+    /*!
+        \brief
+            Симметрическая разность с записью в выходной итератор
+
+        \details
+            Записывает в `result` симметрическую разность входных диапазонов в порядке
+            неубывания относительно `compare`. Результат совпадает с ленивой симметрической
+            разностью (см. `symmetric_difference`), а сами входные диапазоны не изменяются.
+
+            Серии элементов, которые меньше первых элементов всех остальных диапазонов,
+            копируются из диапазона за один раз.
+
+        \param ranges
+            Диапазон произвольного доступа, состоящий из упорядоченных диапазонов, либо кортеж
+            ссылок на упорядоченные диапазоны.
+        \param compare
+            Отношение строгого порядка, относительно которого упорядочены диапазоны.
+        \param result
+            Итератор, в который будет записана симметрическая разность.
+
+        \returns
+            Итератор за последним записанным элементом.
+
+        \see symmetric_difference
+        \see symmetric_difference_iterator
+     */
+    template <typename Ranges, typename Compare, typename OutputIterator>
+    OutputIterator symmetric_difference_into (const Ranges & ranges, Compare compare, OutputIterator result)
+    {
+        return
+            detail::front_heap_into(detail::make_inner_range_vector(ranges), compare, result,
+                [] (std::ptrdiff_t group_size) {return group_size % 2 == 1;});
+    }
+
+    template <typename Ranges, typename OutputIterator>
+    OutputIterator symmetric_difference_into (const Ranges & ranges, OutputIterator result)
+    {
+        return symmetric_difference_into(ranges, std::less<>{}, result);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__SYMMETRIC_DIFFERENCE_INTO_HPP
@@ -0,0 +1,56 @@
+#ifndef BURST__ALGORITHM__UNITE_INTO_HPP
+#define BURST__ALGORITHM__UNITE_INTO_HPP
+
+#include <burst/algorithm/detail/front_heap_into.hpp>
+#include <burst/algorithm/detail/inner_range_vector.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace burst
+{
+    /*!
+        \brief
+            Объединение с записью в выходной итератор
+
+        \details
+            Записывает в `result` объединение входных диапазонов в порядке неубывания
+            относительно `compare`. Как и в ленивом объединении (см. `unite`), каждый элемент
+            входит в результат столько раз, сколько раз он встречается в том входном диапазоне,
+            где его больше всего. Сами входные диапазоны не изменяются.
+
+            Если наименьший элемент есть только в одном диапазоне, то из этого диапазона сразу
+            копируется вся серия элементов, меньших первых элементов всех остальных диапазонов.
+            Поэтому объединение слабо перемешанных диапазонов требует намного меньше сравнений,
+            чем ленивое.
+
+        \param ranges
+            Диапазон произвольного доступа, состоящий из упорядоченных диапазонов, либо кортеж
+            ссылок на упорядоченные диапазоны.
+        \param compare
+            Отношение строгого порядка, относительно которого упорядочены диапазоны.
+        \param result
+            Итератор, в который будет записано объединение.
+
+        \returns
+            Итератор за последним записанным элементом.
+
+        \see unite
+        \see union_iterator
+     */
+    template <typename Ranges, typename Compare, typename OutputIterator>
+    OutputIterator unite_into (const Ranges & ranges, Compare compare, OutputIterator result)
+    {
+        return
+            detail::front_heap_into(detail::make_inner_range_vector(ranges), compare, result,
+                [] (std::ptrdiff_t) {return true;});
+    }
+
+    template <typename Ranges, typename OutputIterator>
+    OutputIterator unite_into (const Ranges & ranges, OutputIterator result)
+    {
+        return unite_into(ranges, std::less<>{}, result);
+    }
+} // namespace burst
+
+#endif // BURST__ALGORITHM__UNITE_INTO_HPP
@@ -0,0 +1,44 @@
+#ifndef BURST__ALGORITHM__WRITE_COMBINING_HPP
+#define BURST__ALGORITHM__WRITE_COMBINING_HPP
+
+namespace burst
+{
+    /*!
+        \brief
+            Прямое распределение элементов
+
+        \details
+            Стратегия распределения по умолчанию для сортировки подсчётом и поразрядной
+            сортировки: каждый элемент сразу записывается на своё место в выходном диапазоне.
+     */
+    struct direct_scatter_fn
+    {
+    };
+    constexpr auto direct_scatter = direct_scatter_fn{};
+
+    /*!
+        \brief
+            Распределение элементов через программные буферы объединения записи
+
+        \details
+            При прямом распределении соседние элементы почти всегда попадают в разные корзины,
+            поэтому каждая запись обращается к новой строке кэша и, на больших массивах, к новой
+            странице памяти. Если передать этот тег в сортировку подсчётом или поразрядную
+            сортировку, то элементы сначала накапливаются в небольших буферах размером со строку
+            кэша, по одному на каждое значение разряда, и переносятся в выходной диапазон целыми
+            буферами.
+
+            Экспериментальная стратегия. На массивах от 10^6 до 3·10^7 элементов она оказалась на
+            5–20% медленнее прямого распределения; на массивах крупнее примерно 3·10^7 элементов
+            её выгода не измерялась. Применяется только к тривиальным типам; для остальных типов
+            распределение остаётся прямым.
+
+        \see direct_scatter
+     */
+    struct write_combining_fn
+    {
+    };
+    constexpr auto write_combining = write_combining_fn{};
+} // namespace burst
+
+#endif // BURST__ALGORITHM__WRITE_COMBINING_HPP
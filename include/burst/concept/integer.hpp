@@ -1,6 +1,8 @@
 #ifndef BURST__CONCEPT__INTEGER_HPP
 #define BURST__CONCEPT__INTEGER_HPP
 
+#include <burst/type_traits/is_integer.hpp>
+
 #include <type_traits>
 
 namespace burst
@@ -11,7 +13,7 @@ namespace burst
         typename =
             std::enable_if_t
             <
-                std::is_integral<std::decay_t<T>>::value
+                is_integer<std::decay_t<T>>::value
             >
     >
     using Integer = T;
@@ -1,6 +1,8 @@
 #ifndef BURST__EXECUTION__PARALLEL_POLICY_HPP
 #define BURST__EXECUTION__PARALLEL_POLICY_HPP
 
+#include <boost/asio/thread_pool.hpp>
+
 #include <cassert>
 #include <cstddef>
 
@@ -10,11 +12,18 @@ namespace burst
         \brief
             Тег, используемый для перегрузки функций, чтобы указать, что нужно вызвать параллельный
             вариант алгоритма
+
+        \details
+            Если пул потоков не задан, то параллельный алгоритм создаёт собственный пул на время
+            своей работы. Если же пул задан, то алгоритм исполняется в нём, и затраты на запуск и
+            остановку потоков при каждом вызове пропадают.
      */
     struct parallel_policy
     {
         //! Желаемое количество потоков для параллелизации.
         std::size_t thread_count;
+        //! Пул потоков, принадлежащий вызывающей стороне. Может быть нулевым.
+        boost::asio::thread_pool * pool = nullptr;
     };
 
     template <typename Integral>
@@ -23,6 +32,28 @@ namespace burst
         assert(n >= 0);
         return parallel_policy{static_cast<std::size_t>(n)};
     }
+
+    /*!
+        \brief
+            Параллельное исполнение в пуле потоков, принадлежащем вызывающей стороне
+
+        \details
+            Пул должен пережить вызов алгоритма. Вызывать алгоритм изнутри задачи, исполняемой в
+            этом же пуле, нельзя, так как вызывающий поток блокируется до окончания всех
+            порождённых им задач.
+
+        \param pool
+            Пул, в котором будут исполнены параллельные части алгоритма.
+        \param n
+            Количество кусков, на которые будет разбит входной диапазон. Как правило, совпадает с
+            количеством потоков в пуле.
+     */
+    template <typename Integral>
+    constexpr auto par (boost::asio::thread_pool & pool, Integral n)
+    {
+        assert(n >= 0);
+        return parallel_policy{static_cast<std::size_t>(n), &pool};
+    }
 } // namespace burst
 
 #endif // BURST__EXECUTION__PARALLEL_POLICY_HPP
@@ -0,0 +1,52 @@
+#ifndef BURST__FUNCTIONAL__LOW_BITS_HPP
+#define BURST__FUNCTIONAL__LOW_BITS_HPP
+
+#include <burst/type_traits/is_integer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace burst
+{
+    //!     Взятие заданного количества младших битов из целого числа
+    /*!
+            В отличие от `low_byte`, ширина результата не обязана совпадать с шириной какого-либо
+        целого типа. Поэтому количество значащих битов результата явно объявляется в поле
+        `bit_count`, и поразрядная сортировка использует именно его, а не разрядность
+        возвращаемого типа.
+            Возвращаемый тип — наименьший из беззнаковых типов, вмещающих `BitCount` битов.
+     */
+    template <std::size_t BitCount>
+    struct low_bits_fn
+    {
+        static_assert(BitCount > 0 && BitCount <= 16, "Разряд должен содержать от 1 до 16 битов.");
+
+        constexpr static auto bit_count = BitCount;
+
+        using result_type =
+            std::conditional_t
+            <
+                (BitCount <= 8),
+                std::uint8_t,
+                std::uint16_t
+            >;
+
+        template <typename Integer>
+        constexpr result_type operator () (Integer integer) const
+        {
+            static_assert
+            (
+                is_integer<Integer>::value,
+                "Младшие биты можно взять только от целого числа."
+            );
+
+            return static_cast<result_type>(integer & ((Integer{1} << BitCount) - 1));
+        }
+    };
+
+    template <std::size_t BitCount>
+    constexpr auto low_bits = low_bits_fn<BitCount>{};
+}
+
+#endif // BURST__FUNCTIONAL__LOW_BITS_HPP
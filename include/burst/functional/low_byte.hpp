@@ -1,8 +1,9 @@
 #ifndef BURST__FUNCTIONAL__LOW_BYTE_HPP
 #define BURST__FUNCTIONAL__LOW_BYTE_HPP
 
+#include <burst/type_traits/is_integer.hpp>
+
 #include <cstdint>
-#include <type_traits>
 
 namespace burst
 {
@@ -18,7 +19,7 @@ namespace burst
         {
             static_assert
             (
-                std::is_integral<Integer>::value,
+                is_integer<Integer>::value,
                 "Младший байт можно взять только от целого числа."
             );
 
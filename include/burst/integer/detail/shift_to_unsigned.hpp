@@ -1,6 +1,10 @@
 #ifndef BURST__INTEGER__DETAIL__SHIFT_TO_UNSIGNED_HPP
 #define BURST__INTEGER__DETAIL__SHIFT_TO_UNSIGNED_HPP
 
+#include <burst/type_traits/unsigned_integer_of_size.hpp>
+
+#include <boost/cstdint.hpp>
+
 #include <limits>
 #include <type_traits>
 
@@ -8,6 +12,31 @@ namespace burst
 {
     namespace detail
     {
+        /*!
+            \brief
+                Беззнаковый тип того же размера
+
+            \details
+                В строгом режиме стандарта `std::make_unsigned` не определён для 128-битных целых,
+                поэтому для них тип берётся из `unsigned_integer_of_size`.
+         */
+        template <typename I>
+        struct make_unsigned_integer: std::make_unsigned<I> {};
+
+#if defined(BOOST_HAS_INT128)
+        template <>
+        struct make_unsigned_integer<boost::int128_type>
+        {
+            using type = unsigned_integer_of_size_t<sizeof(boost::int128_type)>;
+        };
+
+        template <>
+        struct make_unsigned_integer<boost::uint128_type>
+        {
+            using type = boost::uint128_type;
+        };
+#endif
+
         constexpr auto shift_to_unsigned_impl (bool b)
         {
             return b;
@@ -17,7 +46,7 @@ namespace burst
         constexpr auto shift_to_unsigned_impl (I n)
         {
             constexpr const auto min_value = std::numeric_limits<I>::min();
-            return static_cast<std::make_unsigned_t<I>>(n ^ min_value);
+            return static_cast<typename make_unsigned_integer<I>::type>(n ^ min_value);
         }
     } // namespace detail
 } // namespace burst
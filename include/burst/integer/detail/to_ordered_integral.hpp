@@ -2,18 +2,31 @@
 #define BURST__INTEGER__DETAIL__TO_ORDERED_INTEGRAL_HPP
 
 #include <burst/bit/bit_cast.hpp>
+#include <burst/type_traits/is_integer.hpp>
 #include <burst/type_traits/unsigned_integer_of_size.hpp>
 
+#include <boost/cstdint.hpp>
+#include <boost/predef/other/endian.h>
+
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <type_traits>
 
+#if defined(BOOST_HAS_INT128) && BOOST_ENDIAN_LITTLE_BYTE && LDBL_MANT_DIG == 64 && LDBL_MAX_EXP == 16384
+//!     `long double` — 80-битное число расширенной точности x87 с порядком байтов от младшего.
+#define BURST_X87_LONG_DOUBLE
+#endif
+
 namespace burst
 {
     namespace detail
     {
         template <typename Integral>
         constexpr auto to_ordered_integral_impl (Integral n)
-            -> std::enable_if_t<std::is_integral<Integral>::value, Integral>
+            -> std::enable_if_t<is_integer<Integral>::value, Integral>
         {
             return n;
         }
@@ -64,35 +77,65 @@ namespace burst
             return static_cast<integral_type>((u & sign_bit_mask) ? ~u : u ^ sign_bit_mask);
         }
 
+#if defined(BURST_X87_LONG_DOUBLE)
+        /*!
+            \brief
+                Перегрузка для 80-битного `long double` x87
+
+            \details
+                Формат x87 известен на этапе компиляции: младшие 8 байтов — мантисса с явным
+                старшим битом, следующие 2 байта — знаковый бит и 15-битный показатель степени.
+                Остальные байты (`sizeof(long double)` может быть равен 12 или 16) — это
+                выравнивание, и они могут содержать произвольные данные, поэтому отбрасываются.
+
+                Значащие 80 битов упорядочиваются так же, как и у остальных чисел с плавающей
+                запятой, и возвращаются в младших битах 128-битного беззнакового целого. Старшие
+                байты результата всегда нулевые, и поразрядная сортировка пропускает их как
+                постоянные разряды.
+
+                В отличие от остальных перегрузок, не может быть вычислена на этапе компиляции.
+         */
+        inline auto to_ordered_integral_impl (long double f)
+        {
+            using integral_type = unsigned_integer_of_size_t<16>;
+            constexpr auto significand_size = sizeof(std::uint64_t);
+            constexpr auto bit_count = std::numeric_limits<long double>::digits + 16;
+            constexpr auto sign_bit_mask = integral_type{1} << (bit_count - 1);
+            constexpr auto value_mask = (integral_type{1} << bit_count) - 1;
+
+            unsigned char bytes[sizeof(long double)];
+            std::memcpy(bytes, std::addressof(f), sizeof(bytes));
+
+            auto significand = std::uint64_t{0};
+            auto sign_and_exponent = std::uint16_t{0};
+            std::memcpy(std::addressof(significand), bytes, significand_size);
+            std::memcpy(std::addressof(sign_and_exponent), bytes + significand_size, sizeof(sign_and_exponent));
+
+            const auto u = integral_type{sign_and_exponent} << std::numeric_limits<std::uint64_t>::digits | significand;
+            return static_cast<integral_type>((u & sign_bit_mask) ? ~u & value_mask : u ^ sign_bit_mask);
+        }
+#else
         /*!
             \brief
-                Перегрузка для `long double` запрещена
+                Перегрузка для `long double` запрещена, если его формат неизвестен
 
             \details
                 `long double` сильно различается в зависимости от платформы и компилятора,
-                и определить его битность, чтобы привести к упорядоченному целому, практически
-                невозможно.
+                и определить его битность, чтобы привести к упорядоченному целому, в общем случае
+                практически невозможно.
 
                 `numeric_limits<long double>::is_iec559` может быть истинно не только для
                 128-битных `long double`, но и для 80-битных. При этом фактический размер
                 80-битного `long double` (то, что возвращает `sizeof`) может быть и 10, и 12, и 16.
                 "Пустые биты", т.е. сверх используемых 80-ти, могут быть заполнены произвольными
                 данными.
-                Определить реальную битность можно только эвристически, например, найдя знаковый бит
-                по формуле:
-
-                \code{.cpp}
-                std::countr_zero
-                (
-                    std::bitcast<uint128_t>(-std::numeric_limits<F>::infinity()) ^
-                    std::bitcast<uint128_t>( std::numeric_limits<F>::infinity())
-                );
-                \endcode
-
-                Но даже если правильно определить битность, то на текущий момент (29.03.2025)
-                `std::bit_cast<uint128_t>(long double)` не является `constexpr`.
+
+                Поэтому поддержан только случай, когда формат известен на этапе компиляции:
+                80-битное число x87 с порядком байтов от младшего при наличии 128-битных целых
+                (см. `BURST_X87_LONG_DOUBLE`).
          */
         inline constexpr auto to_ordered_integral_impl (long double) = delete;
+#endif
     } // namespace detail
 } // namespace burst
 
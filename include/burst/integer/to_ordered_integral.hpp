@@ -2,6 +2,7 @@
 #define BURST__INTEGER__TO_ORDERED_INTEGRAL_HPP
 
 #include <burst/integer/detail/to_ordered_integral.hpp>
+#include <burst/type_traits/is_integer.hpp>
 
 #include <type_traits>
 #include <limits>
@@ -13,8 +14,9 @@ namespace burst
             Представить арифметический тип в виде упорядоченного целого
 
         \details
-            Функция определена для упорядоченных арифметических типов, то есть для целых чисел и
-            чисел с плавающей запятой.
+            Функция определена для упорядоченных арифметических типов, то есть для целых чисел
+            (включая 128-битные) и чисел с плавающей запятой. `long double` поддержан, только если
+            это 80-битное число x87 (см. `BURST_X87_LONG_DOUBLE`).
 
             Возвращает такое целочисленное представление, что:
                 ∀ x, y: x < y => to_ordered_integral(x) < to_ordered_integral(y),
@@ -27,7 +29,7 @@ namespace burst
         {
             static_assert
             (
-                std::is_integral<Arithmetic>::value || std::numeric_limits<Arithmetic>::is_iec559,
+                is_integer<Arithmetic>::value || std::numeric_limits<Arithmetic>::is_iec559,
                 "Требуется целое число или число с плавающей запятой, "
                 "соответствующее стандарту IEC 559 (IEEE 754)"
             );
@@ -0,0 +1,109 @@
+#ifndef BURST__ITERATOR__DETAIL__FRONT_HEAP_HPP
+#define BURST__ITERATOR__DETAIL__FRONT_HEAP_HPP
+
+#include <burst/container/access/front.hpp>
+#include <burst/functional/each.hpp>
+#include <burst/functional/invert.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Построить пирамиду диапазонов
+
+            \details
+                Диапазоны сравниваются по первым элементам, и на вершине пирамиды оказывается
+                диапазон с наименьшим относительно порядка `compare` первым элементом.
+
+            \pre
+                Все диапазоны из `[first, last)` непусты.
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        void make_front_heap (RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+        {
+            std::make_heap(first, last, each(front) | invert(compare));
+        }
+
+        /*!
+            \brief
+                Извлечь из пирамиды все диапазоны с наименьшим первым элементом
+
+            \details
+                Извлечённые диапазоны — те, у которых первые элементы эквивалентны наименьшему, —
+                складываются в конец диапазона `[first, last)`, а пирамида занимает оставшееся
+                начало. На каждый извлечённый диапазон тратится `O(log k)` сравнений.
+
+            \returns
+                Итератор, отделяющий пирамиду от извлечённых диапазонов. Если пирамида была пуста,
+                то `last`.
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        RandomAccessIterator
+            pop_front_group
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                Compare compare
+            )
+        {
+            if (first == last)
+            {
+                return last;
+            }
+
+            const auto heap_order = each(front) | invert(compare);
+            std::pop_heap(first, last, heap_order);
+            auto group_begin = std::prev(last);
+            while (group_begin != first && not compare(group_begin->front(), first->front()))
+            {
+                std::pop_heap(first, group_begin, heap_order);
+                --group_begin;
+            }
+            return group_begin;
+        }
+
+        /*!
+            \brief
+                Продвинуть извлечённые диапазоны и вернуть их в пирамиду
+
+            \details
+                Каждый диапазон из `[group_begin, last)` продвигается на один элемент вперёд.
+                Непустые диапазоны возвращаются в пирамиду `[first, group_begin)`, а опустевшие
+                остаются в конце.
+
+            \returns
+                Конец получившейся пирамиды. Опустевшие диапазоны лежат за ним.
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        RandomAccessIterator
+            push_advanced
+            (
+                RandomAccessIterator first,
+                RandomAccessIterator group_begin,
+                RandomAccessIterator last,
+                Compare compare
+            )
+        {
+            const auto heap_order = each(front) | invert(compare);
+            auto heap_end = group_begin;
+            for (auto range = group_begin; range != last; ++range)
+            {
+                range->advance_begin(1);
+                if (not range->empty())
+                {
+                    std::iter_swap(range, heap_end);
+                    ++heap_end;
+                    std::push_heap(first, heap_end, heap_order);
+                }
+            }
+            return heap_end;
+        }
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ITERATOR__DETAIL__FRONT_HEAP_HPP
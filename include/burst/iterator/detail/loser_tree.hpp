@@ -0,0 +1,252 @@
+#ifndef BURST__ITERATOR__DETAIL__LOSER_TREE_HPP
+#define BURST__ITERATOR__DETAIL__LOSER_TREE_HPP
+
+#include <burst/type_traits/iterator_value.hpp>
+#include <burst/type_traits/range_value.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        /*!
+            \brief
+                Количество диапазонов, начиная с которого слияние ведётся с помощью дерева
+                проигравших
+
+            \details
+                Замеры показывают, что дерево проигравших быстрее пирамиды уже при слиянии двух
+                диапазонов, причём как на числах, так и на строках. Единственный диапазон
+                проходится без дерева, чтобы не выделять под него память.
+         */
+        constexpr auto loser_tree_merge_threshold = std::ptrdiff_t{2};
+
+        /*!
+            \brief
+                Нужно ли хранить копии первых элементов диапазонов
+
+            \details
+                Копия первого элемента лежит в непрерывном массиве, поэтому при сравнении не нужно
+                обращаться к самому диапазону. Это выгодно только для небольших тривиально
+                копируемых значений — чисел, указателей, небольших структур.
+         */
+        template <typename Value>
+        struct is_cheap_to_cache:
+            std::integral_constant
+            <
+                bool,
+                std::is_trivially_copyable<Value>::value && sizeof(Value) <= 2 * sizeof(void *)
+            >
+        {
+        };
+
+        //!     Первые элементы диапазонов, которые берутся напрямую из диапазонов.
+        template <typename RandomAccessIterator, bool Cache>
+        class loser_tree_heads
+        {
+        public:
+            explicit loser_tree_heads (RandomAccessIterator ranges, std::size_t):
+                m_ranges(ranges)
+            {
+            }
+
+            decltype(auto) operator [] (std::size_t index) const
+            {
+                return (*std::next(m_ranges, static_cast<std::ptrdiff_t>(index))).front();
+            }
+
+            void update (std::size_t)
+            {
+            }
+
+        private:
+            RandomAccessIterator m_ranges;
+        };
+
+        //!     Копии первых элементов диапазонов, сложенные в непрерывный массив.
+        template <typename RandomAccessIterator>
+        class loser_tree_heads <RandomAccessIterator, true>
+        {
+        private:
+            using value_type = range_value_t<iterator_value_t<RandomAccessIterator>>;
+
+        public:
+            explicit loser_tree_heads (RandomAccessIterator ranges, std::size_t range_count):
+                m_ranges(ranges),
+                m_heads{}
+            {
+                m_heads.reserve(range_count);
+                for (auto index = std::size_t{0}; index < range_count; ++index)
+                {
+                    m_heads.push_back((*std::next(ranges, static_cast<std::ptrdiff_t>(index))).front());
+                }
+            }
+
+            const value_type & operator [] (std::size_t index) const
+            {
+                return m_heads[index];
+            }
+
+            void update (std::size_t index)
+            {
+                m_heads[index] = (*std::next(m_ranges, static_cast<std::ptrdiff_t>(index))).front();
+            }
+
+        private:
+            RandomAccessIterator m_ranges;
+            std::vector<value_type> m_heads;
+        };
+
+        /*!
+            \brief
+                Дерево проигравших
+
+            \details
+                Турнирное дерево над `k` непустыми упорядоченными диапазонами. Листья —
+                диапазоны — неявно занимают позиции `[k, 2k)`, а каждый внутренний узел `[1, k)`
+                хранит номер диапазона, проигравшего в сравнении на этом узле. Победитель всего
+                турнира, то есть диапазон с наименьшим первым элементом, хранится отдельно.
+
+                После продвижения победителя достаточно пройти от его листа к корню, на каждом
+                узле сравнивая его только с записанным там проигравшим. Поэтому на один элемент
+                слияния приходится не более `⌈log2(k)⌉` сравнений, тогда как пирамиде нужно
+                около `2 log2(k)` сравнений на просеивание вниз и вверх.
+
+                Исчерпанный диапазон остаётся в дереве и проигрывает любому другому.
+
+            \see merge_iterator
+         */
+        template <typename RandomAccessIterator, typename Compare>
+        class loser_tree
+        {
+        private:
+            using value_type = range_value_t<iterator_value_t<RandomAccessIterator>>;
+            using heads_type = loser_tree_heads<RandomAccessIterator, is_cheap_to_cache<value_type>::value>;
+
+        public:
+            loser_tree (RandomAccessIterator first, RandomAccessIterator last, Compare compare):
+                m_ranges(first),
+                m_range_count(static_cast<std::size_t>(std::distance(first, last))),
+                m_active_count(m_range_count),
+                m_heads(first, m_range_count),
+                m_exhausted(m_range_count, false),
+                m_losers(m_range_count),
+                m_winner(0),
+                m_compare(std::move(compare))
+            {
+                BOOST_ASSERT(m_range_count > 0);
+
+                auto winners = std::vector<std::size_t>(2 * m_range_count);
+                for (auto index = std::size_t{0}; index < m_range_count; ++index)
+                {
+                    winners[m_range_count + index] = index;
+                }
+                for (auto node = m_range_count - 1; node > 0; --node)
+                {
+                    const auto left = winners[2 * node];
+                    const auto right = winners[2 * node + 1];
+                    const auto left_wins = not beats(right, left);
+                    winners[node] = left_wins ? left : right;
+                    m_losers[node] = left_wins ? right : left;
+                }
+                m_winner = m_range_count > 1 ? winners[1] : 0;
+            }
+
+            //!     Диапазон с наименьшим первым элементом.
+            decltype(auto) top () const
+            {
+                return range(m_winner);
+            }
+
+            /*!
+                \brief
+                    Диапазон со вторым по величине первым элементом
+
+                \details
+                    Второй по величине диапазон проиграл только победителю, поэтому он записан
+                    в одном из узлов на пути от листа победителя к корню.
+
+                \returns
+                    Указатель на диапазон или `nullptr`, если все остальные диапазоны исчерпаны.
+             */
+            auto runner_up () const
+            {
+                auto runner_up = m_range_count;
+                for (auto node = (m_range_count + m_winner) / 2; node > 0; node /= 2)
+                {
+                    const auto loser = m_losers[node];
+                    if (not m_exhausted[loser] &&
+                        (runner_up == m_range_count || m_compare(m_heads[loser], m_heads[runner_up])))
+                    {
+                        runner_up = loser;
+                    }
+                }
+                return runner_up != m_range_count ? std::addressof(range(runner_up)) : nullptr;
+            }
+
+            //!     Продвинуть победителя на `count` элементов и переиграть турнир на его пути к корню.
+            void pop (std::ptrdiff_t count = 1)
+            {
+                auto & winner_range = range(m_winner);
+                winner_range.advance_begin(count);
+                if (not winner_range.empty())
+                {
+                    m_heads.update(m_winner);
+                }
+                else
+                {
+                    m_exhausted[m_winner] = true;
+                    --m_active_count;
+                }
+
+                auto winner = m_winner;
+                for (auto node = (m_range_count + winner) / 2; node > 0; node /= 2)
+                {
+                    if (beats(m_losers[node], winner))
+                    {
+                        std::swap(m_losers[node], winner);
+                    }
+                }
+                m_winner = winner;
+            }
+
+            bool empty () const
+            {
+                return m_active_count == 0;
+            }
+
+        private:
+            decltype(auto) range (std::size_t index) const
+            {
+                return *std::next(m_ranges, static_cast<std::ptrdiff_t>(index));
+            }
+
+            bool beats (std::size_t challenger, std::size_t holder) const
+            {
+                return
+                    not m_exhausted[challenger] &&
+                    (m_exhausted[holder] || m_compare(m_heads[challenger], m_heads[holder]));
+            }
+
+        private:
+            RandomAccessIterator m_ranges;
+            std::size_t m_range_count;
+            std::size_t m_active_count;
+            heads_type m_heads;
+            std::vector<char> m_exhausted;
+            std::vector<std::size_t> m_losers;
+            std::size_t m_winner;
+            Compare m_compare;
+        };
+    } // namespace detail
+} // namespace burst
+
+#endif // BURST__ITERATOR__DETAIL__LOSER_TREE_HPP
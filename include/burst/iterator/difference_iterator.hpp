@@ -2,13 +2,14 @@
 #define BURST__ITERATOR__DIFFERENCE_ITERATOR_HPP
 
 #include <burst/iterator/end_tag.hpp>
-#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
 #include <burst/type_traits/iterator_reference.hpp>
 #include <burst/type_traits/iterator_value.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/iterator/iterator_concepts.hpp>
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <algorithm>
 #include <functional>
@@ -39,6 +40,10 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах входных диапазонов.
             Если пользователем явно не указана операция, то, по-умолчанию, берётся отношение
             "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam SkipPolicy
+            Способ продвижения вычитаемого до первого элемента уменьшаемого (см.
+            `skip_policy.hpp`). По умолчанию способ выбирается по соотношению размеров
+            диапазонов.
 
             Алгоритм работы.
 
@@ -62,12 +67,13 @@ namespace burst
     <
         typename ForwardIterator1,
         typename ForwardIterator2,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename SkipPolicy = adaptive_skip_t
     >
     class difference_iterator:
         public boost::iterator_facade
         <
-            difference_iterator<ForwardIterator1, ForwardIterator2, Compare>,
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, SkipPolicy>,
             iterator_value_t<ForwardIterator1>,
             boost::forward_traversal_tag,
             iterator_reference_t<ForwardIterator1>
@@ -96,13 +102,15 @@ namespace burst
                 minuend_iterator minuend_end,
                 subtrahend_iterator subtrahend_begin,
                 subtrahend_iterator subtrahend_end,
-                Compare compare = Compare()
+                Compare compare = Compare(),
+                SkipPolicy skip = SkipPolicy()
             ):
             m_minuend_begin(std::move(minuend_begin)),
             m_minuend_end(std::move(minuend_end)),
             m_subtrahend_begin(std::move(subtrahend_begin)),
             m_subtrahend_end(std::move(subtrahend_end)),
-            m_compare(compare)
+            m_compare(compare),
+            m_skip(skip)
         {
             BOOST_ASSERT(std::is_sorted(m_minuend_begin, m_minuend_end, compare));
             BOOST_ASSERT(std::is_sorted(m_subtrahend_begin, m_subtrahend_end, compare));
@@ -115,7 +123,8 @@ namespace burst
             m_minuend_end(begin.m_minuend_end),
             m_subtrahend_begin{},
             m_subtrahend_end{},
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
         {
         }
 
@@ -142,7 +151,7 @@ namespace burst
                 && m_compare(*m_subtrahend_begin, *m_minuend_begin))
             {
                 auto subtrahend = boost::make_iterator_range(m_subtrahend_begin, m_subtrahend_end);
-                skip_to_lower_bound(subtrahend, *m_minuend_begin, m_compare);
+                m_skip(subtrahend, boost::make_iterator_range(m_minuend_begin, m_minuend_end), m_compare);
                 m_subtrahend_begin = subtrahend.begin();
             }
         }
@@ -186,6 +195,7 @@ namespace burst
         subtrahend_iterator m_subtrahend_begin;
         subtrahend_iterator m_subtrahend_end;
         compare_type m_compare;
+        SkipPolicy m_skip;
     };
 
     //!     Функция для создания итератора разности с предикатом.
@@ -193,35 +203,45 @@ namespace burst
             Принимает на вход два диапазона, разность которых нужно найти, и операцию, задающую
         отношение строгого порядка на элементах этих диапазонов.
             Сами диапазоны должны быть упорядочены относительно этой операции.
+            Дополнительно можно указать способ продвижения вычитаемого (см. `skip_policy.hpp`).
             Возвращает итератор на первый элемент разности входных диапазонов.
      */
-    template <typename ForwardIterator1, typename ForwardIterator2, typename Compare>
+    template
+    <
+        typename ForwardIterator1,
+        typename ForwardIterator2,
+        typename Compare,
+        typename SkipPolicy = adaptive_skip_t
+    >
     auto
         make_difference_iterator
         (
             ForwardIterator1 minuend_begin, ForwardIterator1 minuend_end,
             ForwardIterator2 subtrahend_begin, ForwardIterator2 subtrahend_end,
-            Compare compare
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
         )
     {
         return
-            difference_iterator<ForwardIterator1, ForwardIterator2, Compare>
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, SkipPolicy>
             (
                 std::move(minuend_begin),
                 std::move(minuend_end),
                 std::move(subtrahend_begin),
                 std::move(subtrahend_end),
-                compare
+                compare,
+                skip
             );
     }
 
-    template <typename ForwardRange1, typename ForwardRange2, typename Compare>
+    template <typename ForwardRange1, typename ForwardRange2, typename Compare, typename SkipPolicy = adaptive_skip_t>
     auto
         make_difference_iterator
         (
             ForwardRange1 && minuend,
             ForwardRange2 && subtrahend,
-            Compare compare
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
         )
     {
         using std::begin;
@@ -233,7 +253,8 @@ namespace burst
                 end(std::forward<ForwardRange1>(minuend)),
                 begin(std::forward<ForwardRange2>(subtrahend)),
                 end(std::forward<ForwardRange2>(subtrahend)),
-                compare
+                compare,
+                skip
             );
     }
 
@@ -286,16 +307,16 @@ namespace burst
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы разности
         закончились.
      */
-    template <typename ForwardIterator1, typename ForwardIterator2, typename Compare>
+    template <typename ForwardIterator1, typename ForwardIterator2, typename Compare, typename SkipPolicy>
     auto
         make_difference_iterator
         (
             iterator::end_tag_t,
-            const difference_iterator<ForwardIterator1, ForwardIterator2, Compare> & begin
+            const difference_iterator<ForwardIterator1, ForwardIterator2, Compare, SkipPolicy> & begin
         )
     {
         return
-            difference_iterator<ForwardIterator1, ForwardIterator2, Compare>
+            difference_iterator<ForwardIterator1, ForwardIterator2, Compare, SkipPolicy>
             (
                 iterator::end_tag,
                 begin
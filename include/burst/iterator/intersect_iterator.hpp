@@ -8,7 +8,7 @@
 #include <burst/iterator/end_tag.hpp>
 #include <burst/range/make_range_vector.hpp>
 #include <burst/range/own_as_range.hpp>
-#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
 #include <burst/tuple/apply.hpp>
 #include <burst/type_traits/iterator_value.hpp>
 #include <burst/type_traits/range_reference.hpp>
@@ -49,6 +49,10 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах внутренних
             диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
             отношение "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam SkipPolicy
+            Способ продвижения внутреннего диапазона до первого элемента другого внутреннего
+            диапазона (см. `skip_policy.hpp`). По умолчанию способ выбирается по соотношению
+            размеров диапазонов.
 
             Алгоритм работы.
 
@@ -71,12 +75,13 @@ namespace burst
     template
     <
         typename RandomAccessIterator,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename SkipPolicy = adaptive_skip_t
     >
     class intersect_iterator:
         public boost::iterator_facade
         <
-            intersect_iterator<RandomAccessIterator, Compare>,
+            intersect_iterator<RandomAccessIterator, Compare, SkipPolicy>,
             range_value_t<iterator_value_t<RandomAccessIterator>>,
             boost::single_pass_traversal_tag,
             detail::prevent_writing_t<range_reference_t<iterator_value_t<RandomAccessIterator>>>
@@ -104,11 +109,13 @@ namespace burst
         explicit intersect_iterator
             (
                 outer_range_iterator first, outer_range_iterator last,
-                Compare compare = Compare()
+                Compare compare = Compare(),
+                SkipPolicy skip = SkipPolicy()
             ):
             m_begin{},
             m_end{},
-            m_compare(compare)
+            m_compare(compare),
+            m_skip(skip)
         {
             if (std::none_of(first, last, [] (const auto & range) {return range.empty();}))
             {
@@ -128,7 +135,8 @@ namespace burst
         intersect_iterator (iterator::end_tag_t, const intersect_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
         {
         }
 
@@ -194,7 +202,7 @@ namespace burst
                 {
                     if (m_compare(range->front(), max_range->front()))
                     {
-                        skip_to_lower_bound(*range, max_range->front(), m_compare);
+                        m_skip(*range, *max_range, m_compare);
                         if (range->empty())
                         {
                             scroll_to_end();
@@ -239,6 +247,7 @@ namespace burst
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
         compare_type m_compare;
+        SkipPolicy m_skip;
     };
 
     //!     Функция для создания итератора пересечения с предикатом.
@@ -246,26 +255,29 @@ namespace burst
             Принимает на вход набор диапазонов, которые нужно пересечь, и операцию, задающую
         отношение строгого порядка на элементах этого диапазона.
             Сами диапазоны должны быть упорядочены относительно этой операции.
+            Дополнительно можно указать способ продвижения диапазонов (см. `skip_policy.hpp`).
             Возвращает итератор на первое пересечение входных диапазонов.
      */
-    template <typename RandomAccessIterator, typename Compare>
+    template <typename RandomAccessIterator, typename Compare, typename SkipPolicy = adaptive_skip_t>
     auto
         make_intersect_iterator
         (
             RandomAccessIterator first, RandomAccessIterator last,
-            Compare compare
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
         )
     {
         return
-            intersect_iterator<RandomAccessIterator, Compare>
+            intersect_iterator<RandomAccessIterator, Compare, SkipPolicy>
             (
                 std::move(first), std::move(last),
-                compare
+                compare,
+                skip
             );
     }
 
-    template <typename RandomAccessRange, typename Compare>
-    auto make_intersect_iterator (RandomAccessRange && ranges, Compare compare)
+    template <typename RandomAccessRange, typename Compare, typename SkipPolicy = adaptive_skip_t>
+    auto make_intersect_iterator (RandomAccessRange && ranges, Compare compare, SkipPolicy skip = SkipPolicy{})
     {
         using std::begin;
         using std::end;
@@ -274,7 +286,8 @@ namespace burst
             (
                 begin(std::forward<RandomAccessRange>(ranges)),
                 end(std::forward<RandomAccessRange>(ranges)),
-                compare
+                compare,
+                skip
             );
     }
 
@@ -292,6 +305,8 @@ namespace burst
             Кортеж ссылок на диапазоны, которые нужно пересечь.
         \param compare
             Операция, задающая отношение строгого порядка на элементах результирующего диапазона.
+        \param skip
+            Способ продвижения диапазонов.
 
         \pre
             Каждый диапазон в `ranges` упорядочен относительно операции `compare`.
@@ -301,16 +316,18 @@ namespace burst
             пересечения входных диапазонов.
 
         \see intersect_iterator
+        \see skip_policy.hpp
      */
-    template <typename ... Ranges, typename Compare>
-    auto make_intersect_iterator (std::tuple<Ranges &...> ranges, Compare compare)
+    template <typename ... Ranges, typename Compare, typename SkipPolicy = adaptive_skip_t>
+    auto make_intersect_iterator (std::tuple<Ranges &...> ranges, Compare compare, SkipPolicy skip = SkipPolicy{})
     {
         auto common_ranges = detail::uniform_range_tuple_please(ranges);
         return
             make_intersect_iterator
             (
                 burst::own_as_range(burst::apply(burst::make_range_vector, common_ranges)),
-                std::move(compare)
+                std::move(compare),
+                skip
             );
     }
 
@@ -367,15 +384,15 @@ namespace burst
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
         пересечения закончились.
      */
-    template <typename RandomAccessRange, typename Compare>
+    template <typename RandomAccessRange, typename Compare, typename SkipPolicy>
     auto
         make_intersect_iterator
         (
             iterator::end_tag_t,
-            const intersect_iterator<RandomAccessRange, Compare> & begin
+            const intersect_iterator<RandomAccessRange, Compare, SkipPolicy> & begin
         )
     {
-        return intersect_iterator<RandomAccessRange, Compare>(iterator::end_tag, begin);
+        return intersect_iterator<RandomAccessRange, Compare, SkipPolicy>(iterator::end_tag, begin);
     }
 } // namespace burst
 
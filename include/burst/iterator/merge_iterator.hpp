@@ -4,6 +4,7 @@
 #include <burst/container/access/front.hpp>
 #include <burst/functional/each.hpp>
 #include <burst/functional/invert.hpp>
+#include <burst/iterator/detail/loser_tree.hpp>
 #include <burst/iterator/detail/uniform_range_tuple_please.hpp>
 #include <burst/iterator/end_tag.hpp>
 #include <burst/range/make_range_vector.hpp>
@@ -22,6 +23,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <utility>
 
@@ -49,12 +51,20 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается в структуру "пирамида", в которой его элементы —
-           внутренние диапазоны — сравниваются по первому элементу в том же отношении порядка, в
-           котором упорядочены элементы в самих диапазонах.
-        2. Каждый раз, когда требуется перейти к следующему элементу слияния, из пирамиды достаётся
-           наименьший диапазон, он продвигается ровно на один элемент вперёд, а затем, если
-           диапазон не стал пустым, кладётся обратно в пирамиду.
+        1. Внутренние диапазоны становятся листьями турнирного дерева — дерева проигравших (см.
+           `detail::loser_tree`), в котором диапазоны сравниваются по первому элементу в том же
+           отношении порядка, в котором упорядочены элементы в самих диапазонах. Победитель
+           турнира — диапазон с наименьшим первым элементом.
+        2. Каждый раз, когда требуется перейти к следующему элементу слияния, победитель
+           продвигается ровно на один элемент вперёд, и турнир переигрывается на пути от его листа
+           к корню. На это уходит не больше `⌈log2(k)⌉` сравнений, вдвое меньше, чем на извлечение
+           из пирамиды и вставку в неё. Первые элементы диапазонов небольших тривиально копируемых
+           типов хранятся в непрерывном массиве, так что при сравнениях не приходится обращаться к
+           самим диапазонам.
+
+            Если непустой диапазон только один (см. `detail::loser_tree_merge_threshold`), то
+        дерево не строится, а внешний диапазон используется как пирамида из одного элемента.
+            Дерево разделяется между копиями итератора, как и сами сливаемые диапазоны.
      */
     template
     <
@@ -86,11 +96,14 @@ namespace burst
                 range_reference_t<inner_range_type>
             >;
 
+        using loser_tree_type = detail::loser_tree<outer_range_iterator, Compare>;
+
     public:
         explicit merge_iterator (outer_range_iterator first, outer_range_iterator last, Compare compare = Compare()):
             m_begin(std::move(first)),
             m_end(std::move(last)),
-            m_compare(compare)
+            m_compare(compare),
+            m_tree{}
         {
             // Чтобы провести эту проверку, внутренние диапазоны должны быть однонаправленными.
             // Подумать, как сделать эту проверку не требуя однонаправленности.
@@ -101,13 +114,21 @@ namespace burst
             //     }));
 
             remove_empty_ranges();
-            std::make_heap(m_begin, m_end, each(front) | invert(m_compare));
+            if (std::distance(m_begin, m_end) >= detail::loser_tree_merge_threshold)
+            {
+                m_tree = std::make_shared<loser_tree_type>(m_begin, m_end, m_compare);
+            }
+            else
+            {
+                std::make_heap(m_begin, m_end, each(front) | invert(m_compare));
+            }
         }
 
         merge_iterator (iterator::end_tag_t, const merge_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_tree{}
         {
         }
 
@@ -122,6 +143,22 @@ namespace burst
         }
 
         void increment ()
+        {
+            if (m_tree)
+            {
+                m_tree->pop();
+                if (m_tree->empty())
+                {
+                    m_end = m_begin;
+                }
+            }
+            else
+            {
+                pop_heap();
+            }
+        }
+
+        void pop_heap ()
         {
             std::pop_heap(m_begin, m_end, each(front) | invert(m_compare));
             auto & range = *std::prev(m_end);
@@ -140,7 +177,7 @@ namespace burst
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_tree ? m_tree->top().front() : m_begin->front();
         }
 
         bool equal (const merge_iterator & that) const
@@ -154,6 +191,7 @@ namespace burst
         outer_range_iterator m_end;
 
         Compare m_compare;
+        std::shared_ptr<loser_tree_type> m_tree;
     };
 
     //!     Функция для создания итератора слияния с предикатом.
@@ -8,7 +8,7 @@
 #include <burst/iterator/end_tag.hpp>
 #include <burst/range/make_range_vector.hpp>
 #include <burst/range/own_as_range.hpp>
-#include <burst/range/skip_to_lower_bound.hpp>
+#include <burst/range/skip_policy.hpp>
 #include <burst/tuple/apply.hpp>
 #include <burst/type_traits/iterator_difference.hpp>
 #include <burst/type_traits/iterator_value.hpp>
@@ -60,6 +60,10 @@ namespace burst
             Бинарная операция, задающая отношение строгого порядка на элементах внутренних
             диапазонов. Если пользователем явно не указана операция, то, по-умолчанию, берётся
             отношение "меньше", задаваемое функциональным объектом "std::less<>".
+        \tparam SkipPolicy
+            Способ продвижения внутреннего диапазона до первого элемента другого внутреннего
+            диапазона (см. `skip_policy.hpp`). По умолчанию способ выбирается по соотношению
+            размеров диапазонов.
 
             Алгоритм работы.
 
@@ -84,12 +88,13 @@ namespace burst
     template
     <
         typename RandomAccessIterator,
-        typename Compare = std::less<>
+        typename Compare = std::less<>,
+        typename SkipPolicy = adaptive_skip_t
     >
     class semiintersect_iterator:
         public boost::iterator_facade
         <
-            semiintersect_iterator<RandomAccessIterator, Compare>,
+            semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy>,
             range_value_t<iterator_value_t<RandomAccessIterator>>,
             boost::single_pass_traversal_tag,
             detail::prevent_writing_t<range_reference_t<iterator_value_t<RandomAccessIterator>>>
@@ -118,12 +123,14 @@ namespace burst
             (
                 outer_range_iterator first, outer_range_iterator last,
                 std::size_t min_items,
-                Compare compare = Compare()
+                Compare compare = Compare(),
+                SkipPolicy skip = SkipPolicy()
             ):
             m_begin(std::move(first)),
             m_end(std::move(last)),
             m_min_items(min_items),
-            m_compare(compare)
+            m_compare(compare),
+            m_skip(skip)
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
                 [this] (const auto & range)
@@ -139,7 +146,8 @@ namespace burst
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
             m_min_items(begin.m_min_items),
-            m_compare(begin.m_compare)
+            m_compare(begin.m_compare),
+            m_skip(begin.m_skip)
         {
         }
 
@@ -276,7 +284,7 @@ namespace burst
             {
                 if (m_compare(range->front(), candidate->front()))
                 {
-                    skip_to_lower_bound(*range, candidate->front(), m_compare);
+                    m_skip(*range, *candidate, m_compare);
                     if (range->empty() || m_compare(candidate->front(), range->front()))
                     {
                         break;
@@ -353,6 +361,7 @@ namespace burst
         outer_range_iterator m_end;
         std::size_t m_min_items = 0;
         compare_type m_compare;
+        SkipPolicy m_skip;
     };
 
     //!     Функция для создания итератора полупересечения с предикатом.
@@ -361,34 +370,44 @@ namespace burst
         минимальное количество элементов в полупересечении и операцию, задающую отношение строгого
         порядка на элементах этих диапазонов.
             Сами диапазоны должны быть упорядочены относительно этой операции.
+            Дополнительно можно указать способ продвижения диапазонов (см. `skip_policy.hpp`).
             Возвращает итератор на первое полупересечение входных диапазонов.
      */
-    template <typename RandomAccessIterator, typename Integral, typename Compare>
+    template
+    <
+        typename RandomAccessIterator,
+        typename Integral,
+        typename Compare,
+        typename SkipPolicy = adaptive_skip_t
+    >
     auto
         make_semiintersect_iterator
         (
             RandomAccessIterator first, RandomAccessIterator last,
             Integral min_items,
-            Compare compare
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
         )
     {
         assert(min_items > 0);
         return
-            semiintersect_iterator<RandomAccessIterator, Compare>
+            semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy>
             (
                 std::move(first), std::move(last),
                 static_cast<std::size_t>(min_items),
-                compare
+                compare,
+                skip
             );
     }
 
-    template <typename RandomAccessRange, typename Integral, typename Compare>
+    template <typename RandomAccessRange, typename Integral, typename Compare, typename SkipPolicy = adaptive_skip_t>
     auto
         make_semiintersect_iterator
         (
             RandomAccessRange && ranges,
             Integral min_items,
-            Compare compare
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
         )
     {
         using std::begin;
@@ -399,7 +418,8 @@ namespace burst
                 begin(std::forward<RandomAccessRange>(ranges)),
                 end(std::forward<RandomAccessRange>(ranges)),
                 min_items,
-                compare
+                compare,
+                skip
             );
     }
 
@@ -457,6 +477,8 @@ namespace burst
             Параметр полупересечения.
         \param compare
             Операция, задающая отношение строгого порядка на элементах результирующего диапазона.
+        \param skip
+            Способ продвижения диапазонов.
 
         \pre
             Каждый диапазон в `ranges` упорядочен относительно операции `compare`.
@@ -466,14 +488,16 @@ namespace burst
             полупересечения входных диапазонов.
 
         \see semiintersect_iterator
+        \see skip_policy.hpp
      */
-    template <typename ... Ranges, typename Integral, typename Compare>
+    template <typename ... Ranges, typename Integral, typename Compare, typename SkipPolicy = adaptive_skip_t>
     auto
         make_semiintersect_iterator
         (
             std::tuple<Ranges &...> ranges,
             Integral min_items,
-            Compare compare
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
         )
     {
         auto common_ranges = detail::uniform_range_tuple_please(ranges);
@@ -482,7 +506,8 @@ namespace burst
             (
                 burst::own_as_range(burst::apply(burst::make_range_vector, common_ranges)),
                 min_items,
-                std::move(compare)
+                std::move(compare),
+                skip
             );
     }
 
@@ -514,15 +539,15 @@ namespace burst
             Возвращает итератор-конец, который, если до него дойти, покажет, что элементы
         полупересечения закончились.
      */
-    template <typename RandomAccessIterator, typename Compare>
+    template <typename RandomAccessIterator, typename Compare, typename SkipPolicy>
     auto
         make_semiintersect_iterator
         (
             iterator::end_tag_t,
-            const semiintersect_iterator<RandomAccessIterator, Compare> & begin
+            const semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy> & begin
         )
     {
-        return semiintersect_iterator<RandomAccessIterator, Compare>(iterator::end_tag, begin);
+        return semiintersect_iterator<RandomAccessIterator, Compare, SkipPolicy>(iterator::end_tag, begin);
     }
 } // namespace burst
 
@@ -1,9 +1,7 @@
 #ifndef BURST__ITERATOR__SYMMETRIC_DIFFERENCE_ITERATOR_HPP
 #define BURST__ITERATOR__SYMMETRIC_DIFFERENCE_ITERATOR_HPP
 
-#include <burst/algorithm/select_min.hpp>
-#include <burst/container/access/front.hpp>
-#include <burst/functional/each.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/detail/uniform_range_tuple_please.hpp>
 #include <burst/iterator/end_tag.hpp>
@@ -59,14 +57,21 @@ namespace burst
             Алгоритм работы.
 
         1.  Инвариант
-            Либо внешний диапазон пуст, либо на первых N местах (N — любое нечётное число) стоят
-            диапазоны с наименьшими первыми элементами.
-            Текущим элементом является первый элемент первого из внутренних диапазонов.
+            Либо внешний диапазон пуст, либо он разбит на две части: в начале лежит пирамида
+            диапазонов, упорядоченных по первому элементу, а в конце — N диапазонов
+            (N — любое нечётное число), извлечённых из пирамиды, у которых первые элементы
+            одинаковы и меньше первых элементов диапазонов из пирамиды.
+            Текущим элементом является первый элемент любого из извлечённых диапазонов.
         2.  Поиск следующего элемента
-            а.  Первые N диапазонов продвигаются на один элемент вперёд.
+            а.  Извлечённые диапазоны продвигаются на один элемент вперёд и возвращаются в
+                пирамиду.
             б.  Каждый диапазон, который закончился, выбрасывается из рассмотрения. Когда все
                 диапазоны закончились, элементов симметрической разности больше нет.
-            в.  Восстановление инварианта.
+            в.  Восстановление инварианта: из пирамиды извлекаются все диапазоны с наименьшим
+                первым элементом. Если их чётное количество, то они продвигаются и
+                возвращаются в пирамиду, и извлечение повторяется.
+            Продвигаются и возвращаются в пирамиду только извлечённые диапазоны, поэтому на
+            каждую группу из `m` одинаковых первых элементов приходится `O(m log k)` сравнений.
      */
     template
     <
@@ -108,7 +113,7 @@ namespace burst
             ):
             m_begin(std::move(first)),
             m_end(std::move(last)),
-            m_min_end(m_begin),
+            m_group_begin(m_end),
             m_compare(compare)
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
@@ -117,7 +122,9 @@ namespace burst
                     return boost::algorithm::is_sorted(range, m_compare);
                 }));
 
-            settle();
+            remove_empty_ranges();
+            detail::make_front_heap(m_begin, m_end, m_compare);
+            maintain_invariant();
         }
 
         symmetric_difference_iterator
@@ -127,7 +134,7 @@ namespace burst
         ):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
-            m_min_end(begin.m_begin),
+            m_group_begin(begin.m_begin),
             m_compare(begin.m_compare)
         {
         }
@@ -148,47 +155,24 @@ namespace burst
          */
         void maintain_invariant ()
         {
-            m_min_end = select_min(m_begin, m_end, each(front) | m_compare);
-            while (m_min_end != m_begin && std::distance(m_begin, m_min_end) % 2 == 0)
+            m_group_begin = detail::pop_front_group(m_begin, m_end, m_compare);
+            while (m_group_begin != m_end && std::distance(m_group_begin, m_end) % 2 == 0)
             {
-                std::for_each(m_begin, m_min_end, [] (auto & r) {r.advance_begin(1);});
-                remove_empty_ranges();
-                m_min_end = select_min(m_begin, m_end, each(front) | m_compare);
+                m_end = detail::push_advanced(m_begin, m_group_begin, m_end, m_compare);
+                m_group_begin = detail::pop_front_group(m_begin, m_end, m_compare);
             }
         }
 
         void increment ()
         {
-            faze();
-            settle();
-        }
-
-        //!     Вывести диапазоны из равновесия
-        /*!
-                Приводит диапазоны в такое состояние, что предыдущий элемент уже недостижим, а
-            следующий в общем случае ещё не достигнут.
-                Продвигает диапазоны, содержащие на первом месте текущий элемент, на один элемент
-            вперёд.
-         */
-        void faze ()
-        {
-            std::for_each(m_begin, m_min_end, [] (auto & r) {r.advance_begin(1);});
-        }
-
-        //!     Устаканить диапазоны на ближайшем элементе симметрической разности
-        /*!
-                Выбрасывает из рассмотрения пустые диапазоны и восстанавливает инвариант.
-         */
-        void settle ()
-        {
-            remove_empty_ranges();
+            m_end = detail::push_advanced(m_begin, m_group_begin, m_end, m_compare);
             maintain_invariant();
         }
 
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_group_begin->front();
         }
 
         bool equal (const symmetric_difference_iterator & that) const
@@ -200,7 +184,7 @@ namespace burst
     private:
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
-        outer_range_iterator m_min_end; // Итератор на позицию за последним минимальным элементом.
+        outer_range_iterator m_group_begin; // Начало извлечённых из пирамиды диапазонов.
         compare_type m_compare;
     };
 
@@ -1,8 +1,7 @@
 #ifndef BURST__ITERATOR__UNION_ITERATOR_HPP
 #define BURST__ITERATOR__UNION_ITERATOR_HPP
 
-#include <burst/container/access/front.hpp>
-#include <burst/functional/each.hpp>
+#include <burst/iterator/detail/front_heap.hpp>
 #include <burst/iterator/detail/prevent_writing.hpp>
 #include <burst/iterator/detail/uniform_range_tuple_please.hpp>
 #include <burst/iterator/end_tag.hpp>
@@ -56,16 +55,19 @@ namespace burst
 
             Алгоритм работы.
 
-        1. Внешний диапазон переупорядочивается так, что его элементы (внутренние диапазоны)
-           упорядочены по первому элементу в заданном отношении порядка.
-           В каждый момент времени первый элемент первого внутреннего диапазона — текущий элемент
-           объединения.
-        2. Чтобы найти следующий элемент объединения, нужно продвинуть на один элемент вперёд все
-           внутренние диапазоны, у которых первый элемент совпадает с текущим элементом
-           объединения, а затем заново отсортировать внешний диапазон.
+        1. Внешний диапазон переупорядочивается в структуру "пирамида", в которой его элементы
+           (внутренние диапазоны) сравниваются по первому элементу в заданном отношении порядка.
+        2. Из пирамиды извлекаются все внутренние диапазоны с наименьшим первым элементом. Этот
+           элемент — текущий элемент объединения.
+        3. Чтобы найти следующий элемент объединения, нужно продвинуть на один элемент вперёд все
+           извлечённые диапазоны и вернуть их в пирамиду, а затем снова извлечь из неё диапазоны с
+           наименьшим первым элементом.
            Если в результате продвижения какой-либо из внутренних диапазонов опустел, он
            выбрасывается.
-        3. Когда все внутренние диапазоны опустели, объединение закончено.
+           Остальные диапазоны не трогаются, поэтому на один элемент объединения приходится
+           `O(m log k)` сравнений, где `m` — количество диапазонов, содержащих этот элемент, а
+           `k` — количество диапазонов.
+        4. Когда все внутренние диапазоны опустели, объединение закончено.
      */
     template
     <
@@ -107,6 +109,7 @@ namespace burst
             ):
             m_begin(std::move(first)),
             m_end(std::move(last)),
+            m_group_begin(m_end),
             m_compare(compare)
         {
             BOOST_ASSERT(std::all_of(m_begin, m_end,
@@ -115,12 +118,15 @@ namespace burst
                     return boost::algorithm::is_sorted(range, m_compare);
                 }));
 
-            maintain_invariant();
+            remove_empty_ranges();
+            detail::make_front_heap(m_begin, m_end, m_compare);
+            m_group_begin = detail::pop_front_group(m_begin, m_end, m_compare);
         }
 
         union_iterator (iterator::end_tag_t, const union_iterator & begin):
             m_begin(begin.m_begin),
             m_end(begin.m_begin),
+            m_group_begin(begin.m_begin),
             m_compare(begin.m_compare)
         {
         }
@@ -135,29 +141,16 @@ namespace burst
             m_end = std::remove_if(m_begin, m_end, [] (const auto & r) {return r.empty();});
         }
 
-        void maintain_invariant ()
-        {
-            remove_empty_ranges();
-            std::sort(m_begin, m_end, each(front) | m_compare);
-        }
-
         void increment ()
         {
-            auto current_union_end =
-                std::upper_bound(m_begin, m_end, *m_begin, each(front) | m_compare);
-            std::for_each(m_begin, current_union_end,
-                [] (auto & range)
-                {
-                    range.advance_begin(1);
-                });
-
-            maintain_invariant();
+            m_end = detail::push_advanced(m_begin, m_group_begin, m_end, m_compare);
+            m_group_begin = detail::pop_front_group(m_begin, m_end, m_compare);
         }
 
     private:
         typename base_type::reference dereference () const
         {
-            return m_begin->front();
+            return m_group_begin->front();
         }
 
         bool equal (const union_iterator & that) const
@@ -169,8 +162,8 @@ namespace burst
     private:
         outer_range_iterator m_begin;
         outer_range_iterator m_end;
+        outer_range_iterator m_group_begin;
         compare_type m_compare;
-
     };
 
     //!     Функция для создания итератора объединения с предикатом.
@@ -1,35 +1,86 @@
 #ifndef BURST__RANGE__DETAIL__SKIP_TO_LOWER_BOUND_HPP
 #define BURST__RANGE__DETAIL__SKIP_TO_LOWER_BOUND_HPP
 
+#include <burst/algorithm/detail/galloping_search.hpp>
+#include <burst/algorithm/detail/integer_intersect.hpp>
 #include <burst/type_traits/iterator_category.hpp>
+#include <burst/type_traits/iterator_value.hpp>
 #include <burst/type_traits/range_iterator.hpp>
 
 #include <boost/range/algorithm/lower_bound.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/size.hpp>
 
+#include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 
 namespace burst
 {
     namespace detail
     {
+        template <typename Range>
+        using is_random_access_range =
+            std::is_same
+            <
+                std::random_access_iterator_tag,
+                iterator_category_t<range_iterator_t<Range>>
+            >;
+
+        template <typename InputRange, typename Value, typename Compare>
+        void linear_skip_to_lower_bound_impl (InputRange & range, const Value & goal, Compare compare, std::false_type)
+        {
+            while (not range.empty() && compare(range.front(), goal))
+            {
+                range.advance_begin(1);
+            }
+        }
+
+        //!     Проход по целым числам, лежащим в памяти подряд, сразу по нескольку чисел.
+        template <typename ContiguousRange, typename Value, typename Compare>
+        void linear_skip_to_lower_bound_impl (ContiguousRange & range, const Value & goal, Compare, std::true_type)
+        {
+            using value_type = iterator_value_t<range_iterator_t<ContiguousRange>>;
+            if (not range.empty())
+            {
+                const auto first = std::addressof(*range.begin());
+                const auto last = first + range.size();
+                const auto lower_bound = scan_lower_bound<value_type>(first, last, goal);
+                range.advance_begin(lower_bound - first);
+            }
+        }
+
+        //!     Поэлементное продвижение любого диапазона.
+        /*!
+                Поэлементно двигает начало диапазона до тех пор, пока либо диапазон не закончится,
+            либо его начало не встанет на то место, до которого нужно продвинуться.
+                Диапазоны 32-битных целых чисел, лежащих в памяти подряд, проходятся блоками с
+            помощью векторных инструкций, если значение, до которого нужно продвинуться, того же
+            типа, что и элементы диапазона. Иначе его пришлось бы сужать до типа элементов, а
+            суженное значение может оказаться меньше исходного.
+         */
+        template <typename InputRange, typename Value, typename Compare>
+        void linear_skip_to_lower_bound (InputRange & range, const Value & goal, Compare compare)
+        {
+            using iterator = range_iterator_t<InputRange>;
+            using is_applicable =
+                std::integral_constant
+                <
+                    bool,
+                    is_intersect_kernel_applicable<iterator, Compare>::value &&
+                        std::is_same<std::decay_t<Value>, iterator_value_t<iterator>>::value
+                >;
+            linear_skip_to_lower_bound_impl(range, goal, compare, is_applicable{});
+        }
+
         //!     Продвижение диапазона произвольного доступа.
         /*!
                 Использует двоичный поиск для нахождения в диапазоне места, до которого нужно
             продвинуться, и сразу продвигается до этого места.
          */
         template <typename RandomAccessRange, typename Value, typename Compare>
-        typename std::enable_if
-        <
-            std::is_same
-            <
-                std::random_access_iterator_tag,
-                iterator_category_t<range_iterator_t<RandomAccessRange>>
-            >
-            ::value,
-            void
-        >
-        ::type
+        typename std::enable_if<is_random_access_range<RandomAccessRange>::value, void>::type
         skip_to_lower_bound (RandomAccessRange & range, const Value & goal, Compare compare)
         {
             range.advance_begin
@@ -43,28 +94,106 @@ namespace burst
         }
 
         //!     Продвижение любого диапазона, кроме произвольного доступа.
+        template <typename InputRange, typename Value, typename Compare>
+        typename std::enable_if<not is_random_access_range<InputRange>::value, void>::type
+        skip_to_lower_bound (InputRange & range, const Value & goal, Compare compare)
+        {
+            linear_skip_to_lower_bound(range, goal, compare);
+        }
+
+        //!     Продвижение диапазона произвольного доступа скачками.
         /*!
-                Поэлементно двигает начало диапазона до тех пор, пока либо диапазон не закончится,
-            либо его начало не встанет на то место, до которого нужно продвинуться.
+                Использует скачущий поиск, поэтому количество сравнений логарифмически зависит не
+            от размера диапазона, а от расстояния до того места, до которого нужно продвинуться.
          */
+        template <typename RandomAccessRange, typename Value, typename Compare>
+        typename std::enable_if<is_random_access_range<RandomAccessRange>::value, void>::type
+        galloping_skip_to_lower_bound (RandomAccessRange & range, const Value & goal, Compare compare)
+        {
+            range.advance_begin
+            (
+                std::distance
+                (
+                    range.begin(),
+                    galloping_search(range.begin(), range.end(), goal, compare)
+                )
+            );
+        }
+
         template <typename InputRange, typename Value, typename Compare>
-        typename std::enable_if
-        <
-            not std::is_same
-            <
-                std::random_access_iterator_tag,
-                iterator_category_t<range_iterator_t<InputRange>>
-            >
-            ::value,
-            void
-        >
-        ::type
-        skip_to_lower_bound (InputRange & range, const Value & goal, Compare compare)
+        typename std::enable_if<not is_random_access_range<InputRange>::value, void>::type
+        galloping_skip_to_lower_bound (InputRange & range, const Value & goal, Compare compare)
         {
-            while (not range.empty() && compare(range.front(), goal))
+            linear_skip_to_lower_bound(range, goal, compare);
+        }
+
+        //!     Средний шаг, при котором выгоднее идти по диапазону поэлементно.
+        constexpr auto adaptive_skip_linear_stride = std::size_t{4};
+
+        /*!
+            \brief
+                Продвижение диапазона с выбором способа по соотношению размеров диапазонов
+
+            \details
+                Продвигает диапазон `range` до нижней грани первого элемента диапазона
+                `goal_range`. Если `n = |range|`, а `m = |goal_range|`, то в среднем за одно
+                продвижение нужно пропустить порядка `n / m` элементов.
+                -   Если средний шаг не больше нескольких элементов, то поэлементный проход
+                    дешевле любого поиска, а суммарно он не может занять больше `n` сравнений.
+                -   Если средний шаг меньше `√n`, то скачущий поиск с его `2 log(n / m)`
+                    сравнениями выгоднее двоичного с `log(n)` сравнениями.
+                -   Иначе выгоднее двоичный поиск по всему оставшемуся диапазону.
+         */
+        template <typename RandomAccessRange1, typename RandomAccessRange2, typename Compare>
+        void
+            adaptive_skip_to_lower_bound
+            (
+                RandomAccessRange1 & range,
+                const RandomAccessRange2 & goal_range,
+                Compare compare,
+                std::true_type
+            )
+        {
+            const auto range_size = static_cast<std::size_t>(boost::size(range));
+            const auto stride = range_size / static_cast<std::size_t>(boost::size(goal_range));
+            if (stride <= adaptive_skip_linear_stride)
             {
-                range.advance_begin(1);
+                linear_skip_to_lower_bound(range, *boost::begin(goal_range), compare);
+            }
+            else if (stride * stride < range_size)
+            {
+                galloping_skip_to_lower_bound(range, *boost::begin(goal_range), compare);
             }
+            else
+            {
+                skip_to_lower_bound(range, *boost::begin(goal_range), compare);
+            }
+        }
+
+        //!     Если размеры диапазонов неизвестны, то скачущий поиск — самый безопасный выбор.
+        template <typename InputRange1, typename InputRange2, typename Compare>
+        void
+            adaptive_skip_to_lower_bound
+            (
+                InputRange1 & range,
+                const InputRange2 & goal_range,
+                Compare compare,
+                std::false_type
+            )
+        {
+            galloping_skip_to_lower_bound(range, *boost::begin(goal_range), compare);
+        }
+
+        template <typename InputRange1, typename InputRange2, typename Compare>
+        void adaptive_skip_to_lower_bound (InputRange1 & range, const InputRange2 & goal_range, Compare compare)
+        {
+            adaptive_skip_to_lower_bound(range, goal_range, compare,
+                std::integral_constant
+                <
+                    bool,
+                    is_random_access_range<InputRange1>::value &&
+                        is_random_access_range<InputRange2>::value
+                >{});
         }
     }
 }
@@ -3,6 +3,7 @@
 
 #include <burst/iterator/difference_iterator.hpp>
 #include <burst/iterator/end_tag.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <boost/range/iterator_range.hpp>
 
@@ -17,16 +18,25 @@ namespace burst
         должны быть упорядочены относительно этой операции.
             Возвращает диапазон, упорядоченный относительно всё той же операции, каждый элемент
         которого одновременно есть в уменьшаемом и отсутствует в вычитаемом.
+            Дополнительно можно указать способ продвижения вычитаемого (см. `skip_policy.hpp`).
      */
-    template <typename ForwardRange1, typename ForwardRange2, typename Compare>
-    auto difference (ForwardRange1 && minuend, ForwardRange2 && subtrahend, Compare compare)
+    template <typename ForwardRange1, typename ForwardRange2, typename Compare, typename SkipPolicy = adaptive_skip_t>
+    auto
+        difference
+        (
+            ForwardRange1 && minuend,
+            ForwardRange2 && subtrahend,
+            Compare compare,
+            SkipPolicy skip = SkipPolicy{}
+        )
     {
         auto begin =
             make_difference_iterator
             (
                 std::forward<ForwardRange1>(minuend),
                 std::forward<ForwardRange2>(subtrahend),
-                compare
+                compare,
+                skip
             );
         auto end = make_difference_iterator(iterator::end_tag, begin);
 
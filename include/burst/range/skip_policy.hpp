@@ -0,0 +1,80 @@
+#ifndef BURST__RANGE__SKIP_POLICY_HPP
+#define BURST__RANGE__SKIP_POLICY_HPP
+
+#include <burst/range/detail/skip_to_lower_bound.hpp>
+
+#include <boost/range/begin.hpp>
+
+namespace burst
+{
+    //!     Двоичный поиск по всему оставшемуся диапазону.
+    struct binary_skip_t
+    {
+        template <typename Range, typename GoalRange, typename Compare>
+        void operator () (Range & range, const GoalRange & goal_range, Compare compare) const
+        {
+            detail::skip_to_lower_bound(range, *boost::begin(goal_range), compare);
+        }
+    };
+
+    constexpr auto binary_skip = binary_skip_t{};
+
+    //!     Скачущий поиск от начала диапазона.
+    struct galloping_skip_t
+    {
+        template <typename Range, typename GoalRange, typename Compare>
+        void operator () (Range & range, const GoalRange & goal_range, Compare compare) const
+        {
+            detail::galloping_skip_to_lower_bound(range, *boost::begin(goal_range), compare);
+        }
+    };
+
+    constexpr auto galloping_skip = galloping_skip_t{};
+
+    //!     Поэлементный проход.
+    struct linear_skip_t
+    {
+        template <typename Range, typename GoalRange, typename Compare>
+        void operator () (Range & range, const GoalRange & goal_range, Compare compare) const
+        {
+            detail::linear_skip_to_lower_bound(range, *boost::begin(goal_range), compare);
+        }
+    };
+
+    constexpr auto linear_skip = linear_skip_t{};
+
+    /*!
+        \brief
+            Выбор способа продвижения по соотношению размеров диапазонов
+
+        \details
+            Способ продвижения — функциональный объект, который вызывается как
+            `skip(range, goal_range, compare)` и продвигает начало упорядоченного диапазона `range`
+            до первого элемента, который не меньше первого элемента непустого диапазона
+            `goal_range`. Способ продвижения можно передать итераторам пересечения,
+            полупересечения и разности, которые постоянно продвигают одни диапазоны до текущих
+            элементов других. Диапазоны, не являющиеся диапазонами произвольного доступа, любой
+            способ продвигает поэлементно.
+
+            Этот способ используется по умолчанию. Если диапазоны близки по размеру, то `range`
+            продвигается поэлементно, если `range` намного длиннее `goal_range` — двоичным
+            поиском, а в промежуточных случаях — скачущим поиском.
+
+        \see detail::adaptive_skip_to_lower_bound
+        \see binary_skip_t
+        \see galloping_skip_t
+        \see linear_skip_t
+     */
+    struct adaptive_skip_t
+    {
+        template <typename Range, typename GoalRange, typename Compare>
+        void operator () (Range & range, const GoalRange & goal_range, Compare compare) const
+        {
+            detail::adaptive_skip_to_lower_bound(range, goal_range, compare);
+        }
+    };
+
+    constexpr auto adaptive_skip = adaptive_skip_t{};
+} // namespace burst
+
+#endif // BURST__RANGE__SKIP_POLICY_HPP
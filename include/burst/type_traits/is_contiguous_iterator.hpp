@@ -0,0 +1,68 @@
+#ifndef BURST__TYPE_TRAITS__IS_CONTIGUOUS_ITERATOR_HPP
+#define BURST__TYPE_TRAITS__IS_CONTIGUOUS_ITERATOR_HPP
+
+#include <burst/type_traits/iterator_value.hpp>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace burst
+{
+    namespace detail
+    {
+        template <typename Iterator, typename Value>
+        struct is_standard_contiguous_iterator:
+            std::integral_constant
+            <
+                bool,
+                std::is_same<Iterator, typename std::vector<Value>::iterator>::value ||
+                std::is_same<Iterator, typename std::vector<Value>::const_iterator>::value
+            >
+        {
+        };
+
+        //!     Итераторы `std::vector<bool>` перебирают биты, а не лежащие подряд значения.
+        template <typename Iterator>
+        struct is_standard_contiguous_iterator<Iterator, bool>: std::false_type {};
+
+        template <typename Iterator>
+        struct is_standard_contiguous_iterator<Iterator, char>:
+            std::integral_constant
+            <
+                bool,
+                std::is_same<Iterator, std::vector<char>::iterator>::value ||
+                std::is_same<Iterator, std::vector<char>::const_iterator>::value ||
+                std::is_same<Iterator, std::string::iterator>::value ||
+                std::is_same<Iterator, std::string::const_iterator>::value
+            >
+        {
+        };
+    } // namespace detail
+
+    /*!
+        \brief
+            Проверяет, что итератор указывает на элементы, лежащие в памяти подряд
+
+        \details
+            Истинна для указателей, а также для итераторов `std::vector` (кроме `std::vector<bool>`)
+            с распределителем по умолчанию и итераторов `std::string`. Для таких итераторов
+            `std::addressof(*(i + n)) == std::addressof(*i) + n`, поэтому алгоритм может работать
+            напрямую с памятью, на которую они указывают.
+    */
+    template <typename Iterator>
+    struct is_contiguous_iterator:
+        std::integral_constant
+        <
+            bool,
+            std::is_pointer<Iterator>::value ||
+            detail::is_standard_contiguous_iterator<Iterator, iterator_value_t<Iterator>>::value
+        >
+    {
+    };
+
+    template <typename Iterator>
+    constexpr const auto is_contiguous_iterator_v = is_contiguous_iterator<Iterator>::value;
+} // namespace burst
+
+#endif // BURST__TYPE_TRAITS__IS_CONTIGUOUS_ITERATOR_HPP
@@ -0,0 +1,40 @@
+#ifndef BURST__TYPE_TRAITS__IS_INTEGER_HPP
+#define BURST__TYPE_TRAITS__IS_INTEGER_HPP
+
+#include <limits>
+#include <type_traits>
+
+namespace burst
+{
+    /*!
+        \brief
+            Проверяет, является ли тип целым числом
+
+        \details
+            В отличие от `std::is_integral`, признаёт целыми также 128-битные расширения
+            компилятора (`__int128` и `unsigned __int128`), которые в строгом режиме стандарта
+            не считаются целыми, хотя `std::numeric_limits` для них определён.
+    */
+    template <typename T>
+    struct is_integer:
+        std::integral_constant<bool, std::numeric_limits<std::remove_cv_t<T>>::is_integer> {};
+
+    template <typename T>
+    constexpr const auto is_integer_v = is_integer<T>::value;
+
+    //!     Проверяет, является ли тип беззнаковым целым числом (см. `is_integer`).
+    template <typename T>
+    struct is_unsigned_integer:
+        std::integral_constant
+        <
+            bool,
+            is_integer<T>::value && not std::numeric_limits<std::remove_cv_t<T>>::is_signed
+        >
+    {
+    };
+
+    template <typename T>
+    constexpr const auto is_unsigned_integer_v = is_unsigned_integer<T>::value;
+} // namespace burst
+
+#endif // BURST__TYPE_TRAITS__IS_INTEGER_HPP
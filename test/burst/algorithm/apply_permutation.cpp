@@ -0,0 +1,81 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/apply_permutation.hpp>
+#include <burst/algorithm/radix_argsort.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/iterator/indirect_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+TEST_SUITE("apply_permutation")
+{
+    TEST_CASE("Тождественная перестановка не изменяет диапазон")
+    {
+        const auto initial = std::vector<std::string>{"a", "b", "c"};
+        auto values = initial;
+        auto indices = std::vector<std::size_t>{0, 1, 2};
+
+        burst::apply_permutation(values.begin(), values.end(), indices.begin());
+
+        CHECK(values == initial);
+    }
+
+    TEST_CASE("На i-ю позицию ставит элемент, стоявший на позиции indices[i]")
+    {
+        auto values = std::vector<std::string>{"a", "b", "c", "d", "e"};
+        auto indices = std::vector<std::size_t>{3, 0, 4, 1, 2};
+
+        burst::apply_permutation(values, indices.begin());
+
+        CHECK(values == std::vector<std::string>{"d", "a", "e", "b", "c"});
+    }
+
+    TEST_CASE("Превращает перестановку в тождественную")
+    {
+        auto values = std::vector<int>{10, 20, 30, 40};
+        auto indices = std::vector<int>{1, 0, 3, 2};
+
+        burst::apply_permutation(values, indices.begin());
+
+        CHECK(indices == std::vector<int>{0, 1, 2, 3});
+    }
+
+    TEST_CASE("Переставляет некопируемые объекты")
+    {
+        std::vector<std::unique_ptr<int>> values;
+        values.emplace_back(std::make_unique<int>(2));
+        values.emplace_back(std::make_unique<int>(0));
+        values.emplace_back(std::make_unique<int>(1));
+        auto indices = std::vector<std::size_t>{1, 2, 0};
+
+        burst::apply_permutation(values, indices.begin());
+
+        const auto expected = {0, 1, 2};
+        CHECK(std::equal
+        (
+            boost::make_indirect_iterator(values.begin()),
+            boost::make_indirect_iterator(values.end()),
+            expected.begin()
+        ));
+    }
+
+    TEST_CASE("Вместе с косвенной поразрядной сортировкой упорядочивает диапазон")
+    {
+        auto values = utility::random_vector<std::uint32_t>(1000, 0, 100500);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<std::size_t> indices(values.size());
+        burst::radix_argsort(values, indices.begin());
+        burst::apply_permutation(values, indices.begin());
+
+        CHECK(values == expected);
+    }
+}
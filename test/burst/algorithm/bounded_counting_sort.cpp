@@ -0,0 +1,143 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/bounded_counting_sort.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_SUITE("bounded_counting_sort")
+{
+    TEST_CASE("Сортирует числа из отрезка, заданного во время исполнения")
+    {
+        auto values = std::vector<std::uint32_t>{69999, 1000, 42000, 1000, 70000, 1234};
+        auto buffer = std::vector<std::uint32_t>(values.size());
+
+        burst::bounded_counting_sort(values.begin(), values.end(), buffer.begin(), burst::identity, 1000, 70000);
+
+        CHECK(values == (std::vector<std::uint32_t>{1000, 1000, 1234, 42000, 69999, 70000}));
+    }
+
+    TEST_CASE("Находит границы образа сама, если они не заданы")
+    {
+        auto values = std::vector<std::uint16_t>{300, 17, 65535, 17, 0, 299};
+        auto buffer = std::vector<std::uint16_t>(values.size());
+
+        burst::bounded_counting_sort(values, buffer.begin());
+
+        CHECK(values == (std::vector<std::uint16_t>{0, 17, 17, 299, 300, 65535}));
+    }
+
+    TEST_CASE("Сортирует знаковые числа")
+    {
+        auto values = std::vector<int>{5, -3, 0, -100, 42, -3};
+        auto buffer = std::vector<int>(values.size());
+
+        burst::bounded_counting_sort(values, buffer.begin(), burst::identity, -100, 42);
+
+        CHECK(values == (std::vector<int>{-100, -3, -3, 0, 5, 42}));
+    }
+
+    TEST_CASE("Сохраняет порядок элементов с равными образами")
+    {
+        using record = std::pair<std::int64_t, char>;
+        auto records = std::vector<record>{{1000000, 'a'}, {-7, 'b'}, {1000000, 'c'}, {-7, 'd'}, {500, 'e'}};
+        auto buffer = std::vector<record>(records.size());
+
+        burst::bounded_counting_sort(records, buffer.begin(), [] (const record & r) {return r.first;});
+
+        CHECK(records == (std::vector<record>{{-7, 'b'}, {-7, 'd'}, {500, 'e'}, {1000000, 'a'}, {1000000, 'c'}}));
+    }
+
+    TEST_CASE("Переносит некопируемые элементы")
+    {
+        auto values = std::vector<std::unique_ptr<int>>{};
+        for (auto value: {7, 3, 5, 3})
+        {
+            values.push_back(std::make_unique<int>(value));
+        }
+        auto buffer = std::vector<std::unique_ptr<int>>(values.size());
+
+        burst::bounded_counting_sort(values, buffer.begin(), [] (const auto & p) {return *p;});
+
+        auto sorted = std::vector<int>{};
+        std::transform(values.begin(), values.end(), std::back_inserter(sorted), [] (const auto & p) {return *p;});
+        CHECK(sorted == (std::vector<int>{3, 3, 5, 7}));
+    }
+
+    TEST_CASE("Слишком широкий диапазон сортируется поразрядно")
+    {
+        for (auto size: {10ul, 1000ul, 100000ul})
+        {
+            const auto shuffled = utility::random_vector<std::uint64_t>(size, 0, 1ull << 40);
+            auto expected = shuffled;
+            std::sort(expected.begin(), expected.end());
+
+            auto values = shuffled;
+            auto buffer = std::vector<std::uint64_t>(size);
+            burst::bounded_counting_sort(values, buffer.begin());
+
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Пустой диапазон и диапазон из одного элемента остаются без изменений")
+    {
+        auto empty = std::vector<std::uint32_t>{};
+        burst::bounded_counting_sort(empty, empty.begin());
+        CHECK(empty.empty());
+
+        auto single = std::vector<std::uint32_t>{12345};
+        auto buffer = std::vector<std::uint32_t>(1);
+        burst::bounded_counting_sort(single, buffer.begin(), burst::identity, 12345, 12345);
+        CHECK(single == std::vector<std::uint32_t>{12345});
+    }
+
+    TEST_CASE("Параллельная сортировка совпадает с последовательной")
+    {
+        for (auto max: {100ull, 50000ull, 1ull << 36})
+        {
+            const auto shuffled = utility::random_vector<std::uint64_t>(100001, 0, max);
+            auto expected = shuffled;
+            std::sort(expected.begin(), expected.end());
+
+            auto values = shuffled;
+            auto buffer = std::vector<std::uint64_t>(values.size());
+            burst::bounded_counting_sort(burst::par(3), values, buffer.begin());
+            CHECK(values == expected);
+
+            values = shuffled;
+            burst::bounded_counting_sort(burst::par(3), values, buffer.begin(), burst::identity, 0ull, max);
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Параллельная сортировка устойчива")
+    {
+        const auto keys = utility::random_vector<std::uint32_t>(50000, 10000, 10300);
+        auto records = std::vector<std::pair<std::uint32_t, std::size_t>>{};
+        for (auto i = 0ul; i < keys.size(); ++i)
+        {
+            records.emplace_back(keys[i], i);
+        }
+        auto expected = records;
+        std::stable_sort(expected.begin(), expected.end(),
+            [] (const auto & a, const auto & b) {return a.first < b.first;});
+
+        boost::asio::thread_pool pool(2);
+        auto buffer = decltype(records)(records.size());
+        burst::bounded_counting_sort(burst::par(pool, 2), records, buffer.begin(),
+            [] (const auto & r) {return r.first;});
+        pool.join();
+
+        CHECK(records == expected);
+    }
+}
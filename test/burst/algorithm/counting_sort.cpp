@@ -7,10 +7,12 @@
 #include <doctest/doctest.h>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/iterator/indirect_iterator.hpp>
 #include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstddef>
 #include <forward_list>
@@ -18,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
 #include <thread>
 #include <unordered_set>
 #include <vector>
@@ -441,6 +444,36 @@ TEST_SUITE("counting_sort")
         }
     }
 
+    TEST_CASE("Распределение через буферы объединения записи сохраняет устойчивость")
+    {
+        const auto low_byte = [] (std::uint32_t n) {return static_cast<std::uint8_t>(n & 0xff);};
+        const auto by_low_byte =
+            [& low_byte] (std::uint32_t l, std::uint32_t r)
+            {
+                return low_byte(l) < low_byte(r);
+            };
+
+        for (auto size: {7ul, 1000ul, 100000ul})
+        {
+            const auto unsorted = utility::random_vector<std::uint32_t>(size, 0, std::numeric_limits<std::uint32_t>::max());
+            auto expected = unsorted;
+            std::stable_sort(expected.begin(), expected.end(), by_low_byte);
+
+            std::vector<std::uint32_t> sequential(unsorted.size());
+            burst::counting_sort_copy(unsorted.begin(), unsorted.end(), sequential.begin(), low_byte, burst::write_combining);
+            CHECK(sequential == expected);
+
+            std::vector<std::uint32_t> parallel(unsorted.size());
+            burst::counting_sort_copy(burst::par(3), unsorted.begin(), unsorted.end(), parallel.begin(), low_byte, burst::write_combining);
+            CHECK(parallel == expected);
+
+            auto moved_from = unsorted;
+            std::vector<std::uint32_t> moved(unsorted.size());
+            burst::counting_sort_move(burst::par(2), moved_from.begin(), moved_from.end(), moved.begin(), low_byte, burst::write_combining);
+            CHECK(moved == expected);
+        }
+    }
+
     TEST_CASE("Сортировка подсчётом может быть распараллелена")
     {
         std::vector<std::int8_t> unsorted{100, -42, 99, 120, 0};
@@ -452,6 +485,43 @@ TEST_SUITE("counting_sort")
         CHECK(sorted == expected);
     }
 
+    TEST_CASE("Параллельная сортировка по двухбайтовому ключу совпадает с устойчивой сортировкой")
+    {
+        const auto unsorted =
+            utility::random_vector<std::uint32_t>(100000, 0, std::numeric_limits<std::uint32_t>::max());
+        const auto key = [] (const std::uint32_t & integer) -> std::uint16_t {return integer & 0xffff;};
+
+        auto expected = unsorted;
+        std::stable_sort(expected.begin(), expected.end(),
+            [& key] (auto left, auto right) {return key(left) < key(right);});
+
+        std::vector<std::uint32_t> sorted(unsorted.size());
+        burst::counting_sort_copy(burst::par(5), unsorted, sorted.begin(), key);
+
+        CHECK(sorted == expected);
+    }
+
+    TEST_CASE("Исключение, выброшенное при параллельной сортировке, передаётся вызывающей стороне")
+    {
+        std::vector<std::uint8_t> unsorted(1000, 7);
+        unsorted[777] = 13;
+
+        std::vector<std::uint8_t> sorted(unsorted.size());
+        CHECK_THROWS_AS
+        (
+            burst::counting_sort_copy(burst::par(4), unsorted, sorted.begin(),
+                [] (std::uint8_t n)
+                {
+                    if (n == 13)
+                    {
+                        throw std::runtime_error("13");
+                    }
+                    return n;
+                }),
+            std::runtime_error
+        );
+    }
+
     TEST_CASE_TEMPLATE("Непосредственно сортировка выполняется в пуле потоков, в вызывающем потоке "
         "обращений к разрядам нет", integer_type, std::int8_t, std::int16_t)
     {
@@ -474,6 +544,38 @@ TEST_SUITE("counting_sort")
         CHECK(thread_ids.find(std::this_thread::get_id()) == thread_ids.end());
     }
 
+    TEST_CASE("Параллельная сортировка может исполняться в пуле потоков вызывающей стороны")
+    {
+        boost::asio::thread_pool pool(3);
+
+        std::unordered_set<std::thread::id> thread_ids;
+        std::mutex m;
+        const auto remember_thread =
+            [& thread_ids, & m] (auto x)
+            {
+                std::unique_lock<std::mutex> l(m);
+                thread_ids.insert(std::this_thread::get_id());
+                return x;
+            };
+
+        for (auto attempt = 0; attempt < 3; ++attempt)
+        {
+            auto unsorted = utility::random_vector<std::uint8_t>(1000, 0, 255);
+            auto expected = unsorted;
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<std::uint8_t> sorted(unsorted.size());
+            burst::counting_sort_copy(burst::par(pool, 3), unsorted, sorted.begin(), remember_thread);
+
+            CHECK(sorted == expected);
+        }
+
+        CHECK(thread_ids.size() <= 3);
+        CHECK(thread_ids.find(std::this_thread::get_id()) == thread_ids.end());
+
+        pool.join();
+    }
+
     TEST_CASE("Если заявлено меньше двух потоков, то алгоритм откатывается на однопоточный вариант")
     {
         std::vector<std::uint8_t> unsorted{0, 5, 1, 6, 2, 111};
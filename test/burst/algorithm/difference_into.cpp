@@ -0,0 +1,108 @@
+#include <burst/algorithm/difference_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_SUITE("difference_into")
+{
+    TEST_CASE("Разность пустых диапазонов пуста")
+    {
+        std::vector<int> minuend;
+        std::vector<int> subtrahend;
+
+        std::vector<int> difference;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(difference));
+
+        CHECK(difference.empty());
+    }
+
+    TEST_CASE("Разность с пустым вычитаемым — само уменьшаемое")
+    {
+        const auto minuend = burst::make_vector({1, 2, 2, 5});
+        const auto subtrahend = std::vector<int>{};
+
+        std::vector<int> difference;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(difference));
+
+        CHECK(difference == minuend);
+    }
+
+    TEST_CASE("Каждый элемент вычитаемого вычёркивает не более одного элемента уменьшаемого")
+    {
+        const auto minuend = burst::make_vector({1, 1, 2, 3, 3, 3, 7});
+        const auto subtrahend = burst::make_vector({0, 1, 3, 3, 4, 5, 6});
+
+        std::vector<int> difference;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(difference));
+
+        CHECK(difference == std::vector<int>{1, 2, 3, 7});
+    }
+
+    TEST_CASE("Возвращает итератор за последним записанным элементом")
+    {
+        const auto minuend = burst::make_vector({1, 2, 3});
+        const auto subtrahend = burst::make_vector({2});
+
+        int difference[5] = {0, 0, 0, 0, 0};
+        const auto end = burst::difference_into(minuend, subtrahend, std::begin(difference));
+
+        CHECK(end == std::begin(difference) + 2);
+        CHECK(std::equal(std::begin(difference), end, std::begin({1, 3})));
+    }
+
+    TEST_CASE("Принимает диапазоны разных типов с одинаковыми элементами")
+    {
+        const auto minuend = burst::make_list({'a', 'b', 'c', 'x'});
+        const auto subtrahend = std::string("bcdefg");
+
+        std::string difference;
+        burst::difference_into(minuend, subtrahend, std::back_inserter(difference));
+
+        CHECK(difference == "ax");
+    }
+
+    TEST_CASE("Принимает отношение порядка")
+    {
+        const auto minuend = burst::make_vector({9, 6, 3});
+        const auto subtrahend = burst::make_vector({9, 7, 3, 1});
+
+        std::vector<int> difference;
+        burst::difference_into(minuend, subtrahend, std::greater<>{}, std::back_inserter(difference));
+
+        CHECK(difference == std::vector<int>{6});
+    }
+
+    TEST_CASE("Совпадает со стандартной разностью для случайных диапазонов")
+    {
+        std::mt19937 engine{};
+        for (auto attempt = 0; attempt < 300; ++attempt)
+        {
+            const auto max_value = std::uniform_int_distribution<int>(1, 1000)(engine);
+            auto size = std::uniform_int_distribution<std::size_t>(0, 500);
+            auto value = std::uniform_int_distribution<int>(0, max_value);
+
+            std::vector<int> minuend(size(engine));
+            std::generate(minuend.begin(), minuend.end(), [& engine, & value] {return value(engine);});
+            std::sort(minuend.begin(), minuend.end());
+            std::vector<int> subtrahend(size(engine));
+            std::generate(subtrahend.begin(), subtrahend.end(), [& engine, & value] {return value(engine);});
+            std::sort(subtrahend.begin(), subtrahend.end());
+
+            std::vector<int> difference;
+            burst::difference_into(minuend, subtrahend, std::back_inserter(difference));
+
+            std::vector<int> expected;
+            std::set_difference(minuend.begin(), minuend.end(), subtrahend.begin(), subtrahend.end(),
+                std::back_inserter(expected));
+            REQUIRE(difference == expected);
+        }
+    }
+}
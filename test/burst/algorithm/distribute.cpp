@@ -0,0 +1,132 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/distribute.hpp>
+#include <burst/algorithm/write_combining.hpp>
+#include <burst/functional/low_bits.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <typename Values, typename Result, typename Boundaries, typename Map>
+    bool is_distributed (const Values & values, const Result & result, const Boundaries & boundaries, Map map)
+    {
+        using std::begin;
+        using std::end;
+        for (auto bucket = 0ul; bucket + 1 < boundaries.size(); ++bucket)
+        {
+            auto expected = Result{};
+            std::copy_if(begin(values), end(values), std::back_inserter(expected),
+                [& map, bucket] (const auto & x) {return static_cast<std::size_t>(map(x)) == bucket;});
+
+            const auto bucket_begin = std::next(result.begin(), boundaries[bucket]);
+            const auto bucket_end = std::next(result.begin(), boundaries[bucket + 1]);
+            if (not std::equal(bucket_begin, bucket_end, expected.begin(), expected.end()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_SUITE("distribute")
+{
+    TEST_CASE("Раскладывает элементы по корзинам и возвращает их границы")
+    {
+        const auto values = std::vector<std::uint8_t>{3, 1, 3, 0, 1};
+        auto result = std::vector<std::uint8_t>(values.size());
+
+        const auto boundaries = burst::distribute(values.begin(), values.end(), result.begin(), burst::low_bits<2>);
+
+        CHECK(result == std::vector<std::uint8_t>{0, 1, 1, 3, 3});
+        CHECK(boundaries == std::vector<std::ptrdiff_t>{0, 1, 3, 3, 5});
+    }
+
+    TEST_CASE("Сохраняет порядок элементов внутри корзины")
+    {
+        using record = std::pair<std::uint8_t, char>;
+        const auto records = std::list<record>{{1, 'a'}, {0, 'b'}, {1, 'c'}, {0, 'd'}, {2, 'e'}};
+        auto result = std::vector<record>(records.size());
+        const auto bucket = [] (const record & r) {return r.first;};
+
+        const auto boundaries = burst::distribute(records, result.begin(), bucket);
+
+        CHECK(result == (std::vector<record>{{0, 'b'}, {0, 'd'}, {1, 'a'}, {1, 'c'}, {2, 'e'}}));
+        CHECK(boundaries[0] == 0);
+        CHECK(boundaries[1] == 2);
+        CHECK(boundaries[2] == 4);
+        CHECK(boundaries[3] == 5);
+        CHECK(boundaries.back() == 5);
+    }
+
+    TEST_CASE("Пустой диапазон даёт пустые корзины")
+    {
+        const auto values = std::vector<std::uint16_t>{};
+        auto result = std::vector<std::uint16_t>{};
+
+        const auto boundaries = burst::distribute(values, result.begin(), burst::low_bits<4>);
+
+        CHECK(boundaries == std::vector<std::ptrdiff_t>(17, 0));
+    }
+
+    TEST_CASE("Параллельное распределение совпадает с последовательным")
+    {
+        for (auto size: {1ul, 1000ul, 100001ul})
+        {
+            const auto values = utility::random_vector<std::uint64_t>(size, 0, 1000000000);
+            const auto bucket = burst::low_bits<10>;
+
+            auto sequential = std::vector<std::uint64_t>(size);
+            const auto sequential_boundaries = burst::distribute(values, sequential.begin(), bucket);
+            CHECK(is_distributed(values, sequential, sequential_boundaries, bucket));
+
+            auto parallel = std::vector<std::uint64_t>(size);
+            const auto parallel_boundaries = burst::distribute(burst::par(3), values, parallel.begin(), bucket);
+            CHECK(parallel_boundaries == sequential_boundaries);
+            CHECK(parallel == sequential);
+        }
+    }
+
+    TEST_CASE("Распределяет через буферы объединения записи")
+    {
+        const auto values = utility::random_vector<std::uint32_t>(50000, 0, 1000000);
+        const auto bucket = burst::low_bits<8>;
+
+        auto expected = std::vector<std::uint32_t>(values.size());
+        const auto expected_boundaries = burst::distribute(values, expected.begin(), bucket);
+
+        auto sequential = std::vector<std::uint32_t>(values.size());
+        CHECK(burst::distribute(values.begin(), values.end(), sequential.begin(), bucket, burst::write_combining) == expected_boundaries);
+        CHECK(sequential == expected);
+
+        auto parallel = std::vector<std::uint32_t>(values.size());
+        CHECK(burst::distribute(burst::par(4), values.begin(), values.end(), parallel.begin(), bucket, burst::write_combining) == expected_boundaries);
+        CHECK(parallel == expected);
+    }
+
+    TEST_CASE("Параллельный вариант исполняется в переданном пуле потоков")
+    {
+        boost::asio::thread_pool pool(2);
+        const auto values = utility::random_vector<std::uint16_t>(30000, 0, 65535);
+        const auto bucket = burst::low_bits<6>;
+
+        auto expected = std::vector<std::uint16_t>(values.size());
+        const auto expected_boundaries = burst::distribute(values, expected.begin(), bucket);
+
+        auto result = std::vector<std::uint16_t>(values.size());
+        CHECK(burst::distribute(burst::par(pool, 2), values, result.begin(), bucket) == expected_boundaries);
+        CHECK(result == expected);
+        pool.join();
+    }
+}
@@ -0,0 +1,305 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/external_radix_sort.hpp>
+#include <burst/functional/low_bits.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <typename Value>
+    std::string to_binary (const std::vector<Value> & values)
+    {
+        return std::string(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(Value));
+    }
+
+    template <typename Value>
+    std::vector<Value> from_binary (const std::string & bytes)
+    {
+        std::vector<Value> values(bytes.size() / sizeof(Value));
+        std::copy(bytes.begin(), bytes.end(), reinterpret_cast<char *>(values.data()));
+        return values;
+    }
+
+    struct make_string_run
+    {
+        std::unique_ptr<std::iostream> operator () () const
+        {
+            ++*run_count;
+            return std::make_unique<std::stringstream>();
+        }
+
+        std::size_t * run_count;
+    };
+
+    //!     Хранилище серий, запись в которое не удаётся, как на переполненном диске.
+    struct make_failing_run
+    {
+        std::unique_ptr<std::iostream> operator () () const
+        {
+            auto run = std::make_unique<std::stringstream>();
+            run->setstate(std::ios::badbit);
+            return run;
+        }
+    };
+
+    struct read_error
+    {
+    };
+
+    //!     Буфер, чтение из которого за пределами уже доступных данных обрывается ошибкой.
+    class failing_read_buffer: public std::stringbuf
+    {
+    public:
+        using std::stringbuf::stringbuf;
+
+    protected:
+        int_type underflow () override
+        {
+            throw read_error{};
+        }
+    };
+
+    //!     Поток, чтение из которого не удаётся, как при сбое диска.
+    class unreadable_stream: public std::iostream
+    {
+    public:
+        explicit unreadable_stream (const std::string & bytes = std::string{}):
+            std::iostream(nullptr),
+            m_buffer(bytes)
+        {
+            rdbuf(std::addressof(m_buffer));
+        }
+
+    private:
+        failing_read_buffer m_buffer;
+    };
+
+    struct make_unreadable_run
+    {
+        std::unique_ptr<std::iostream> operator () () const
+        {
+            return std::make_unique<unreadable_stream>();
+        }
+    };
+}
+
+TEST_SUITE("external_radix_sort")
+{
+    TEST_CASE("Пустой поток остаётся пустым")
+    {
+        std::stringstream input;
+        std::stringstream output;
+        std::size_t run_count = 0;
+
+        burst::external_radix_sort<std::uint64_t>(input, output, 1024, make_string_run{&run_count});
+
+        CHECK(output.str().empty());
+        CHECK(run_count == 0);
+    }
+
+    TEST_CASE("Если данные умещаются в бюджет памяти, то серии не создаются")
+    {
+        const auto values = utility::random_vector<std::uint64_t>(100, 0, std::numeric_limits<std::uint64_t>::max());
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        std::stringstream input(to_binary(values));
+        std::stringstream output;
+        std::size_t run_count = 0;
+
+        burst::external_radix_sort<std::uint64_t>(input, output, 2 * sizeof(std::uint64_t) * values.size(), make_string_run{&run_count});
+
+        CHECK(from_binary<std::uint64_t>(output.str()) == expected);
+        CHECK(run_count == 0);
+    }
+
+    TEST_CASE_TEMPLATE("Данные, не умещающиеся в бюджет памяти, сортируются через серии", integer_type,
+        std::uint32_t, std::int64_t)
+    {
+        const auto values =
+            utility::random_vector<integer_type>
+            (
+                10007,
+                std::numeric_limits<integer_type>::min(),
+                std::numeric_limits<integer_type>::max()
+            );
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        const auto block_size = std::size_t{1000};
+        const auto memory_budget = 2 * sizeof(integer_type) * block_size;
+
+        SUBCASE("при последовательной сортировке")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+            std::size_t run_count = 0;
+
+            burst::external_radix_sort<integer_type>(input, output, memory_budget, make_string_run{&run_count});
+
+            CHECK(from_binary<integer_type>(output.str()) == expected);
+            CHECK(run_count == 11);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+            std::size_t run_count = 0;
+
+            burst::external_radix_sort<integer_type>(burst::par(3), input, output, memory_budget, make_string_run{&run_count});
+
+            CHECK(from_binary<integer_type>(output.str()) == expected);
+            CHECK(run_count == 11);
+        }
+    }
+
+    TEST_CASE("Принимает отображение и функцию выделения разряда")
+    {
+        const auto values = utility::random_vector<std::uint32_t>(5000, 0, std::numeric_limits<std::uint32_t>::max());
+        auto expected = values;
+        std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+        std::stringstream input(to_binary(values));
+        std::stringstream output;
+        std::size_t run_count = 0;
+
+        burst::external_radix_sort<std::uint32_t>(input, output, 4000, make_string_run{&run_count},
+            [] (std::uint32_t n) {return ~n;},
+            burst::low_bits<11>);
+
+        CHECK(from_binary<std::uint32_t>(output.str()) == expected);
+    }
+
+    TEST_CASE("Бюджет памяти должен вмещать хотя бы два объекта")
+    {
+        std::stringstream input(to_binary(std::vector<std::uint64_t>{3, 2, 1}));
+        std::stringstream output;
+        std::size_t run_count = 0;
+
+        CHECK_THROWS_AS
+        (
+            burst::external_radix_sort<std::uint64_t>(input, output, 15, make_string_run{&run_count}),
+            std::invalid_argument
+        );
+    }
+
+    TEST_CASE("Сообщает об ошибке записи в выходной поток")
+    {
+        const auto values = utility::random_vector<std::uint64_t>(100, 0, std::numeric_limits<std::uint64_t>::max());
+        const auto memory_budget = 2 * sizeof(std::uint64_t) * values.size();
+        std::size_t run_count = 0;
+
+        SUBCASE("когда серии не создаются")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+            output.setstate(std::ios::badbit);
+
+            CHECK_THROWS_AS
+            (
+                burst::external_radix_sort<std::uint64_t>(input, output, memory_budget, make_string_run{&run_count}),
+                std::runtime_error
+            );
+        }
+        SUBCASE("при слиянии серий")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+            output.setstate(std::ios::badbit);
+
+            CHECK_THROWS_AS
+            (
+                burst::external_radix_sort<std::uint64_t>(input, output, memory_budget / 4, make_string_run{&run_count}),
+                std::runtime_error
+            );
+        }
+    }
+
+    TEST_CASE("Сообщает об ошибке чтения входного потока")
+    {
+        const auto values = utility::random_vector<std::uint64_t>(100, 0, std::numeric_limits<std::uint64_t>::max());
+        const auto memory_budget = 2 * sizeof(std::uint64_t) * values.size();
+        std::size_t run_count = 0;
+
+        unreadable_stream input(to_binary(values));
+        std::stringstream output;
+
+        CHECK_THROWS_AS
+        (
+            burst::external_radix_sort<std::uint64_t>(input, output, memory_budget, make_string_run{&run_count}),
+            std::runtime_error
+        );
+    }
+
+    TEST_CASE("Сообщает об ошибке чтения серии")
+    {
+        const auto values = utility::random_vector<std::uint64_t>(100, 0, std::numeric_limits<std::uint64_t>::max());
+        const auto memory_budget = 2 * sizeof(std::uint64_t) * values.size() / 4;
+
+        SUBCASE("при последовательной сортировке")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+
+            CHECK_THROWS_AS
+            (
+                burst::external_radix_sort<std::uint64_t>(input, output, memory_budget, make_unreadable_run{}),
+                std::runtime_error
+            );
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+
+            CHECK_THROWS_AS
+            (
+                burst::external_radix_sort<std::uint64_t>(burst::par(2), input, output, memory_budget,
+                    make_unreadable_run{}),
+                std::runtime_error
+            );
+        }
+    }
+
+    TEST_CASE("Сообщает об ошибке записи серии")
+    {
+        const auto values = utility::random_vector<std::uint64_t>(100, 0, std::numeric_limits<std::uint64_t>::max());
+        const auto memory_budget = 2 * sizeof(std::uint64_t) * values.size() / 4;
+
+        SUBCASE("при последовательной сортировке")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+
+            CHECK_THROWS_AS
+            (
+                burst::external_radix_sort<std::uint64_t>(input, output, memory_budget, make_failing_run{}),
+                std::runtime_error
+            );
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            std::stringstream input(to_binary(values));
+            std::stringstream output;
+
+            CHECK_THROWS_AS
+            (
+                burst::external_radix_sort<std::uint64_t>(burst::par(2), input, output, memory_budget,
+                    make_failing_run{}),
+                std::runtime_error
+            );
+        }
+    }
+}
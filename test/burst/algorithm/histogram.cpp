@@ -0,0 +1,78 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/histogram.hpp>
+#include <burst/functional/low_bits.hpp>
+#include <burst/functional/low_byte.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <numeric>
+#include <vector>
+
+TEST_SUITE("histogram")
+{
+    TEST_CASE("Подсчитывает количество элементов с каждым значением образа")
+    {
+        const auto values = std::vector<std::uint8_t>{3, 1, 3, 0, 255, 3};
+
+        const auto counters = burst::histogram(values.begin(), values.end());
+
+        REQUIRE(counters.size() == 256);
+        CHECK(counters[0] == 1);
+        CHECK(counters[1] == 1);
+        CHECK(counters[2] == 0);
+        CHECK(counters[3] == 3);
+        CHECK(counters[255] == 1);
+        CHECK(std::accumulate(counters.begin(), counters.end(), std::ptrdiff_t{0}) == 6);
+    }
+
+    TEST_CASE("Количество счётчиков определяется разрядностью образа")
+    {
+        const auto values = std::vector<std::uint32_t>{0x1234, 0x0034, 0x07ff, 0xffff};
+
+        const auto counters = burst::histogram(values, burst::low_bits<11>);
+
+        REQUIRE(counters.size() == 2048);
+        CHECK(counters[0x234] == 1);
+        CHECK(counters[0x034] == 1);
+        CHECK(counters[0x7ff] == 2);
+    }
+
+    TEST_CASE("Знаковые образы смещаются на половину диапазона значений")
+    {
+        const auto values = std::vector<std::int8_t>{-128, -1, 0, 0, 127};
+
+        const auto counters = burst::histogram(values);
+
+        CHECK(counters[0] == 1);
+        CHECK(counters[127] == 1);
+        CHECK(counters[128] == 2);
+        CHECK(counters[255] == 1);
+    }
+
+    TEST_CASE("Принимает однонаправленные диапазоны")
+    {
+        const auto values = std::forward_list<std::uint16_t>{0x0101, 0x0201, 0x0102};
+
+        const auto counters = burst::histogram(values, burst::low_byte);
+
+        CHECK(counters[1] == 2);
+        CHECK(counters[2] == 1);
+    }
+
+    TEST_CASE("Параллельная гистограмма совпадает с последовательной")
+    {
+        for (auto size: {1ul, 1000ul, 100001ul})
+        {
+            const auto values = utility::random_vector<std::uint32_t>(size, 0, 1000000);
+
+            const auto sequential = burst::histogram(values, burst::low_bits<12>);
+            const auto parallel = burst::histogram(burst::par(3), values, burst::low_bits<12>);
+
+            CHECK(parallel == sequential);
+        }
+    }
+}
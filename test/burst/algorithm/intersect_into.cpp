@@ -0,0 +1,192 @@
+#include <burst/algorithm/intersect_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    template <typename Integer>
+    std::vector<Integer> random_sorted_vector (std::size_t size, Integer max_value, std::mt19937 & engine)
+    {
+        std::uniform_int_distribution<Integer> uniform(0, max_value);
+
+        std::vector<Integer> values(size);
+        std::generate(values.begin(), values.end(), [& engine, & uniform] {return uniform(engine);});
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    template <typename Integer>
+    std::vector<Integer> naive_intersection (std::vector<std::vector<Integer>> ranges)
+    {
+        auto intersection = ranges.front();
+        for (const auto & range: ranges)
+        {
+            std::vector<Integer> next;
+            std::set_intersection(intersection.begin(), intersection.end(), range.begin(), range.end(),
+                std::back_inserter(next));
+            intersection = std::move(next);
+        }
+        return intersection;
+    }
+}
+
+TEST_SUITE("intersect_into")
+{
+    TEST_CASE("Пересечение пустых диапазонов пусто")
+    {
+        std::vector<std::uint32_t> first;
+        std::vector<std::uint32_t> second;
+
+        std::vector<std::uint32_t> intersection;
+        burst::intersect_into(std::tie(first, second), std::back_inserter(intersection));
+
+        CHECK(intersection.empty());
+    }
+
+    TEST_CASE("Пересечение одного диапазона — сам этот диапазон")
+    {
+        const auto only = burst::make_vector<std::uint64_t>({1, 2, 2, 5});
+        const auto ranges = burst::make_vector({only});
+
+        std::vector<std::uint64_t> intersection;
+        burst::intersect_into(ranges, std::back_inserter(intersection));
+
+        CHECK(intersection == only);
+    }
+
+    TEST_CASE("Пересекает целые числа")
+    {
+        const auto natural = burst::make_vector<std::uint32_t>({1, 2, 3, 4, 5, 6, 7});
+        const auto prime = burst::make_vector<std::uint32_t>({2, 3, 5, 7});
+        const auto odd = burst::make_vector<std::uint32_t>({1, 3, 5, 7});
+
+        std::vector<std::uint32_t> intersection;
+        burst::intersect_into(std::tie(natural, prime, odd), std::back_inserter(intersection));
+
+        CHECK(intersection == std::vector<std::uint32_t>{3, 5, 7});
+    }
+
+    TEST_CASE("Возвращает итератор за последним записанным элементом")
+    {
+        const auto first = burst::make_vector<std::uint32_t>({1, 2, 3, 4, 5});
+        const auto second = burst::make_vector<std::uint32_t>({2, 4, 6});
+
+        std::uint32_t intersection[5] = {};
+        const auto intersection_end = burst::intersect_into(std::tie(first, second), intersection);
+
+        CHECK(std::distance(intersection, intersection_end) == 2);
+        CHECK(intersection[0] == 2);
+        CHECK(intersection[1] == 4);
+    }
+
+    TEST_CASE("Повторяющиеся элементы входят в пересечение столько раз, сколько их в каждом из "
+        "диапазонов")
+    {
+        const auto first = burst::make_vector<std::int32_t>({-5, -5, 0, 0, 0, 1, 1, 1, 1, 2, 3, 3, 3, 4, 4, 4});
+        const auto second = burst::make_vector<std::int32_t>({-5, 0, 0, 1, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 4, 5});
+
+        std::vector<std::int32_t> intersection;
+        burst::intersect_into(std::tie(first, second), std::back_inserter(intersection));
+
+        CHECK(intersection == burst::make_vector<std::int32_t>({-5, 0, 0, 1, 1, 1, 1, 2, 3, 3, 4, 4, 4}));
+    }
+
+    TEST_CASE("Беззнаковые числа с взведённым старшим битом упорядочиваются как беззнаковые")
+    {
+        const auto big = std::uint32_t{1} << 31;
+        const auto first = burst::make_vector<std::uint32_t>({1, 2, 3, 4, 5, big, big + 1, big + 2, big + 3, big + 4});
+        const auto second = burst::make_vector<std::uint32_t>({0, 2, 4, 6, 8, big + 1, big + 3, big + 5, big + 7});
+
+        std::vector<std::uint32_t> intersection;
+        burst::intersect_into(std::tie(first, second), std::back_inserter(intersection));
+
+        CHECK(intersection == burst::make_vector<std::uint32_t>({2, 4, big + 1, big + 3}));
+    }
+
+    TEST_CASE_TEMPLATE("Совпадает с последовательным применением std::set_intersection", Integer,
+        std::uint32_t, std::uint64_t, std::int32_t, std::int64_t)
+    {
+        std::mt19937 engine;
+        const auto sizes = {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{100}, std::size_t{5000}};
+        for (auto range_count = 1; range_count <= 4; ++range_count)
+        {
+            for (auto size: sizes)
+            {
+                for (auto max_value: {Integer{10}, Integer{1000}, Integer{100000}})
+                {
+                    std::vector<std::vector<Integer>> ranges;
+                    for (auto i = 0; i < range_count; ++i)
+                    {
+                        ranges.push_back(random_sorted_vector(size << (2 * i), max_value, engine));
+                    }
+
+                    std::vector<Integer> intersection;
+                    burst::intersect_into(ranges, std::back_inserter(intersection));
+
+                    CHECK(intersection == naive_intersection(ranges));
+                }
+            }
+        }
+    }
+
+    TEST_CASE("Пересекает короткий диапазон с намного более длинным")
+    {
+        std::mt19937 engine;
+        const auto long_range = random_sorted_vector<std::uint32_t>(100000, 200000, engine);
+        const auto short_range = random_sorted_vector<std::uint32_t>(50, 200000, engine);
+
+        std::vector<std::uint32_t> intersection;
+        burst::intersect_into(std::tie(long_range, short_range), std::back_inserter(intersection));
+
+        CHECK(intersection == naive_intersection<std::uint32_t>({short_range, long_range}));
+    }
+
+    TEST_CASE("Пересекает диапазоны с произвольным отношением порядка")
+    {
+        const auto first = burst::make_vector<std::string>({"ccc", "bb", "a"});
+        const auto second = burst::make_vector<std::string>({"cccc", "bb", "a"});
+        const auto third = burst::make_vector<std::string>({"bb", "a", ""});
+
+        std::vector<std::string> intersection;
+        burst::intersect_into(std::tie(first, second, third),
+            [] (const auto & left, const auto & right) {return left.size() > right.size();},
+            std::back_inserter(intersection));
+
+        CHECK(intersection == burst::make_vector<std::string>({"bb", "a"}));
+    }
+
+    TEST_CASE("Пересекает разнотипные диапазоны")
+    {
+        const auto first = burst::make_vector({1, 2, 3, 4, 5});
+        const auto second = burst::make_list({2, 4, 6});
+
+        std::vector<int> intersection;
+        burst::intersect_into(std::tie(first, second), std::back_inserter(intersection));
+
+        CHECK(intersection == burst::make_vector({2, 4}));
+    }
+
+    TEST_CASE("Не изменяет входные диапазоны")
+    {
+        const auto first = burst::make_vector<std::uint32_t>({1, 2, 3});
+        const auto second = burst::make_vector<std::uint32_t>({2, 3, 4});
+        auto ranges = burst::make_vector({boost::make_iterator_range(first), boost::make_iterator_range(second)});
+
+        std::vector<std::uint32_t> intersection;
+        burst::intersect_into(ranges, std::back_inserter(intersection));
+
+        CHECK(ranges[0] == first);
+        CHECK(ranges[1] == second);
+    }
+}
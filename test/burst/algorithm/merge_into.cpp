@@ -0,0 +1,168 @@
+#include <burst/algorithm/merge_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+TEST_SUITE("merge_into")
+{
+    TEST_CASE("Слияние пустых диапазонов пусто")
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+
+        std::vector<int> merged;
+        burst::merge_into(std::tie(first, second), std::back_inserter(merged));
+
+        CHECK(merged.empty());
+    }
+
+    TEST_CASE("Слияние одного диапазона — сам этот диапазон")
+    {
+        const auto only = burst::make_vector({1, 2, 2, 5});
+        const auto ranges = burst::make_vector({only});
+
+        std::vector<int> merged;
+        burst::merge_into(ranges, std::back_inserter(merged));
+
+        CHECK(merged == only);
+    }
+
+    TEST_CASE("Сливает упорядоченные диапазоны")
+    {
+        const auto first = burst::make_vector({1, 4, 7});
+        const auto second = burst::make_vector({2, 5, 8});
+        const auto third = burst::make_vector({3, 6, 9});
+
+        std::vector<int> merged;
+        burst::merge_into(std::tie(first, second, third), std::back_inserter(merged));
+
+        CHECK(merged == std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    TEST_CASE("Возвращает итератор за последним записанным элементом")
+    {
+        const auto first = burst::make_vector({1, 3});
+        const auto second = burst::make_vector({2});
+
+        int merged[5] = {0, 0, 0, 0, 0};
+        const auto end = burst::merge_into(std::tie(first, second), std::begin(merged));
+
+        CHECK(end == std::begin(merged) + 3);
+        CHECK(std::equal(std::begin(merged), end, std::begin({1, 2, 3})));
+    }
+
+    TEST_CASE("Не изменяет входные диапазоны")
+    {
+        const auto first = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+        const auto second = burst::make_vector({11, 12});
+        auto ranges = burst::make_vector({first, second});
+
+        std::vector<int> merged;
+        burst::merge_into(ranges, std::back_inserter(merged));
+
+        CHECK(ranges == burst::make_vector({first, second}));
+    }
+
+    TEST_CASE("Резервирует место сразу под всё слияние")
+    {
+        const auto first = burst::make_vector({1, 3, 5, 7, 9});
+        const auto second = burst::make_vector({2, 4, 6, 8, 10, 12, 14});
+
+        auto merged = burst::make_vector({0});
+        burst::merge_into(std::tie(first, second), std::back_inserter(merged));
+
+        CHECK(merged.size() == 13);
+        CHECK(merged.capacity() == 13);
+    }
+
+    TEST_CASE("Сливает диапазоны разных типов с одинаковыми элементами")
+    {
+        const auto first = burst::make_list({'a', 'c', 'e'});
+        const auto second = std::string("bdf");
+
+        std::string merged;
+        burst::merge_into(std::tie(first, second), std::back_inserter(merged));
+
+        CHECK(merged == "abcdef");
+    }
+
+    TEST_CASE("Принимает отношение порядка")
+    {
+        const auto first = burst::make_vector({9, 6, 3});
+        const auto second = burst::make_vector({8, 7, 2, 1});
+
+        std::vector<int> merged;
+        burst::merge_into(std::tie(first, second), std::greater<>{}, std::back_inserter(merged));
+
+        CHECK(merged == std::vector<int>{9, 8, 7, 6, 3, 2, 1});
+    }
+
+    TEST_CASE("Копирует длинные серии одного диапазона целиком")
+    {
+        const auto first = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 30});
+        const auto second = burst::make_vector({16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29});
+        const auto third = burst::make_vector({15, 31});
+
+        std::vector<int> merged;
+        burst::merge_into(std::tie(first, second, third), std::back_inserter(merged));
+
+        auto expected = first;
+        expected.insert(expected.end(), second.begin(), second.end());
+        expected.insert(expected.end(), third.begin(), third.end());
+        std::sort(expected.begin(), expected.end());
+        CHECK(merged == expected);
+    }
+
+    TEST_CASE("Копирует длинные серии из диапазонов, не являющихся диапазонами произвольного доступа")
+    {
+        const auto first = burst::make_list({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30});
+        const auto second = burst::make_list({11, 12, 13, 14, 15, 16, 17, 18, 19, 20});
+
+        std::vector<int> merged;
+        burst::merge_into(std::tie(first, second), std::back_inserter(merged));
+
+        std::vector<int> expected(30);
+        std::iota(expected.begin(), expected.end(), 1);
+        CHECK(merged == expected);
+    }
+
+    TEST_CASE("Совпадает с сортировкой всех элементов для случайных диапазонов")
+    {
+        std::mt19937 engine{};
+        for (auto attempt = 0; attempt < 300; ++attempt)
+        {
+            const auto range_count = std::uniform_int_distribution<std::size_t>(1, 9)(engine);
+            const auto max_size = std::uniform_int_distribution<std::size_t>(0, 300)(engine);
+            const auto max_value = std::uniform_int_distribution<int>(1, 1000)(engine);
+            auto size = std::uniform_int_distribution<std::size_t>(0, max_size);
+            auto value = std::uniform_int_distribution<int>(0, max_value);
+
+            std::vector<std::vector<int>> ranges(range_count);
+            std::vector<int> expected;
+            for (auto & range: ranges)
+            {
+                range.resize(size(engine));
+                std::generate(range.begin(), range.end(), [& engine, & value] {return value(engine);});
+                std::sort(range.begin(), range.end());
+                expected.insert(expected.end(), range.begin(), range.end());
+            }
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<int> merged;
+            burst::merge_into(ranges, std::back_inserter(merged));
+
+            REQUIRE(merged == expected);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/radix_argsort.hpp>
+#include <burst/integer/to_ordered_integral.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+TEST_SUITE("radix_argsort")
+{
+    TEST_CASE("Перестановка пустого диапазона пуста")
+    {
+        const auto values = std::vector<std::uint32_t>{};
+        std::vector<std::size_t> indices;
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_argsort(values, std::back_inserter(indices));
+            CHECK(indices.empty());
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            const auto end = burst::radix_argsort(burst::par(3), values, indices.begin());
+            CHECK(end == indices.begin());
+        }
+    }
+
+    TEST_CASE("Не изменяет входной диапазон")
+    {
+        const auto initial = std::vector<std::uint32_t>{5, 3, 1, 4, 2};
+        auto values = initial;
+        std::vector<std::size_t> indices(values.size());
+
+        burst::radix_argsort(values.begin(), values.end(), indices.begin());
+
+        CHECK(values == initial);
+    }
+
+    TEST_CASE("Возвращает перестановку, упорядочивающую входной диапазон")
+    {
+        const auto values = std::vector<std::uint32_t>{50, 30, 10, 40, 20};
+        std::vector<std::size_t> indices(values.size());
+        const auto expected = std::vector<std::size_t>{2, 4, 1, 3, 0};
+
+        SUBCASE("при последовательной сортировке")
+        {
+            const auto end = burst::radix_argsort(values.begin(), values.end(), indices.begin());
+            CHECK(end == indices.end());
+            CHECK(indices == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            const auto end = burst::radix_argsort(burst::par(2), values.begin(), values.end(), indices.begin());
+            CHECK(end == indices.end());
+            CHECK(indices == expected);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Упорядочивает по возрастанию образов так же, как устойчивая сортировка "
+        "индексов", integer_type, std::uint16_t, std::int32_t, std::uint64_t)
+    {
+        for (auto size: {10ul, 999ul, 10000ul})
+        {
+            const auto values =
+                utility::random_vector<integer_type>
+                (
+                    size,
+                    std::numeric_limits<integer_type>::min(),
+                    std::numeric_limits<integer_type>::max() / 1000
+                );
+
+            std::vector<std::size_t> expected(values.size());
+            std::iota(expected.begin(), expected.end(), std::size_t{0});
+            std::stable_sort(expected.begin(), expected.end(),
+                [& values] (auto i, auto j) {return values[i] < values[j];});
+
+            std::vector<std::size_t> sequential(values.size());
+            burst::radix_argsort(values, sequential.begin());
+            CHECK(sequential == expected);
+
+            std::vector<std::size_t> parallel(values.size());
+            burst::radix_argsort(burst::par(4), values, parallel.begin());
+            CHECK(parallel == expected);
+        }
+    }
+
+    TEST_CASE("Сортировка устойчива")
+    {
+        const auto values = std::vector<std::uint32_t>{7, 1, 7, 1, 7, 1};
+        const auto expected = std::vector<std::uint32_t>{1, 3, 5, 0, 2, 4};
+        std::vector<std::uint32_t> indices(values.size());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_argsort(values, indices.begin());
+            CHECK(indices == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_argsort(burst::par(3), values, indices.begin());
+            CHECK(indices == expected);
+        }
+    }
+
+    TEST_CASE("Сортирует тяжёлые объекты по ключу, заданному отображением")
+    {
+        struct record
+        {
+            double timestamp;
+            std::string payload;
+        };
+        const auto records =
+            std::vector<record>
+            {
+                {3.5, "c"},
+                {-1.0, "a"},
+                {100.0, "d"},
+                {0.0, "b"}
+            };
+        const auto timestamp =
+            [] (const record & r)
+            {
+                return burst::to_ordered_integral(r.timestamp);
+            };
+        const auto expected = std::vector<std::size_t>{1, 3, 0, 2};
+        std::vector<std::size_t> indices(records.size());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_argsort(records, indices.begin(), timestamp);
+            CHECK(indices == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_argsort(burst::par(2), records, indices.begin(), timestamp);
+            CHECK(indices == expected);
+        }
+    }
+
+    TEST_CASE("Параллельная сортировка может исполняться в пуле потоков вызывающей стороны")
+    {
+        boost::asio::thread_pool pool(2);
+
+        const auto values = utility::random_vector<std::uint32_t>(1000, 0, 100500);
+        std::vector<std::size_t> indices(values.size());
+        burst::radix_argsort(burst::par(pool, 2), values, indices.begin());
+
+        CHECK(std::is_sorted(indices.begin(), indices.end(),
+            [& values] (auto i, auto j) {return values[i] < values[j];}));
+    }
+
+    TEST_CASE("Если заявлено меньше двух потоков, то алгоритм откатывается на однопоточный вариант")
+    {
+        std::vector<std::uint32_t> numbers{0, 5, 1, 6, 2, 100500};
+
+        std::unordered_set<std::thread::id> thread_ids;
+        std::mutex m;
+
+        std::vector<std::size_t> indices(numbers.size());
+        burst::radix_argsort(burst::par(1), numbers.begin(), numbers.end(), indices.begin(),
+            [& thread_ids, & m] (auto x)
+            {
+                std::unique_lock<std::mutex> l(m);
+                thread_ids.insert(std::this_thread::get_id());
+                return x;
+            });
+
+        CHECK(thread_ids.size() == 1);
+        CHECK(thread_ids.find(std::this_thread::get_id()) != thread_ids.end());
+    }
+}
@@ -0,0 +1,82 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/radix_partial_sort.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/iterator/indirect_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+
+TEST_SUITE("radix_partial_sort")
+{
+    TEST_CASE("Пустой префикс оставляет диапазон без изменений")
+    {
+        const auto initial = std::vector<std::uint32_t>{5, 3, 1, 4, 2};
+
+        auto sequential = initial;
+        burst::radix_partial_sort(sequential.begin(), sequential.begin(), sequential.end());
+        CHECK(sequential == initial);
+
+        auto parallel = initial;
+        burst::radix_partial_sort(burst::par(2), parallel.begin(), parallel.begin(), parallel.end());
+        CHECK(parallel == initial);
+    }
+
+    TEST_CASE_TEMPLATE("Префикс совпадает с префиксом полностью отсортированного диапазона",
+        integer_type, std::uint8_t, std::int32_t, std::uint64_t)
+    {
+        const auto size = 30000ul;
+        const auto numbers =
+            utility::random_vector<integer_type>
+            (
+                size,
+                std::numeric_limits<integer_type>::min(),
+                std::numeric_limits<integer_type>::max()
+            );
+        auto sorted = numbers;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (auto prefix_size: {1ul, 10ul, 1000ul, size})
+        {
+            const auto prefix = static_cast<std::ptrdiff_t>(prefix_size);
+
+            auto sequential = numbers;
+            burst::radix_partial_sort(sequential.begin(), sequential.begin() + prefix, sequential.end());
+            CHECK(std::equal(sequential.begin(), sequential.begin() + prefix, sorted.begin()));
+            std::sort(sequential.begin() + prefix, sequential.end());
+            CHECK(sequential == sorted);
+
+            auto parallel = numbers;
+            burst::radix_partial_sort(burst::par(3), parallel, parallel.begin() + prefix);
+            CHECK(std::equal(parallel.begin(), parallel.begin() + prefix, sorted.begin()));
+            std::sort(parallel.begin() + prefix, parallel.end());
+            CHECK(parallel == sorted);
+        }
+    }
+
+    TEST_CASE("Допускает некопируемые объекты")
+    {
+        std::vector<std::unique_ptr<std::int64_t>> pointers;
+        for (auto n: {30, 5, -100500, 20152016, 0, 7, -3})
+        {
+            pointers.push_back(std::make_unique<std::int64_t>(n));
+        }
+
+        burst::radix_partial_sort(pointers, pointers.begin() + 3, [] (const auto & p) {return *p;});
+
+        const auto expected = {-100500, -3, 0};
+        CHECK(std::equal
+        (
+            boost::make_indirect_iterator(pointers.begin()),
+            boost::make_indirect_iterator(pointers.begin() + 3),
+            std::begin(expected)
+        ));
+    }
+}
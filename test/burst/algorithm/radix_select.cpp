@@ -0,0 +1,160 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/radix_select.hpp>
+#include <burst/functional/low_bits.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    template <typename Container, typename Iterator>
+    bool is_partitioned_by (Container & values, Iterator nth)
+    {
+        using std::begin;
+        using std::end;
+        return
+            std::all_of(begin(values), nth, [nth] (const auto & x) {return not (*nth < x);}) &&
+            std::all_of(nth, end(values), [nth] (const auto & x) {return not (x < *nth);});
+    }
+}
+
+TEST_SUITE("radix_select")
+{
+    TEST_CASE("Если искомая позиция совпадает с концом диапазона, то ничего не происходит")
+    {
+        const auto initial = std::vector<std::uint32_t>{5, 3, 1, 4, 2};
+        SUBCASE("при последовательном поиске")
+        {
+            auto values = initial;
+            burst::radix_select(values.begin(), values.end(), values.end());
+            CHECK(values == initial);
+        }
+        SUBCASE("при параллельном поиске")
+        {
+            auto values = initial;
+            burst::radix_select(burst::par(2), values.begin(), values.end(), values.end());
+            CHECK(values == initial);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("На искомую позицию встаёт тот же элемент, что и при полной сортировке",
+        integer_type, std::uint8_t, std::int16_t, std::uint32_t, std::int64_t)
+    {
+        for (auto size: {1ul, 50ul, 1000ul, 100000ul})
+        {
+            const auto numbers =
+                utility::random_vector<integer_type>
+                (
+                    size,
+                    std::numeric_limits<integer_type>::min(),
+                    std::numeric_limits<integer_type>::max()
+                );
+            auto sorted = numbers;
+            std::sort(sorted.begin(), sorted.end());
+
+            for (auto position: {std::size_t{0}, size / 3, size / 2, size - 1})
+            {
+                auto sequential = numbers;
+                const auto sequential_nth = std::next(sequential.begin(), static_cast<std::ptrdiff_t>(position));
+                burst::radix_select(sequential.begin(), sequential_nth, sequential.end());
+                CHECK(*sequential_nth == sorted[position]);
+                CHECK(is_partitioned_by(sequential, sequential_nth));
+
+                auto parallel = numbers;
+                const auto parallel_nth = std::next(parallel.begin(), static_cast<std::ptrdiff_t>(position));
+                burst::radix_select(burst::par(3), parallel.begin(), parallel_nth, parallel.end());
+                CHECK(*parallel_nth == sorted[position]);
+                CHECK(is_partitioned_by(parallel, parallel_nth));
+            }
+        }
+    }
+
+    TEST_CASE("Диапазон с малым количеством различных значений разбивается правильно")
+    {
+        const auto numbers = utility::random_vector<std::uint32_t>(20000, 1000000, 1000003);
+        auto sorted = numbers;
+        std::sort(sorted.begin(), sorted.end());
+
+        auto sequential = numbers;
+        burst::radix_select(sequential, sequential.begin() + 12345);
+        CHECK(sequential[12345] == sorted[12345]);
+        CHECK(is_partitioned_by(sequential, sequential.begin() + 12345));
+
+        auto parallel = numbers;
+        burst::radix_select(burst::par(4), parallel, parallel.begin() + 12345);
+        CHECK(parallel[12345] == sorted[12345]);
+        CHECK(is_partitioned_by(parallel, parallel.begin() + 12345));
+    }
+
+    TEST_CASE("Принимает те же отображение и функцию выделения разряда, что и поразрядная сортировка")
+    {
+        const auto numbers = utility::random_vector<std::uint32_t>(5000, 0, std::numeric_limits<std::uint32_t>::max());
+        auto sorted = numbers;
+        std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+
+        const auto descending = [] (std::uint32_t n) {return ~n;};
+
+        auto sequential = numbers;
+        burst::radix_select(sequential.begin(), sequential.begin() + 10, sequential.end(), descending, burst::low_bits<11>);
+        CHECK(sequential[10] == sorted[10]);
+
+        auto parallel = numbers;
+        burst::radix_select(burst::par(2), parallel, parallel.begin() + 4000, descending, burst::low_bits<11>);
+        CHECK(parallel[4000] == sorted[4000]);
+    }
+
+    TEST_CASE("Допускает некопируемые объекты")
+    {
+        std::vector<std::unique_ptr<std::int32_t>> pointers;
+        for (auto n: utility::random_vector<std::int32_t>(1000, -1000000, 1000000))
+        {
+            pointers.push_back(std::make_unique<std::int32_t>(n));
+        }
+        std::vector<std::int32_t> sorted;
+        std::transform(pointers.begin(), pointers.end(), std::back_inserter(sorted), [] (const auto & p) {return *p;});
+        std::sort(sorted.begin(), sorted.end());
+
+        burst::radix_select(burst::par(2), pointers, pointers.begin() + 500, [] (const auto & p) {return *p;});
+        CHECK(*pointers[500] == sorted[500]);
+    }
+
+    TEST_CASE("Параллельный поиск может исполняться в пуле потоков вызывающей стороны")
+    {
+        boost::asio::thread_pool pool(3);
+
+        std::unordered_set<std::thread::id> thread_ids;
+        std::mutex m;
+        const auto remember_thread =
+            [& thread_ids, & m] (auto x)
+            {
+                std::unique_lock<std::mutex> l(m);
+                thread_ids.insert(std::this_thread::get_id());
+                return x;
+            };
+
+        auto numbers = utility::random_vector<std::uint16_t>(10000, 0, std::numeric_limits<std::uint16_t>::max());
+        auto sorted = numbers;
+        std::sort(sorted.begin(), sorted.end());
+
+        burst::radix_select(burst::par(pool, 3), numbers, numbers.begin() + 7000, remember_thread);
+        CHECK(numbers[7000] == sorted[7000]);
+
+        CHECK(thread_ids.size() <= 3);
+        CHECK(thread_ids.find(std::this_thread::get_id()) == thread_ids.end());
+
+        pool.join();
+    }
+}
@@ -3,22 +3,29 @@
 #include <utility/silly_iterator.hpp>
 
 #include <burst/algorithm/radix_sort.hpp>
+#include <burst/functional/low_bits.hpp>
 #include <burst/integer/to_ordered_integral.hpp>
 
 #include <doctest/doctest.h>
 
+#include <boost/asio/thread_pool.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/iterator/indirect_iterator.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -73,6 +80,220 @@ TEST_SUITE("radix_sort")
         }
     }
 
+    TEST_CASE("Сортировка упорядоченного многоразрядного диапазона не обращается к буферу")
+    {
+        std::vector<std::uint32_t> initial(1000);
+        std::iota(initial.begin(), initial.end(), 0x00fffff0);
+
+        const auto untouched = std::uint32_t{0xdeadbeef};
+        std::vector<std::uint32_t> buffer(initial.size(), untouched);
+        const auto buffer_is_untouched =
+            [& buffer, untouched]
+            {
+                return std::all_of(buffer.begin(), buffer.end(),
+                    [untouched] (auto x) {return x == untouched;});
+            };
+
+        SUBCASE("при последовательной сортировке")
+        {
+            auto sorted = initial;
+            burst::radix_sort(sorted.begin(), sorted.end(), buffer.begin());
+
+            CHECK(sorted == initial);
+            CHECK(buffer_is_untouched());
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            auto sorted = initial;
+            burst::radix_sort(burst::par(3), sorted.begin(), sorted.end(), buffer.begin());
+
+            CHECK(sorted == initial);
+            CHECK(buffer_is_untouched());
+        }
+    }
+
+    TEST_CASE("Диапазон, неупорядоченный только на стыке кусков, будет отсортирован")
+    {
+        std::vector<std::uint32_t> numbers{3, 4, 5, 0, 1, 2};
+        std::vector<std::uint32_t> buffer(numbers.size());
+
+        burst::radix_sort(burst::par(2), numbers.begin(), numbers.end(), buffer.begin());
+
+        CHECK(numbers == std::vector<std::uint32_t>{0, 1, 2, 3, 4, 5});
+    }
+
+    TEST_CASE_TEMPLATE("Параллельная сортировка чисел с одинаковыми старшими разрядами совпадает с "
+        "последовательной", integer_type, std::uint16_t, std::uint32_t, std::uint64_t)
+    {
+        const auto max_value = std::numeric_limits<integer_type>::max() >> 4;
+        for (auto size: {10ul, 999ul, 10000ul})
+        {
+            auto numbers = utility::random_vector<integer_type>(size, 0, max_value);
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<integer_type> buffer(numbers.size());
+            burst::radix_sort(burst::par(4), numbers.begin(), numbers.end(), buffer.begin());
+
+            CHECK(numbers == expected);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Ширина разряда может не делить разрядность сортируемых чисел",
+        integer_type, std::uint16_t, std::uint32_t, std::uint64_t)
+    {
+        for (auto size: {10ul, 999ul, 10000ul})
+        {
+            const auto numbers =
+                utility::random_vector<integer_type>
+                (
+                    size,
+                    std::numeric_limits<integer_type>::min(),
+                    std::numeric_limits<integer_type>::max()
+                );
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+            std::vector<integer_type> buffer(numbers.size());
+
+            auto sequential = numbers;
+            burst::radix_sort(sequential.begin(), sequential.end(), buffer.begin(), burst::identity, burst::low_bits<11>);
+            CHECK(sequential == expected);
+
+            auto parallel = numbers;
+            burst::radix_sort(burst::par(3), parallel.begin(), parallel.end(), buffer.begin(), burst::identity, burst::low_bits<11>);
+            CHECK(parallel == expected);
+        }
+    }
+
+    TEST_CASE("Возможна сортировка 16-битными разрядами")
+    {
+        const auto numbers = utility::random_vector<std::uint64_t>(5000, 0, std::numeric_limits<std::uint64_t>::max());
+        auto expected = numbers;
+        std::sort(expected.begin(), expected.end());
+        std::vector<std::uint64_t> buffer(numbers.size());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            auto sorted = numbers;
+            burst::radix_sort(sorted, buffer.begin(), burst::identity, burst::low_bits<16>);
+            CHECK(sorted == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            auto sorted = numbers;
+            burst::radix_sort(burst::par(2), sorted, buffer.begin(), burst::identity, burst::low_bits<16>);
+            CHECK(sorted == expected);
+        }
+    }
+
+    TEST_CASE("При нечётном количестве разрядов, из которых один постоянен, результат возвращается "
+        "во входной диапазон")
+    {
+        // Три 11-битных разряда, старший из которых у всех чисел нулевой.
+        const auto numbers = utility::random_vector<std::uint32_t>(1000, 0, (1u << 22) - 1);
+        auto expected = numbers;
+        std::sort(expected.begin(), expected.end());
+        std::vector<std::uint32_t> buffer(numbers.size());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            auto sorted = numbers;
+            burst::radix_sort(sorted, buffer.begin(), burst::identity, burst::low_bits<11>);
+            CHECK(sorted == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            auto sorted = numbers;
+            burst::radix_sort(burst::par(4), sorted, buffer.begin(), burst::identity, burst::low_bits<11>);
+            CHECK(sorted == expected);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Ширина разряда может быть выбрана автоматически", integer_type,
+        std::uint16_t, std::int32_t, std::uint64_t)
+    {
+        // Размеры подобраны так, чтобы задействовать все доступные ширины разрядов.
+        for (auto size: {100ul, 20000ul, 300000ul, 5000000ul})
+        {
+            const auto numbers =
+                utility::random_vector<integer_type>
+                (
+                    size,
+                    std::numeric_limits<integer_type>::min(),
+                    std::numeric_limits<integer_type>::max()
+                );
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+            std::vector<integer_type> buffer(numbers.size());
+
+            auto sequential = numbers;
+            burst::radix_sort(sequential.begin(), sequential.end(), buffer.begin(), burst::identity, burst::adaptive_radix);
+            CHECK(sequential == expected);
+
+            auto parallel = numbers;
+            burst::radix_sort(burst::par(2), parallel, buffer.begin(), burst::identity, burst::adaptive_radix);
+            CHECK(parallel == expected);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Распределение через буферы объединения записи даёт тот же результат, что и "
+        "прямое распределение", integer_type, std::uint32_t, std::int64_t, std::uint64_t)
+    {
+        // Размеры подобраны так, чтобы буферы оставались как недозаполненными, так и
+        // многократно переполнялись.
+        for (auto size: {3ul, 100ul, 5000ul, 200000ul})
+        {
+            const auto numbers =
+                utility::random_vector<integer_type>
+                (
+                    size,
+                    std::numeric_limits<integer_type>::min(),
+                    std::numeric_limits<integer_type>::max()
+                );
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+            std::vector<integer_type> buffer(numbers.size());
+
+            auto sequential = numbers;
+            burst::radix_sort(sequential.begin(), sequential.end(), buffer.begin(), burst::identity, burst::low_byte, burst::write_combining);
+            CHECK(sequential == expected);
+
+            auto wide = numbers;
+            burst::radix_sort(wide.begin(), wide.end(), buffer.begin(), burst::identity, burst::low_bits<11>, burst::write_combining);
+            CHECK(wide == expected);
+
+            auto parallel = numbers;
+            burst::radix_sort(burst::par(3), parallel.begin(), parallel.end(), buffer.begin(), burst::identity, burst::adaptive_radix, burst::write_combining);
+            CHECK(parallel == expected);
+        }
+    }
+
+    TEST_CASE("Нетривиальные объекты при запросе объединения записи распределяются напрямую")
+    {
+        std::vector<std::unique_ptr<std::int64_t>> pointers;
+        for (auto n: {30, 5, -100500, 20152016, 0})
+        {
+            pointers.emplace_back(std::make_unique<std::int64_t>(n));
+        }
+
+        std::vector<std::unique_ptr<std::int64_t>> buffer(pointers.size());
+        burst::radix_sort(burst::par(2), pointers.begin(), pointers.end(), buffer.begin(),
+            [] (const auto & p)
+            {
+                return *p;
+            },
+            burst::low_byte,
+            burst::write_combining);
+
+        const auto expected = {-100500, 0, 5, 30, 20152016};
+        CHECK(std::equal
+        (
+            boost::make_indirect_iterator(std::begin(pointers)),
+            boost::make_indirect_iterator(std::end(pointers)),
+            std::begin(expected)
+        ));
+    }
+
     TEST_CASE("Сортировка неупорядоченного одноразрядного диапазона упорядочивает его")
     {
         auto expected = std::vector<std::uint8_t>{0, 1, 2, 3, 4};
@@ -558,6 +779,38 @@ TEST_SUITE("radix_sort")
         CHECK(thread_ids.find(std::this_thread::get_id()) == thread_ids.end());
     }
 
+    TEST_CASE("Параллельная сортировка может исполняться в пуле потоков вызывающей стороны")
+    {
+        boost::asio::thread_pool pool(2);
+
+        std::unordered_set<std::thread::id> thread_ids;
+        std::mutex m;
+        const auto remember_thread =
+            [& thread_ids, & m] (auto x)
+            {
+                std::unique_lock<std::mutex> l(m);
+                thread_ids.insert(std::this_thread::get_id());
+                return x;
+            };
+
+        for (auto attempt = 0; attempt < 3; ++attempt)
+        {
+            auto numbers = utility::random_vector<std::uint32_t>(1000, 0, 1000000);
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<std::uint32_t> buffer(numbers.size());
+            burst::radix_sort(burst::par(pool, 2), numbers, buffer.begin(), remember_thread);
+
+            CHECK(numbers == expected);
+        }
+
+        CHECK(thread_ids.size() <= 2);
+        CHECK(thread_ids.find(std::this_thread::get_id()) == thread_ids.end());
+
+        pool.join();
+    }
+
     TEST_CASE("Если заявлено меньше двух потоков, то алгоритм откатывается на однопоточный вариант")
     {
         std::vector<std::uint32_t> numbers{0, 5, 1, 6, 2, 100500};
@@ -578,6 +831,380 @@ TEST_SUITE("radix_sort")
         CHECK(thread_ids.find(std::this_thread::get_id()) != thread_ids.end());
     }
 
+    TEST_CASE("Большой диапазон с совпадающими разрядами сортируется так же, как и небольшой")
+    {
+        auto generator = std::mt19937{};
+        auto values = std::vector<std::int64_t>(100003);
+        std::generate(values.begin(), values.end(), [& generator] {return static_cast<std::int64_t>(generator() % 1000) - 500;});
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        auto buffer = std::vector<std::int64_t>(values.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin());
+            CHECK(values == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(2), values, buffer.begin());
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("При сортировке по вычисленным ключам отображение вызывается один раз на элемент")
+    {
+        auto generator = std::mt19937{};
+        auto values = std::vector<double>(5000);
+        std::generate(values.begin(), values.end(),
+            [& generator] {return static_cast<double>(generator()) / 1000.0 - 2e6;});
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        auto buffer = std::vector<double>(values.size());
+        std::atomic<std::size_t> map_call_count{0};
+        const auto map =
+            [& map_call_count] (double x)
+            {
+                ++map_call_count;
+                return burst::to_ordered_integral(x);
+            };
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values.begin(), values.end(), buffer.begin(), map, burst::low_byte, burst::cache_keys);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(3), values.begin(), values.end(), buffer.begin(), map, burst::low_byte, burst::cache_keys);
+        }
+
+        CHECK(values == expected);
+        CHECK(map_call_count == values.size());
+    }
+
+    TEST_CASE("Сортировка крупных элементов по вычисленным ключам устойчива")
+    {
+        struct record
+        {
+            std::uint16_t key;
+            std::size_t position;
+            char payload[48];
+        };
+
+        auto generator = std::mt19937{};
+        auto values = std::vector<record>(3000);
+        for (auto i = 0ul; i < values.size(); ++i)
+        {
+            values[i].key = static_cast<std::uint16_t>(generator() % 100);
+            values[i].position = i;
+            std::fill(std::begin(values[i].payload), std::end(values[i].payload), static_cast<char>(i % 128));
+        }
+
+        const auto key = [] (const record & r) {return r.key;};
+        const auto key_position = [] (const record & r) {return std::make_pair(r.key, r.position);};
+        const auto is_consistent =
+            [] (const record & r)
+            {
+                return std::all_of(std::begin(r.payload), std::end(r.payload),
+                    [& r] (char c) {return c == static_cast<char>(r.position % 128);});
+            };
+        auto buffer = std::vector<record>(values.size());
+
+        SUBCASE("при автоматическом выборе")
+        {
+            burst::radix_sort(values, buffer.begin(), key);
+        }
+        SUBCASE("при явном запросе")
+        {
+            burst::radix_sort(values.begin(), values.end(), buffer.begin(), key, burst::low_byte, burst::cache_keys);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(2), values, buffer.begin(), key);
+        }
+        SUBCASE("с адаптивным выбором разряда")
+        {
+            burst::radix_sort(values.begin(), values.end(), buffer.begin(), key, burst::adaptive_radix, burst::cache_keys);
+        }
+
+        CHECK(std::is_sorted(values.begin(), values.end(),
+            [& key_position] (const record & l, const record & r) {return key_position(l) < key_position(r);}));
+        CHECK(std::all_of(values.begin(), values.end(), is_consistent));
+    }
+
+    TEST_CASE("Упорядоченный диапазон крупных элементов с многоразрядным ключом не переносится "
+              "через буфер")
+    {
+        struct record
+        {
+            std::uint32_t key;
+            char payload[60];
+        };
+
+        auto values = std::vector<record>(3000);
+        for (auto i = std::size_t{0}; i < values.size(); ++i)
+        {
+            values[i].key = static_cast<std::uint32_t>(i * 0x10001);
+            std::fill(std::begin(values[i].payload), std::end(values[i].payload), static_cast<char>(i % 128));
+        }
+        const auto initial = values;
+
+        const auto untouched = std::uint32_t{0xdeadbeef};
+        auto buffer = std::vector<record>(values.size(), record{untouched, {}});
+        const auto key = [] (const record & r) {return r.key;};
+        const auto is_same_record =
+            [] (const record & l, const record & r)
+            {
+                return l.key == r.key && std::equal(std::begin(l.payload), std::end(l.payload), std::begin(r.payload));
+            };
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin(), key);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(3), values, buffer.begin(), key);
+        }
+
+        CHECK(std::equal(values.begin(), values.end(), initial.begin(), is_same_record));
+        CHECK(std::all_of(buffer.begin(), buffer.end(), [untouched] (const record & r) {return r.key == untouched;}));
+    }
+
+    TEST_CASE("Автоматическая сортировка крупных элементов по многоразрядному ключу устойчива")
+    {
+        struct record
+        {
+            std::uint32_t key;
+            std::uint32_t position;
+            char payload[56];
+        };
+
+        // Начало диапазона уже упорядочено, а остаток перемешан.
+        auto generator = std::mt19937{};
+        auto values = std::vector<record>(5000);
+        for (auto i = std::size_t{0}; i < values.size(); ++i)
+        {
+            values[i].key = i < 1000 ? 0 : static_cast<std::uint32_t>(generator() % 300) * 0x01010101;
+            values[i].position = static_cast<std::uint32_t>(i);
+            std::fill(std::begin(values[i].payload), std::end(values[i].payload), static_cast<char>(i % 128));
+        }
+
+        const auto key = [] (const record & r) {return r.key;};
+        const auto key_position = [] (const record & r) {return std::make_pair(r.key, r.position);};
+        const auto is_consistent =
+            [] (const record & r)
+            {
+                return std::all_of(std::begin(r.payload), std::end(r.payload),
+                    [& r] (char c) {return c == static_cast<char>(r.position % 128);});
+            };
+        auto buffer = std::vector<record>(values.size());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin(), key);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(3), values, buffer.begin(), key);
+        }
+
+        CHECK(std::is_sorted(values.begin(), values.end(),
+            [& key_position] (const record & l, const record & r) {return key_position(l) < key_position(r);}));
+        CHECK(std::all_of(values.begin(), values.end(), is_consistent));
+    }
+
+    TEST_CASE("Отображение может возвращать кортеж, и тогда элементы упорядочиваются "
+        "лексикографически по его полям")
+    {
+        using record = std::tuple<std::uint16_t, std::int8_t, float>;
+        auto generator = std::mt19937{};
+        auto values = std::vector<record>(1000);
+        std::generate(values.begin(), values.end(),
+            [& generator]
+            {
+                return
+                    record
+                    {
+                        static_cast<std::uint16_t>(generator() % 5),
+                        static_cast<std::int8_t>(static_cast<int>(generator() % 11) - 5),
+                        static_cast<float>(static_cast<int>(generator() % 7) - 3) / 2.0f
+                    };
+            });
+        auto expected = values;
+        std::stable_sort(expected.begin(), expected.end());
+
+        auto buffer = std::vector<record>(values.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin(), [] (const auto & r) {return r;});
+            CHECK(values == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(3), values, buffer.begin(), [] (const auto & r) {return r;});
+            CHECK(values == expected);
+        }
+        SUBCASE("с адаптивным выбором разряда")
+        {
+            burst::radix_sort(values, buffer.begin(), [] (const auto & r) {return r;}, burst::adaptive_radix);
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Сортировка по паре устойчива относительно элементов с равными ключами")
+    {
+        using record = std::pair<std::pair<std::uint8_t, std::int16_t>, std::size_t>;
+        auto values =
+            std::vector<record>
+            {
+                {{2, -1}, 0}, {{1, 5}, 1}, {{2, -1}, 2}, {{0, 300}, 3}, {{1, -300}, 4}, {{1, 5}, 5}
+            };
+        auto buffer = std::vector<record>(values.size());
+
+        burst::radix_sort(values, buffer.begin(), [] (const auto & r) {return r.first;});
+
+        const auto expected =
+            std::vector<record>
+            {
+                {{0, 300}, 3}, {{1, -300}, 4}, {{1, 5}, 1}, {{1, 5}, 5}, {{2, -1}, 0}, {{2, -1}, 2}
+            };
+        CHECK(values == expected);
+    }
+
+    TEST_CASE("Составной ключ шире 64 битов сортируется по нескольким словам")
+    {
+        using record = std::tuple<std::int32_t, double, std::uint64_t>;
+        const auto inf = std::numeric_limits<double>::infinity();
+        auto generator = std::mt19937{};
+        auto values = std::vector<record>(500);
+        std::generate(values.begin(), values.end(),
+            [& generator, inf]
+            {
+                const double doubles[] = {-inf, -2.5, -0.0, 1e-300, 3.0, inf};
+                return
+                    record
+                    {
+                        static_cast<std::int32_t>(generator() % 3) - 1,
+                        doubles[generator() % 6],
+                        std::uint64_t{generator()} << 32 | generator() % 4
+                    };
+            });
+        auto expected = values;
+        std::stable_sort(expected.begin(), expected.end(),
+            [] (const auto & l, const auto & r)
+            {
+                return
+                    std::make_tuple(std::get<0>(l), burst::to_ordered_integral(std::get<1>(l)), std::get<2>(l)) <
+                    std::make_tuple(std::get<0>(r), burst::to_ordered_integral(std::get<1>(r)), std::get<2>(r));
+            });
+
+        auto buffer = std::vector<record>(values.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin(), [] (const auto & r) {return r;});
+            CHECK(values == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(2), values, buffer.begin(), [] (const auto & r) {return r;});
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Поля кортежа, возвращённого через std::tie, тоже служат ключом")
+    {
+        using record = std::pair<std::string, std::pair<std::int64_t, std::int64_t>>;
+        auto values =
+            std::vector<record>
+            {
+                {"a", {3, -1}}, {"b", {-3, 7}}, {"c", {3, -2}}, {"d", {-3, 7}}, {"e", {0, 0}}
+            };
+        auto buffer = std::vector<record>(values.size());
+
+        burst::radix_sort(values, buffer.begin(),
+            [] (const auto & r) {return std::tie(r.second.first, r.second.second);});
+
+        const auto expected =
+            std::vector<record>
+            {
+                {"b", {-3, 7}}, {"d", {-3, 7}}, {"e", {0, 0}}, {"c", {3, -2}}, {"a", {3, -1}}
+            };
+        CHECK(values == expected);
+    }
+
+#if defined(BOOST_HAS_INT128)
+    TEST_CASE_TEMPLATE("Сортирует 128-битные целые", integer_type,
+        boost::uint128_type, boost::int128_type)
+    {
+        auto generator = std::mt19937_64{};
+        auto values = std::vector<integer_type>(2000);
+        std::generate(values.begin(), values.end(),
+            [& generator]
+            {
+                const auto high = static_cast<boost::uint128_type>(generator()) << 64;
+                return static_cast<integer_type>(high | generator());
+            });
+        // Значения с одинаковыми старшими байтами, чтобы часть разрядов была постоянной.
+        values[0] = 0;
+        values[1] = 1;
+        values[2] = std::numeric_limits<integer_type>::max();
+        values[3] = std::numeric_limits<integer_type>::min();
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        auto buffer = std::vector<integer_type>(values.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin());
+            CHECK(values == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(3), values, buffer.begin());
+            CHECK(values == expected);
+        }
+        SUBCASE("с адаптивным выбором разряда")
+        {
+            burst::radix_sort(values, buffer.begin(), burst::identity, burst::adaptive_radix);
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Постоянные разряды 128-битных чисел не мешают сортировке")
+    {
+        auto values = std::vector<boost::uint128_type>{5, 3, 1000000, 0, 3, 77};
+        auto buffer = std::vector<boost::uint128_type>(values.size());
+
+        burst::radix_sort(values, buffer.begin());
+
+        const auto expected = std::vector<boost::uint128_type>{0, 3, 3, 5, 77, 1000000};
+        CHECK(values == expected);
+    }
+#endif
+
+#if defined(BURST_X87_LONG_DOUBLE)
+    TEST_CASE("Числа типа long double сортируются через to_ordered_integral")
+    {
+        const auto inf = std::numeric_limits<long double>::infinity();
+        auto values = std::vector<long double>{0.0L, inf, -1.3L, -5e4000L, 12e-3L, -inf, 1e-4940L, 100500.0L};
+        auto buffer = std::vector<long double>(values.size());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort(values, buffer.begin(), burst::to_ordered_integral);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort(burst::par(2), values, buffer.begin(), burst::to_ordered_integral);
+        }
+
+        const auto expected = std::vector<long double>{-inf, -5e4000L, -1.3L, 0.0L, 1e-4940L, 12e-3L, 100500.0L, inf};
+        CHECK(values == expected);
+    }
+#endif
+
     // Тест нужен для обеспечения 100%-й метрики покрытия кода тестами.
     TEST_CASE_TEMPLATE("Если размер сортируемого массива превышает максимальное значение "
         "32-битного числа, то алгоритм идёт через ветку с int64-счётчиками",
@@ -0,0 +1,164 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/radix_sort_count.hpp>
+#include <burst/functional/low_bits.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <typename Integer>
+    std::vector<std::pair<Integer, std::ptrdiff_t>> counts (const std::vector<Integer> & values)
+    {
+        auto counter = std::map<Integer, std::ptrdiff_t>{};
+        for (const auto & value: values)
+        {
+            ++counter[value];
+        }
+        return std::vector<std::pair<Integer, std::ptrdiff_t>>(counter.begin(), counter.end());
+    }
+}
+
+TEST_SUITE("radix_sort_count")
+{
+    TEST_CASE("Записывает каждое значение вместе с количеством его повторов")
+    {
+        auto values = std::vector<std::uint32_t>{3, 1, 3, 2, 1, 3, 1000};
+        auto buffer = std::vector<std::uint32_t>(values.size());
+        auto result = std::vector<std::pair<std::uint32_t, std::ptrdiff_t>>{};
+
+        burst::radix_sort_count(values.begin(), values.end(), buffer.begin(), std::back_inserter(result));
+
+        CHECK(result == (std::vector<std::pair<std::uint32_t, std::ptrdiff_t>>{{1, 2}, {2, 1}, {3, 3}, {1000, 1}}));
+    }
+
+    TEST_CASE("Оставляет входной диапазон упорядоченным")
+    {
+        auto values = std::vector<std::int32_t>{5, -1, 5, 0, -1};
+        auto buffer = std::vector<std::int32_t>(values.size());
+        auto result = std::vector<std::pair<std::int32_t, std::ptrdiff_t>>(values.size());
+
+        const auto result_end = burst::radix_sort_count(values, buffer.begin(), result.begin());
+
+        CHECK(values == std::vector<std::int32_t>{-1, -1, 0, 5, 5});
+        CHECK(result_end - result.begin() == 3);
+    }
+
+    TEST_CASE("Для пустого диапазона ничего не записывает")
+    {
+        auto values = std::vector<std::uint64_t>{};
+        auto buffer = std::vector<std::uint64_t>{};
+        auto result = std::vector<std::pair<std::uint64_t, std::ptrdiff_t>>{};
+
+        CHECK(burst::radix_sort_count(values, buffer.begin(), result.begin()) == result.begin());
+        CHECK(burst::radix_sort_count(burst::par(2), values, buffer.begin(), result.begin()) == result.begin());
+    }
+
+    TEST_CASE_TEMPLATE("Результат совпадает с подсчётом повторов при помощи словаря",
+        integer_type, std::uint16_t, std::int32_t, std::uint64_t)
+    {
+        for (auto size: {1ul, 50ul, 1000ul, 100000ul})
+        {
+            for (auto max: {integer_type{100}, std::numeric_limits<integer_type>::max()})
+            {
+                auto numbers = utility::random_vector<integer_type>(size, std::numeric_limits<integer_type>::min(), max);
+                const auto expected = counts(numbers);
+                auto sorted = numbers;
+                std::sort(sorted.begin(), sorted.end());
+                auto buffer = std::vector<integer_type>(size);
+
+                auto sequential = numbers;
+                auto sequential_result = std::vector<std::pair<integer_type, std::ptrdiff_t>>{};
+                burst::radix_sort_count(sequential, buffer.begin(), std::back_inserter(sequential_result));
+                CHECK(sequential_result == expected);
+                CHECK(sequential == sorted);
+
+                auto parallel = numbers;
+                auto parallel_result = std::vector<std::pair<integer_type, std::ptrdiff_t>>(size);
+                const auto parallel_end = burst::radix_sort_count(burst::par(3), parallel, buffer.begin(), parallel_result.begin());
+                parallel_result.erase(parallel_end, parallel_result.end());
+                CHECK(parallel_result == expected);
+                CHECK(parallel == sorted);
+            }
+        }
+    }
+
+    TEST_CASE("Совмещает подсчёт с переносом из буфера при нечётном количестве проходов")
+    {
+        const auto numbers = utility::random_vector<std::uint32_t>(50000, 0, 40000);
+        const auto expected = counts(numbers);
+        auto buffer = std::vector<std::uint32_t>(numbers.size());
+        const auto identity = [] (auto x) {return x;};
+
+        auto sequential = numbers;
+        auto sequential_result = std::vector<std::pair<std::uint32_t, std::ptrdiff_t>>{};
+        burst::radix_sort_count(sequential, buffer.begin(), std::back_inserter(sequential_result), identity, burst::low_bits<11>);
+        CHECK(sequential_result == expected);
+        CHECK(std::is_sorted(sequential.begin(), sequential.end()));
+
+        auto parallel = numbers;
+        auto parallel_result = std::vector<std::pair<std::uint32_t, std::ptrdiff_t>>(numbers.size());
+        const auto parallel_end = burst::radix_sort_count(burst::par(4), parallel, buffer.begin(), parallel_result.begin(), identity, burst::low_bits<11>);
+        parallel_result.erase(parallel_end, parallel_result.end());
+        CHECK(parallel_result == expected);
+        CHECK(std::is_sorted(parallel.begin(), parallel.end()));
+    }
+
+    TEST_CASE("Группы, пересекающие границы кусков, считаются целиком")
+    {
+        auto values = std::vector<std::uint8_t>(10001, 42);
+        values[5000] = 7;
+        auto buffer = std::vector<std::uint8_t>(values.size());
+        auto result = std::vector<std::pair<std::uint8_t, std::ptrdiff_t>>(values.size());
+
+        const auto result_end = burst::radix_sort_count(burst::par(4), values, buffer.begin(), result.begin());
+
+        CHECK(std::vector<std::pair<std::uint8_t, std::ptrdiff_t>>(result.begin(), result_end) ==
+            (std::vector<std::pair<std::uint8_t, std::ptrdiff_t>>{{7, 1}, {42, 10000}}));
+    }
+
+    TEST_CASE("Представителем группы служит первый по порядку элемент")
+    {
+        using record = std::pair<std::uint16_t, char>;
+        auto records = std::vector<record>{{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}, {3, 'e'}};
+        auto buffer = std::vector<record>(records.size());
+        auto result = std::vector<std::pair<record, std::ptrdiff_t>>{};
+
+        burst::radix_sort_count(records, buffer.begin(), std::back_inserter(result), [] (const record & r) {return r.first;});
+
+        CHECK(result == (std::vector<std::pair<record, std::ptrdiff_t>>{{{1, 'b'}, 2}, {{2, 'a'}, 2}, {{3, 'e'}, 1}}));
+    }
+
+    TEST_CASE("Работает с составными ключами")
+    {
+        using record = std::pair<std::int16_t, std::uint8_t>;
+        auto records = std::vector<record>(30000);
+        for (auto i = 0u; i < records.size(); ++i)
+        {
+            records[i] = record{static_cast<std::int16_t>(static_cast<int>(i % 11) - 5), static_cast<std::uint8_t>(i % 3)};
+        }
+        const auto expected = counts(records);
+        auto buffer = std::vector<record>(records.size());
+        const auto key = [] (const record & r) {return r;};
+
+        auto sequential = records;
+        auto sequential_result = std::vector<std::pair<record, std::ptrdiff_t>>{};
+        burst::radix_sort_count(sequential, buffer.begin(), std::back_inserter(sequential_result), key);
+        CHECK(sequential_result == expected);
+
+        auto parallel = records;
+        auto parallel_result = std::vector<std::pair<record, std::ptrdiff_t>>(records.size());
+        const auto parallel_end = burst::radix_sort_count(burst::par(3), parallel, buffer.begin(), parallel_result.begin(), key);
+        parallel_result.erase(parallel_end, parallel_result.end());
+        CHECK(parallel_result == expected);
+    }
+}
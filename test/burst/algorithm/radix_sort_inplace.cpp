@@ -0,0 +1,285 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/radix_sort_inplace.hpp>
+#include <burst/integer/to_ordered_integral.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+#include <boost/iterator/indirect_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+TEST_SUITE("radix_sort_inplace")
+{
+    TEST_CASE("Сортировка пустого контейнера ничего не делает")
+    {
+        std::vector<std::size_t> values;
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort_inplace(values.begin(), values.end());
+            CHECK(values.empty());
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort_inplace(burst::par(3), values.begin(), values.end());
+            CHECK(values.empty());
+        }
+    }
+
+    TEST_CASE("Сортировка отсортированного диапазона не изменяет его")
+    {
+        std::vector<std::uint32_t> initial(1000);
+        std::iota(initial.begin(), initial.end(), std::uint32_t{100000});
+        SUBCASE("при последовательной сортировке")
+        {
+            auto sorted = initial;
+            burst::radix_sort_inplace(sorted.begin(), sorted.end());
+
+            CHECK(sorted == initial);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            auto sorted = initial;
+            burst::radix_sort_inplace(burst::par(3), sorted.begin(), sorted.end());
+
+            CHECK(sorted == initial);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Результат сортировки совпадает с результатом std::sort", integer_type,
+        std::uint16_t, std::uint32_t, std::uint64_t, std::int32_t, std::int64_t)
+    {
+        for (auto size: {10ul, 65ul, 999ul, 100000ul})
+        {
+            const auto numbers =
+                utility::random_vector<integer_type>
+                (
+                    size,
+                    std::numeric_limits<integer_type>::min(),
+                    std::numeric_limits<integer_type>::max()
+                );
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+
+            auto sequential = numbers;
+            burst::radix_sort_inplace(sequential.begin(), sequential.end());
+            CHECK(sequential == expected);
+
+            auto parallel = numbers;
+            burst::radix_sort_inplace(burst::par(4), parallel.begin(), parallel.end());
+            CHECK(parallel == expected);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Числа с одинаковыми старшими разрядами сортируются правильно",
+        integer_type, std::uint16_t, std::uint32_t, std::uint64_t)
+    {
+        for (auto size: {10ul, 999ul, 10000ul})
+        {
+            const auto max = static_cast<integer_type>(std::numeric_limits<integer_type>::max() >> 4);
+            const auto numbers = utility::random_vector<integer_type>(size, 0, max);
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+
+            auto sequential = numbers;
+            burst::radix_sort_inplace(sequential.begin(), sequential.end());
+            CHECK(sequential == expected);
+
+            auto parallel = numbers;
+            burst::radix_sort_inplace(burst::par(3), parallel.begin(), parallel.end());
+            CHECK(parallel == expected);
+        }
+    }
+
+    TEST_CASE("Сортировка убывающего диапазона делает его возрастающим")
+    {
+        std::vector<std::uint32_t> ascending(1000);
+        std::iota(ascending.begin(), ascending.end(), std::uint32_t{0});
+        SUBCASE("при последовательной сортировке")
+        {
+            std::vector<std::uint32_t> numbers(ascending.rbegin(), ascending.rend());
+            burst::radix_sort_inplace(numbers.begin(), numbers.end());
+
+            CHECK(numbers == ascending);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            std::vector<std::uint32_t> numbers(ascending.rbegin(), ascending.rend());
+            burst::radix_sort_inplace(burst::par(2), numbers.begin(), numbers.end());
+
+            CHECK(numbers == ascending);
+        }
+    }
+
+    TEST_CASE("Возможна побитовая сортировка")
+    {
+        std::vector<std::uint32_t> ascending(200);
+        std::iota(ascending.begin(), ascending.end(), std::uint32_t{0});
+
+        const auto bit = [] (const std::uint32_t & number) -> bool {return number & 0x01;};
+        SUBCASE("при последовательной сортировке")
+        {
+            std::vector<std::uint32_t> numbers(ascending.rbegin(), ascending.rend());
+            burst::radix_sort_inplace(numbers.begin(), numbers.end(), burst::identity, bit);
+
+            CHECK(numbers == ascending);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            std::vector<std::uint32_t> numbers(ascending.rbegin(), ascending.rend());
+            burst::radix_sort_inplace(burst::par(4), numbers.begin(), numbers.end(),
+                burst::identity, bit);
+
+            CHECK(numbers == ascending);
+        }
+    }
+
+    TEST_CASE("Умеет сортировать знаковые числа")
+    {
+        const auto initial =
+            std::vector<std::int64_t>
+            {
+                0,
+                -1,
+                1,
+                -2,
+                2,
+                -100500,
+                100500,
+                std::numeric_limits<std::int64_t>::min(),
+                std::numeric_limits<std::int64_t>::max()
+            };
+
+        const auto expected =
+            std::vector<std::int64_t>
+            {
+                std::numeric_limits<std::int64_t>::min(),
+                -100500,
+                -2,
+                -1,
+                0,
+                1,
+                2,
+                100500,
+                std::numeric_limits<std::int64_t>::max()
+            };
+
+        SUBCASE("при последовательной сортировке")
+        {
+            auto values = initial;
+            burst::radix_sort_inplace(values.begin(), values.end());
+
+            CHECK(values == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            auto values = initial;
+            burst::radix_sort_inplace(burst::par(3), values.begin(), values.end());
+
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("С помощью аргумента `map` можно сортировать объекты, которые не являются целыми "
+        "числами")
+    {
+        const auto inf = 1.0 / 0.0;
+        auto doubles = std::vector<double>{0.0, inf, -1.3, -5e12, 12e-3, -inf, 100500.0};
+
+        burst::radix_sort_inplace(doubles, burst::to_ordered_integral);
+
+        const auto expected = std::vector<double>{-inf, -5e12, -1.3, 0.0, 12e-3, 100500.0, inf};
+        CHECK(doubles == expected);
+    }
+
+    TEST_CASE("Возможно сортировать некопируемые объекты")
+    {
+        std::vector<std::int64_t> expected(1000);
+        std::iota(expected.begin(), expected.end(), std::int64_t{-500});
+
+        std::vector<std::unique_ptr<std::int64_t>> pointers;
+        std::for_each(expected.rbegin(), expected.rend(),
+            [& pointers] (auto n) {pointers.emplace_back(std::make_unique<std::int64_t>(n));});
+
+        const auto dereference = [] (const auto & p) {return *p;};
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort_inplace(pointers.begin(), pointers.end(), dereference);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort_inplace(burst::par(2), pointers.begin(), pointers.end(), dereference);
+        }
+
+        CHECK(std::equal
+        (
+            boost::make_indirect_iterator(std::begin(pointers)),
+            boost::make_indirect_iterator(std::end(pointers)),
+            std::begin(expected)
+        ));
+    }
+
+    TEST_CASE("Допускает на вход диапазоны")
+    {
+        auto numbers = utility::random_vector<std::uint32_t>(1000, 0, 100500);
+        auto expected = numbers;
+        std::sort(expected.begin(), expected.end());
+
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::radix_sort_inplace(numbers);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::radix_sort_inplace(burst::par(4), numbers);
+        }
+
+        CHECK(numbers == expected);
+    }
+
+    TEST_CASE("Параллельная сортировка может исполняться в пуле потоков вызывающей стороны")
+    {
+        boost::asio::thread_pool pool(2);
+
+        for (auto attempt = 0; attempt < 3; ++attempt)
+        {
+            auto numbers = utility::random_vector<std::uint64_t>(10000, 0, 1ul << 40);
+            auto expected = numbers;
+            std::sort(expected.begin(), expected.end());
+
+            burst::radix_sort_inplace(burst::par(pool, 2), numbers);
+            CHECK(numbers == expected);
+        }
+    }
+
+    TEST_CASE("Если заявлено меньше двух потоков, то алгоритм откатывается на однопоточный вариант")
+    {
+        std::vector<std::uint32_t> numbers{0, 5, 1, 6, 2, 100500};
+
+        std::unordered_set<std::thread::id> thread_ids;
+        std::mutex m;
+
+        burst::radix_sort_inplace(burst::par(1), numbers.begin(), numbers.end(),
+            [& thread_ids, & m] (auto x)
+            {
+                std::unique_lock<std::mutex> l(m);
+                thread_ids.insert(std::this_thread::get_id());
+                return x;
+            });
+
+        CHECK(thread_ids.size() == 1);
+        CHECK(thread_ids.find(std::this_thread::get_id()) != thread_ids.end());
+        CHECK(std::is_sorted(numbers.begin(), numbers.end()));
+    }
+}
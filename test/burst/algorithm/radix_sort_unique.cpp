@@ -0,0 +1,198 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/radix_sort_unique.hpp>
+#include <burst/functional/low_bits.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <typename Integer>
+    std::vector<Integer> sorted_unique (std::vector<Integer> values)
+    {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        return values;
+    }
+}
+
+TEST_SUITE("radix_sort_unique")
+{
+    TEST_CASE("Оставляет по одному экземпляру каждого значения в порядке возрастания")
+    {
+        auto values = std::vector<std::uint32_t>{3, 1, 3, 2, 1, 3, 1000, 2};
+        auto buffer = std::vector<std::uint32_t>(values.size());
+
+        const auto unique_end = burst::radix_sort_unique(values.begin(), values.end(), buffer.begin());
+
+        CHECK(std::vector<std::uint32_t>(values.begin(), unique_end) == std::vector<std::uint32_t>{1, 2, 3, 1000});
+    }
+
+    TEST_CASE("Пустой диапазон остаётся пустым")
+    {
+        auto values = std::vector<std::int64_t>{};
+        auto buffer = std::vector<std::int64_t>{};
+
+        CHECK(burst::radix_sort_unique(values, buffer.begin()) == values.end());
+        CHECK(burst::radix_sort_unique(burst::par(3), values, buffer.begin()) == values.end());
+    }
+
+    TEST_CASE("Упорядоченный диапазон с повторами тоже очищается от повторов")
+    {
+        auto values = std::vector<std::uint16_t>{1, 1, 2, 5, 5, 5, 7};
+        auto buffer = std::vector<std::uint16_t>(values.size());
+
+        const auto unique_end = burst::radix_sort_unique(values, buffer.begin());
+
+        CHECK(std::vector<std::uint16_t>(values.begin(), unique_end) == std::vector<std::uint16_t>{1, 2, 5, 7});
+    }
+
+    TEST_CASE_TEMPLATE("Результат совпадает с последовательным вызовом сортировки и std::unique",
+        integer_type, std::uint16_t, std::int32_t, std::uint64_t)
+    {
+        for (auto size: {1ul, 50ul, 1000ul, 100000ul})
+        {
+            for (auto max: {integer_type{100}, std::numeric_limits<integer_type>::max()})
+            {
+                const auto numbers = utility::random_vector<integer_type>(size, std::numeric_limits<integer_type>::min(), max);
+                const auto expected = sorted_unique(numbers);
+                auto buffer = std::vector<integer_type>(size);
+
+                auto sequential = numbers;
+                const auto sequential_end = burst::radix_sort_unique(sequential, buffer.begin());
+                CHECK(std::vector<integer_type>(sequential.begin(), sequential_end) == expected);
+
+                auto parallel = numbers;
+                const auto parallel_end = burst::radix_sort_unique(burst::par(3), parallel, buffer.begin());
+                CHECK(std::vector<integer_type>(parallel.begin(), parallel_end) == expected);
+            }
+        }
+    }
+
+    TEST_CASE("Совмещает удаление повторов с переносом из буфера при нечётном количестве проходов")
+    {
+        const auto numbers = utility::random_vector<std::uint32_t>(50000, 0, 40000);
+        const auto expected = sorted_unique(numbers);
+        auto buffer = std::vector<std::uint32_t>(numbers.size());
+
+        auto sequential = numbers;
+        const auto sequential_end = burst::radix_sort_unique(sequential, buffer.begin(), [] (auto x) {return x;}, burst::low_bits<11>);
+        CHECK(std::vector<std::uint32_t>(sequential.begin(), sequential_end) == expected);
+
+        auto parallel = numbers;
+        const auto parallel_end = burst::radix_sort_unique(burst::par(4), parallel, buffer.begin(), [] (auto x) {return x;}, burst::low_bits<11>);
+        CHECK(std::vector<std::uint32_t>(parallel.begin(), parallel_end) == expected);
+    }
+
+    TEST_CASE("Однобайтовые ключи сортируются подсчётом и сразу очищаются от повторов")
+    {
+        auto values = std::vector<std::uint8_t>(10000);
+        for (auto i = 0u; i < values.size(); ++i)
+        {
+            values[i] = static_cast<std::uint8_t>((i * 37) % 200);
+        }
+        const auto expected = sorted_unique(values);
+        auto buffer = std::vector<std::uint8_t>(values.size());
+
+        auto sequential = values;
+        const auto sequential_end = burst::radix_sort_unique(sequential, buffer.begin());
+        CHECK(std::vector<std::uint8_t>(sequential.begin(), sequential_end) == expected);
+
+        auto parallel = values;
+        const auto parallel_end = burst::radix_sort_unique(burst::par(3), parallel, buffer.begin());
+        CHECK(std::vector<std::uint8_t>(parallel.begin(), parallel_end) == expected);
+    }
+
+    TEST_CASE("Из каждой группы равных ключей остаётся первый по порядку элемент")
+    {
+        using record = std::pair<std::uint32_t, std::size_t>;
+        auto records = std::vector<record>(30000);
+        for (auto i = 0ul; i < records.size(); ++i)
+        {
+            records[i] = record{static_cast<std::uint32_t>((i * 7919) % 1000 * 1000003), i};
+        }
+
+        auto expected = std::vector<record>{};
+        {
+            auto sorted = records;
+            std::stable_sort(sorted.begin(), sorted.end(), [] (const auto & a, const auto & b) {return a.first < b.first;});
+            std::unique_copy(sorted.begin(), sorted.end(), std::back_inserter(expected),
+                [] (const auto & a, const auto & b) {return a.first == b.first;});
+        }
+        auto buffer = std::vector<record>(records.size());
+        const auto key = [] (const record & r) {return r.first;};
+
+        auto sequential = records;
+        const auto sequential_end = burst::radix_sort_unique(sequential, buffer.begin(), key);
+        CHECK(std::vector<record>(sequential.begin(), sequential_end) == expected);
+
+        auto parallel = records;
+        const auto parallel_end = burst::radix_sort_unique(burst::par(5), parallel, buffer.begin(), key);
+        CHECK(std::vector<record>(parallel.begin(), parallel_end) == expected);
+    }
+
+    TEST_CASE("Группы равных значений, пересекающие границы кусков, не дробятся")
+    {
+        auto values = std::vector<std::int64_t>(9999);
+        for (auto i = 0ul; i < values.size(); ++i)
+        {
+            values[i] = static_cast<std::int64_t>(i % 3) - 1;
+        }
+        auto buffer = std::vector<std::int64_t>(values.size());
+
+        const auto unique_end = burst::radix_sort_unique(burst::par(4), values, buffer.begin());
+
+        CHECK(std::vector<std::int64_t>(values.begin(), unique_end) == std::vector<std::int64_t>{-1, 0, 1});
+    }
+
+    TEST_CASE("Работает с составными ключами")
+    {
+        using record = std::tuple<std::uint16_t, std::int8_t, std::uint32_t>;
+        auto records = std::vector<record>(20000);
+        for (auto i = 0u; i < records.size(); ++i)
+        {
+            records[i] = record{static_cast<std::uint16_t>(i % 7), static_cast<std::int8_t>(static_cast<int>(i % 5) - 2), i};
+        }
+        const auto key = [] (const record & r) {return std::make_pair(std::get<0>(r), std::get<1>(r));};
+        const auto key_less = [& key] (const record & a, const record & b) {return key(a) < key(b);};
+
+        auto expected = records;
+        std::stable_sort(expected.begin(), expected.end(), key_less);
+        expected.erase(std::unique(expected.begin(), expected.end(), [& key] (const record & a, const record & b) {return key(a) == key(b);}), expected.end());
+        REQUIRE(expected.size() == 35);
+        auto buffer = std::vector<record>(records.size());
+
+        auto sequential = records;
+        const auto sequential_end = burst::radix_sort_unique(sequential, buffer.begin(), key);
+        CHECK(std::vector<record>(sequential.begin(), sequential_end) == expected);
+
+        auto parallel = records;
+        const auto parallel_end = burst::radix_sort_unique(burst::par(3), parallel, buffer.begin(), key);
+        CHECK(std::vector<record>(parallel.begin(), parallel_end) == expected);
+    }
+
+    TEST_CASE("Параллельный вариант исполняется в переданном пуле потоков")
+    {
+        boost::asio::thread_pool pool(3);
+        const auto numbers = utility::random_vector<std::uint32_t>(20000, 0, 500);
+        const auto expected = sorted_unique(numbers);
+
+        auto values = numbers;
+        auto buffer = std::vector<std::uint32_t>(values.size());
+        const auto unique_end = burst::radix_sort_unique(burst::par(pool, 3), values, buffer.begin());
+
+        CHECK(std::vector<std::uint32_t>(values.begin(), unique_end) == expected);
+        pool.join();
+    }
+}
@@ -0,0 +1,195 @@
+#include <utility/random_vector.hpp>
+
+#include <burst/algorithm/sample_sort.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> random_strings (std::size_t size, std::uint32_t max_value)
+    {
+        const auto numbers = utility::random_vector<std::uint32_t>(size, 0, max_value);
+        auto strings = std::vector<std::string>{};
+        strings.reserve(size);
+        for (auto number: numbers)
+        {
+            strings.push_back("key-" + std::to_string(number));
+        }
+        return strings;
+    }
+}
+
+TEST_SUITE("sample_sort")
+{
+    TEST_CASE("Небольшой диапазон сортируется по заданному порядку")
+    {
+        auto values = std::vector<int>{5, 3, 9, 1, 3, 7};
+        auto buffer = std::vector<int>(values.size());
+
+        burst::sample_sort(values.begin(), values.end(), buffer.begin(), std::greater<>{});
+
+        CHECK(values == (std::vector<int>{9, 7, 5, 3, 3, 1}));
+    }
+
+    TEST_CASE("Сортирует строки")
+    {
+        for (auto size: {100ul, 4096ul, 50001ul})
+        {
+            auto values = random_strings(size, 1000000);
+            auto expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            auto buffer = std::vector<std::string>(values.size());
+            burst::sample_sort(values, buffer.begin());
+
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Сортирует по составному порядку")
+    {
+        using record = std::pair<std::string, double>;
+        const auto names = random_strings(30000, 50);
+        const auto weights = utility::random_vector<std::uint32_t>(names.size(), 0, 1000);
+        auto records = std::vector<record>{};
+        for (auto i = 0ul; i < names.size(); ++i)
+        {
+            records.emplace_back(names[i], weights[i] / 8.0);
+        }
+        const auto by_name_then_weight_desc =
+            [] (const record & a, const record & b)
+            {
+                return std::tie(a.first, b.second) < std::tie(b.first, a.second);
+            };
+        auto expected = records;
+        std::sort(expected.begin(), expected.end(), by_name_then_weight_desc);
+
+        auto buffer = std::vector<record>(records.size());
+        burst::sample_sort(records, buffer.begin(), by_name_then_weight_desc);
+
+        CHECK(records == expected);
+    }
+
+    TEST_CASE("Справляется с диапазоном из одинаковых элементов")
+    {
+        auto values = std::vector<std::string>(20000, "same");
+        values[123] = "less";
+        values[4567] = "zzz";
+        auto buffer = std::vector<std::string>(values.size());
+
+        burst::sample_sort(values, buffer.begin());
+
+        CHECK(std::is_sorted(values.begin(), values.end()));
+        CHECK(values.front() == "less");
+        CHECK(values.back() == "zzz");
+    }
+
+    TEST_CASE("Сортирует диапазон с небольшим количеством различных значений")
+    {
+        for (auto size: {5000ul, 100001ul})
+        {
+            auto values = random_strings(size, 3);
+            auto expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            auto buffer = std::vector<std::string>(values.size());
+            auto sequential = values;
+            burst::sample_sort(sequential, buffer.begin());
+            burst::sample_sort(burst::par(3), values, buffer.begin());
+
+            CHECK(sequential == expected);
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Равные разделителям элементы не сортируются повторно")
+    {
+        const auto size = std::size_t{100000};
+        auto values = std::vector<int>(size, 7);
+        auto buffer = std::vector<int>(values.size());
+        std::atomic<std::size_t> comparison_count{0};
+        const auto counting_less =
+            [& comparison_count] (int a, int b)
+            {
+                ++comparison_count;
+                return a < b;
+            };
+
+        burst::sample_sort(values, buffer.begin(), counting_less);
+        CHECK(comparison_count < 10 * size);
+
+        comparison_count = 0;
+        burst::sample_sort(burst::par(3), values, buffer.begin(), counting_less);
+        CHECK(comparison_count < 10 * size);
+        CHECK(values == std::vector<int>(size, 7));
+    }
+
+    TEST_CASE("Справляется с уже отсортированным и обратно отсортированным диапазонами")
+    {
+        auto ascending = std::vector<int>(100000);
+        std::iota(ascending.begin(), ascending.end(), 0);
+        auto descending = std::vector<int>(ascending.rbegin(), ascending.rend());
+        auto buffer = std::vector<int>(ascending.size());
+
+        auto values = ascending;
+        burst::sample_sort(values, buffer.begin());
+        CHECK(values == ascending);
+
+        burst::sample_sort(descending, buffer.begin());
+        CHECK(descending == ascending);
+    }
+
+    TEST_CASE("Пустой диапазон остаётся пустым")
+    {
+        auto values = std::vector<std::string>{};
+        burst::sample_sort(values, values.begin());
+        burst::sample_sort(burst::par(3), values, values.begin());
+        CHECK(values.empty());
+    }
+
+    TEST_CASE("Параллельная сортировка совпадает с последовательной")
+    {
+        for (auto size: {1000ul, 4096ul, 100001ul})
+        {
+            auto values = random_strings(size, 100000);
+            auto expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            auto buffer = std::vector<std::string>(values.size());
+            burst::sample_sort(burst::par(3), values.begin(), values.end(), buffer.begin());
+
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Параллельный вариант исполняется в переданном пуле потоков")
+    {
+        boost::asio::thread_pool pool(2);
+        const auto numbers = utility::random_vector<std::int64_t>(70000, -1000000000, 1000000000);
+        auto values = std::vector<double>{};
+        std::transform(numbers.begin(), numbers.end(), std::back_inserter(values),
+            [] (auto number) {return static_cast<double>(number) / 3;});
+        auto expected = values;
+        std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+        auto buffer = std::vector<double>(values.size());
+        burst::sample_sort(burst::par(pool, 2), values, buffer.begin(), std::greater<>{});
+        pool.join();
+
+        CHECK(values == expected);
+    }
+}
@@ -0,0 +1,181 @@
+#include <burst/algorithm/segmented_radix_sort.hpp>
+#include <burst/execution/parallel_policy.hpp>
+#include <burst/functional/low_bits.hpp>
+#include <burst/integer/to_ordered_integral.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Границы отрезков случайной длины от нуля до `max_length`, покрывающих `size` элементов.
+    std::vector<std::size_t> random_offsets (std::size_t size, std::size_t max_length)
+    {
+        std::mt19937 generator;
+        std::vector<std::size_t> offsets{0};
+        while (offsets.back() < size)
+        {
+            offsets.push_back(std::min(size, offsets.back() + generator() % (max_length + 1)));
+        }
+        return offsets;
+    }
+
+    template <typename Value, typename Compare>
+    std::vector<Value> sort_each_segment (std::vector<Value> values, const std::vector<std::size_t> & offsets, Compare compare)
+    {
+        for (auto i = 1ul; i < offsets.size(); ++i)
+        {
+            std::stable_sort
+            (
+                values.begin() + static_cast<std::ptrdiff_t>(offsets[i - 1]),
+                values.begin() + static_cast<std::ptrdiff_t>(offsets[i]),
+                compare
+            );
+        }
+        return values;
+    }
+} // namespace
+
+TEST_SUITE("segmented_radix_sort")
+{
+    TEST_CASE("Сортирует каждый отрезок независимо от остальных")
+    {
+        auto values = std::vector<std::uint32_t>{5, 1, 3, 9, 9, 2, 8, 0, 7, 7, 1};
+        auto offsets = std::vector<std::size_t>{0, 3, 3, 6, 11};
+        auto expected = std::vector<std::uint32_t>{1, 3, 5, 2, 9, 9, 0, 1, 7, 7, 8};
+
+        // Длинный отрезок, который сортируется поразрядно, а не вставками.
+        for (auto n = 1000u; n > 0; --n)
+        {
+            values.push_back(n * 7919 % 1000);
+        }
+        offsets.push_back(values.size());
+        for (auto n = 0u; n < 1000; ++n)
+        {
+            expected.push_back(n);
+        }
+
+        auto buffer = std::vector<std::uint32_t>(values.size());
+        burst::segmented_radix_sort(values, offsets, buffer.begin());
+
+        CHECK(values == expected);
+    }
+
+    TEST_CASE("Элементы за пределами отрезков не трогаются")
+    {
+        auto values = std::vector<int>{9, 8, 7, 6, 5, 4, 3};
+        const auto offsets = std::vector<int>{2, 5};
+        auto buffer = std::vector<int>(values.size());
+
+        burst::segmented_radix_sort(values, offsets, buffer.begin());
+
+        const auto expected = std::vector<int>{9, 8, 5, 6, 7, 4, 3};
+        CHECK(values == expected);
+    }
+
+    TEST_CASE("Менее двух границ — нечего сортировать")
+    {
+        auto values = std::vector<int>{3, 2, 1};
+        auto buffer = std::vector<int>(values.size());
+
+        burst::segmented_radix_sort(values, std::vector<int>{}, buffer.begin());
+        burst::segmented_radix_sort(values, std::vector<int>{1}, buffer.begin());
+        burst::segmented_radix_sort(burst::par(2), values, std::vector<int>{0}, buffer.begin());
+
+        CHECK(values == std::vector<int>{3, 2, 1});
+    }
+
+    TEST_CASE("Результат совпадает с устойчивой сортировкой каждого отрезка")
+    {
+        // Длины отрезков попадают как в область сортировки вставками, так и в поразрядную.
+        const auto size = std::size_t{50000};
+        auto generator = std::mt19937{};
+        auto initial = std::vector<std::pair<std::int64_t, std::size_t>>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            initial[i] = std::make_pair(static_cast<std::int64_t>(generator() % 2001) - 1000, i);
+        }
+        const auto offsets = random_offsets(size, 700);
+        const auto first_less = [] (const auto & l, const auto & r) {return l.first < r.first;};
+        const auto expected = sort_each_segment(initial, offsets, first_less);
+
+        auto values = initial;
+        auto buffer = decltype(values)(values.size());
+        const auto key = [] (const auto & p) {return p.first;};
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::segmented_radix_sort(values, offsets, buffer.begin(), key);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::segmented_radix_sort(burst::par(3), values, offsets, buffer.begin(), key);
+        }
+        SUBCASE("при параллельной сортировке во внешнем пуле")
+        {
+            boost::asio::thread_pool pool(2);
+            burst::segmented_radix_sort(burst::par(pool, 2), values, offsets, buffer.begin(), key);
+        }
+        SUBCASE("с разрядом нестандартной ширины")
+        {
+            burst::segmented_radix_sort(values, offsets, buffer.begin(), key, burst::low_bits<11>);
+        }
+
+        CHECK(values == expected);
+    }
+
+    TEST_CASE("Принимает отображения в однобайтовые числа и в составные ключи")
+    {
+        const auto size = std::size_t{20000};
+        auto generator = std::mt19937{};
+        auto initial = std::vector<std::tuple<std::uint8_t, double, std::size_t>>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            initial[i] = std::make_tuple(static_cast<std::uint8_t>(generator() % 5), static_cast<double>(generator() % 7) - 3.5, i);
+        }
+        const auto offsets = random_offsets(size, 3000);
+        auto values = initial;
+        auto buffer = decltype(values)(values.size());
+
+        SUBCASE("однобайтовый ключ")
+        {
+            burst::segmented_radix_sort(values, offsets, buffer.begin(), [] (const auto & t) {return std::get<0>(t);});
+            CHECK(values == sort_each_segment(initial, offsets,
+                [] (const auto & l, const auto & r) {return std::get<0>(l) < std::get<0>(r);}));
+        }
+        SUBCASE("составной ключ")
+        {
+            const auto key = [] (const auto & t) {return std::make_pair(std::get<1>(t), std::get<0>(t));};
+            burst::segmented_radix_sort(burst::par(2), values, offsets, buffer.begin(), key);
+            CHECK(values == sort_each_segment(initial, offsets,
+                [& key] (const auto & l, const auto & r) {return key(l) < key(r);}));
+        }
+    }
+
+    TEST_CASE("Исключение из отображения выбрасывается из параллельной сортировки")
+    {
+        auto values = std::vector<int>(10000, 1);
+        const auto offsets = random_offsets(values.size(), 100);
+        auto buffer = std::vector<int>(values.size());
+
+        CHECK_THROWS_AS
+        (
+            burst::segmented_radix_sort(burst::par(3), values, offsets, buffer.begin(),
+                [] (int x) -> int
+                {
+                    throw std::runtime_error("qwe");
+                    return x;
+                }),
+            std::runtime_error
+        );
+    }
+}
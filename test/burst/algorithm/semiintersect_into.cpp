@@ -0,0 +1,132 @@
+#include <burst/algorithm/semiintersect_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/semiintersect.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    auto make_lazy_ranges (const std::vector<std::vector<int>> & ranges)
+    {
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> lazy_ranges;
+        for (const auto & range: ranges)
+        {
+            lazy_ranges.push_back(boost::make_iterator_range(range));
+        }
+        return lazy_ranges;
+    }
+}
+
+TEST_SUITE("semiintersect_into")
+{
+    TEST_CASE("Полупересечение пустых диапазонов пусто")
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+
+        std::vector<int> semiintersection;
+        burst::semiintersect_into(std::tie(first, second), 1, std::back_inserter(semiintersection));
+
+        CHECK(semiintersection.empty());
+    }
+
+    TEST_CASE("Записывает элементы, которые есть по меньшей мере в заданном числе диапазонов")
+    {
+        const auto first = burst::make_vector({1, 2, 3, 4});
+        const auto second = burst::make_vector({2, 3, 5});
+        const auto third = burst::make_vector({3, 4, 5, 6});
+
+        std::vector<int> semiintersection;
+        burst::semiintersect_into(std::tie(first, second, third), 2, std::back_inserter(semiintersection));
+
+        CHECK(semiintersection == std::vector<int>{2, 3, 4, 5});
+    }
+
+    TEST_CASE("Возвращает итератор за последним записанным элементом")
+    {
+        const auto first = burst::make_vector({1, 3});
+        const auto second = burst::make_vector({1, 2, 3});
+
+        int semiintersection[5] = {0, 0, 0, 0, 0};
+        const auto end = burst::semiintersect_into(std::tie(first, second), 2, std::begin(semiintersection));
+
+        CHECK(end == std::begin(semiintersection) + 2);
+        CHECK(std::equal(std::begin(semiintersection), end, std::begin({1, 3})));
+    }
+
+    TEST_CASE("Не изменяет входные диапазоны")
+    {
+        const auto first = burst::make_vector({1, 2, 3});
+        const auto second = burst::make_vector({2, 3, 4});
+        auto ranges = burst::make_vector({first, second});
+
+        std::vector<int> semiintersection;
+        burst::semiintersect_into(ranges, 2, std::back_inserter(semiintersection));
+
+        CHECK(ranges == burst::make_vector({first, second}));
+    }
+
+    TEST_CASE("Принимает диапазоны разных типов с одинаковыми элементами")
+    {
+        const auto first = burst::make_list({'a', 'b', 'c', 'x'});
+        const auto second = std::string("bcdefg");
+        const auto third = std::string("cdx");
+
+        std::string semiintersection;
+        burst::semiintersect_into(std::tie(first, second, third), 2, std::back_inserter(semiintersection));
+
+        CHECK(semiintersection == "bcdx");
+    }
+
+    TEST_CASE("Принимает отношение порядка")
+    {
+        const auto first = burst::make_vector({9, 6, 3});
+        const auto second = burst::make_vector({9, 7, 3, 1});
+
+        std::vector<int> semiintersection;
+        burst::semiintersect_into(std::tie(first, second), 2, std::greater<>{},
+            std::back_inserter(semiintersection));
+
+        CHECK(semiintersection == std::vector<int>{9, 3});
+    }
+
+    TEST_CASE("Совпадает с ленивым полупересечением для случайных диапазонов")
+    {
+        std::mt19937 engine{};
+        for (auto attempt = 0; attempt < 300; ++attempt)
+        {
+            const auto range_count = std::uniform_int_distribution<std::size_t>(1, 9)(engine);
+            const auto min_items = std::uniform_int_distribution<std::size_t>(1, range_count)(engine);
+            const auto max_size = std::uniform_int_distribution<std::size_t>(0, 300)(engine);
+            const auto max_value = std::uniform_int_distribution<int>(1, 1000)(engine);
+            auto size = std::uniform_int_distribution<std::size_t>(0, max_size);
+            auto value = std::uniform_int_distribution<int>(0, max_value);
+
+            std::vector<std::vector<int>> ranges(range_count);
+            for (auto & range: ranges)
+            {
+                range.resize(size(engine));
+                std::generate(range.begin(), range.end(), [& engine, & value] {return value(engine);});
+                std::sort(range.begin(), range.end());
+            }
+
+            std::vector<int> semiintersection;
+            burst::semiintersect_into(ranges, min_items, std::back_inserter(semiintersection));
+
+            auto lazy_ranges = make_lazy_ranges(ranges);
+            const auto expected = burst::semiintersect(lazy_ranges, min_items);
+            REQUIRE(std::equal(semiintersection.begin(), semiintersection.end(), expected.begin(), expected.end()));
+        }
+    }
+}
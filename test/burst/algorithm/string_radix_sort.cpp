@@ -0,0 +1,187 @@
+#include <burst/algorithm/string_radix_sort.hpp>
+#include <burst/execution/parallel_policy.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/asio/thread_pool.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> random_strings (std::size_t count, std::size_t max_length, char min, char max)
+    {
+        std::default_random_engine generator;
+        std::uniform_int_distribution<std::size_t> length(0, max_length);
+        std::uniform_int_distribution<int> symbol(min, max);
+
+        std::vector<std::string> strings(count);
+        for (auto & string: strings)
+        {
+            string.resize(length(generator));
+            std::generate(string.begin(), string.end(), [& symbol, & generator] {return static_cast<char>(symbol(generator));});
+        }
+
+        return strings;
+    }
+
+    bool unsigned_less (const std::string & left, const std::string & right)
+    {
+        return
+            std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(),
+                [] (char l, char r)
+                {
+                    return static_cast<unsigned char>(l) < static_cast<unsigned char>(r);
+                });
+    }
+}
+
+TEST_SUITE("string_radix_sort")
+{
+    TEST_CASE("Упорядочивает строки лексикографически")
+    {
+        std::vector<std::string> strings{"qwe", "", "qw", "asd", "q", "zxc", "a", "", "qwerty"};
+        std::vector<std::string> buffer(strings.size());
+
+        burst::string_radix_sort(strings, buffer.begin());
+
+        const auto expected = std::vector<std::string>{"", "", "a", "asd", "q", "qw", "qwe", "qwerty", "zxc"};
+        CHECK(strings == expected);
+    }
+
+    TEST_CASE("Байты сравниваются как беззнаковые числа")
+    {
+        std::vector<std::string> strings{"\xff", "\x80" "a", "\x7f", "\x01", "\x80"};
+        std::vector<std::string> buffer(strings.size());
+
+        burst::string_radix_sort(strings.begin(), strings.end(), buffer.begin());
+
+        const auto expected = std::vector<std::string>{"\x01", "\x7f", "\x80", "\x80" "a", "\xff"};
+        CHECK(strings == expected);
+    }
+
+    TEST_CASE_TEMPLATE("Результат совпадает с результатом сравнительной сортировки", alphabet,
+        std::integral_constant<char, 'b'>, std::integral_constant<char, 'z'>)
+    {
+        auto strings = random_strings(5000, 20, 'a', alphabet::value);
+        auto expected = strings;
+        std::sort(expected.begin(), expected.end(), unsigned_less);
+
+        std::vector<std::string> buffer(strings.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::string_radix_sort(strings, buffer.begin());
+            CHECK(strings == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::string_radix_sort(burst::par(3), strings, buffer.begin());
+            CHECK(strings == expected);
+        }
+    }
+
+    TEST_CASE("Длинный общий префикс не мешает сортировке")
+    {
+        auto strings = random_strings(1000, 5, 'a', 'c');
+        const auto prefix = std::string(10000, 'p');
+        for (auto & string: strings)
+        {
+            string = prefix + string;
+        }
+        for (auto length = 0ul; length < 300; ++length)
+        {
+            strings.push_back(std::string(length, 'p'));
+        }
+        auto expected = strings;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<std::string> buffer(strings.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::string_radix_sort(strings, buffer.begin());
+            CHECK(strings == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::string_radix_sort(burst::par(2), strings, buffer.begin());
+            CHECK(strings == expected);
+        }
+    }
+
+    TEST_CASE("Алгоритм сортировки устойчив")
+    {
+        auto keys = random_strings(3000, 4, 'a', 'c');
+        std::vector<std::pair<std::string, std::size_t>> values;
+        for (auto i = 0ul; i < keys.size(); ++i)
+        {
+            values.emplace_back(keys[i], i);
+        }
+        auto expected = values;
+        std::stable_sort(expected.begin(), expected.end(),
+            [] (const auto & left, const auto & right) {return left.first < right.first;});
+
+        const auto key = [] (const auto & value) -> const std::string & {return value.first;};
+        std::vector<std::pair<std::string, std::size_t>> buffer(values.size());
+        SUBCASE("при последовательной сортировке")
+        {
+            burst::string_radix_sort(values, buffer.begin(), key);
+            CHECK(values == expected);
+        }
+        SUBCASE("при параллельной сортировке")
+        {
+            burst::string_radix_sort(burst::par(4), values, buffer.begin(), key);
+            CHECK(values == expected);
+        }
+    }
+
+    TEST_CASE("Отображение может возвращать произвольный диапазон байтов")
+    {
+        const auto storage = random_strings(500, 10, 'a', 'z');
+        std::vector<const std::string *> pointers;
+        for (const auto & string: storage)
+        {
+            pointers.push_back(&string);
+        }
+
+        std::vector<const std::string *> buffer(pointers.size());
+        burst::string_radix_sort(pointers, buffer.begin(),
+            [] (const std::string * s)
+            {
+                return boost::make_iterator_range(s->data(), s->data() + s->size());
+            });
+
+        CHECK(std::is_sorted(pointers.begin(), pointers.end(),
+            [] (const auto * left, const auto * right) {return *left < *right;}));
+    }
+
+    TEST_CASE("Параллельная сортировка исполняется в пуле потоков")
+    {
+        auto strings = random_strings(1000, 10, 'a', 'z');
+        std::vector<std::string> buffer(strings.size());
+
+        boost::asio::thread_pool pool(2);
+        const auto caller = std::this_thread::get_id();
+        std::atomic<bool> called_from_caller{false};
+        burst::string_radix_sort(burst::par(pool, 2), strings, buffer.begin(),
+            [caller, & called_from_caller] (const std::string & s) -> const std::string &
+            {
+                if (std::this_thread::get_id() == caller)
+                {
+                    called_from_caller = true;
+                }
+                return s;
+            });
+
+        CHECK(std::is_sorted(strings.begin(), strings.end()));
+        CHECK(not called_from_caller);
+    }
+}
@@ -0,0 +1,130 @@
+#include <burst/algorithm/symmetric_difference_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/symmetric_difference.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    auto make_lazy_ranges (const std::vector<std::vector<int>> & ranges)
+    {
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> lazy_ranges;
+        for (const auto & range: ranges)
+        {
+            lazy_ranges.push_back(boost::make_iterator_range(range));
+        }
+        return lazy_ranges;
+    }
+}
+
+TEST_SUITE("symmetric_difference_into")
+{
+    TEST_CASE("Симметрическая разность пустых диапазонов пуста")
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+
+        std::vector<int> difference;
+        burst::symmetric_difference_into(std::tie(first, second), std::back_inserter(difference));
+
+        CHECK(difference.empty());
+    }
+
+    TEST_CASE("Симметрическая разность одного диапазона — сам этот диапазон")
+    {
+        const auto only = burst::make_vector({1, 2, 2, 5});
+        const auto ranges = burst::make_vector({only});
+
+        std::vector<int> difference;
+        burst::symmetric_difference_into(ranges, std::back_inserter(difference));
+
+        CHECK(difference == only);
+    }
+
+    TEST_CASE("Элемент входит в симметрическую разность, если он встречается в нечётном числе "
+        "диапазонов")
+    {
+        const auto first = burst::make_vector({1, 2, 3, 4, 10, 11, 12});
+        const auto second = burst::make_vector({2, 3, 5});
+        const auto third = burst::make_vector({3, 4, 5, 6});
+
+        std::vector<int> difference;
+        burst::symmetric_difference_into(std::tie(first, second, third), std::back_inserter(difference));
+
+        CHECK(difference == std::vector<int>{1, 3, 6, 10, 11, 12});
+    }
+
+    TEST_CASE("Возвращает итератор за последним записанным элементом")
+    {
+        const auto first = burst::make_vector({1, 3});
+        const auto second = burst::make_vector({1, 2});
+
+        int difference[5] = {0, 0, 0, 0, 0};
+        const auto end = burst::symmetric_difference_into(std::tie(first, second), std::begin(difference));
+
+        CHECK(end == std::begin(difference) + 2);
+        CHECK(std::equal(std::begin(difference), end, std::begin({2, 3})));
+    }
+
+    TEST_CASE("Принимает диапазоны разных типов с одинаковыми элементами")
+    {
+        const auto first = burst::make_list({'a', 'b', 'c', 'x'});
+        const auto second = std::string("bcdefg");
+
+        std::string difference;
+        burst::symmetric_difference_into(std::tie(first, second), std::back_inserter(difference));
+
+        CHECK(difference == "adefgx");
+    }
+
+    TEST_CASE("Принимает отношение порядка")
+    {
+        const auto first = burst::make_vector({9, 6, 3});
+        const auto second = burst::make_vector({9, 7, 3, 1});
+
+        std::vector<int> difference;
+        burst::symmetric_difference_into(std::tie(first, second), std::greater<>{},
+            std::back_inserter(difference));
+
+        CHECK(difference == std::vector<int>{7, 6, 1});
+    }
+
+    TEST_CASE("Совпадает с ленивой симметрической разностью для случайных диапазонов")
+    {
+        std::mt19937 engine{};
+        for (auto attempt = 0; attempt < 300; ++attempt)
+        {
+            const auto range_count = std::uniform_int_distribution<std::size_t>(1, 9)(engine);
+            const auto max_size = std::uniform_int_distribution<std::size_t>(0, 300)(engine);
+            const auto max_value = std::uniform_int_distribution<int>(1, 1000)(engine);
+            auto size = std::uniform_int_distribution<std::size_t>(0, max_size);
+            auto value = std::uniform_int_distribution<int>(0, max_value);
+
+            std::vector<std::vector<int>> ranges(range_count);
+            for (auto & range: ranges)
+            {
+                range.resize(size(engine));
+                std::generate(range.begin(), range.end(), [& engine, & value] {return value(engine);});
+                std::sort(range.begin(), range.end());
+            }
+
+            std::vector<int> difference;
+            burst::symmetric_difference_into(ranges, std::back_inserter(difference));
+
+            auto lazy_ranges = make_lazy_ranges(ranges);
+            const auto expected = burst::symmetric_difference(lazy_ranges);
+            REQUIRE(std::equal(difference.begin(), difference.end(), expected.begin(), expected.end()));
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include <burst/algorithm/unite_into.hpp>
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/unite.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    auto make_lazy_ranges (const std::vector<std::vector<int>> & ranges)
+    {
+        std::vector<boost::iterator_range<std::vector<int>::const_iterator>> lazy_ranges;
+        for (const auto & range: ranges)
+        {
+            lazy_ranges.push_back(boost::make_iterator_range(range));
+        }
+        return lazy_ranges;
+    }
+}
+
+TEST_SUITE("unite_into")
+{
+    TEST_CASE("Объединение пустых диапазонов пусто")
+    {
+        std::vector<int> first;
+        std::vector<int> second;
+
+        std::vector<int> united;
+        burst::unite_into(std::tie(first, second), std::back_inserter(united));
+
+        CHECK(united.empty());
+    }
+
+    TEST_CASE("Объединение одного диапазона — сам этот диапазон")
+    {
+        const auto only = burst::make_vector({1, 2, 2, 5});
+        const auto ranges = burst::make_vector({only});
+
+        std::vector<int> united;
+        burst::unite_into(ranges, std::back_inserter(united));
+
+        CHECK(united == only);
+    }
+
+    TEST_CASE("Каждый элемент входит в объединение наибольшее число раз, которое он встречается в "
+        "одном диапазоне")
+    {
+        const auto first = burst::make_vector({1, 1, 2, 3, 3, 3});
+        const auto second = burst::make_vector({1, 2, 2, 3, 4});
+
+        std::vector<int> united;
+        burst::unite_into(std::tie(first, second), std::back_inserter(united));
+
+        CHECK(united == std::vector<int>{1, 1, 2, 2, 3, 3, 3, 4});
+    }
+
+    TEST_CASE("Возвращает итератор за последним записанным элементом")
+    {
+        const auto first = burst::make_vector({1, 3});
+        const auto second = burst::make_vector({1, 2});
+
+        int united[5] = {0, 0, 0, 0, 0};
+        const auto end = burst::unite_into(std::tie(first, second), std::begin(united));
+
+        CHECK(end == std::begin(united) + 3);
+        CHECK(std::equal(std::begin(united), end, std::begin({1, 2, 3})));
+    }
+
+    TEST_CASE("Объединяет диапазоны разных типов с одинаковыми элементами")
+    {
+        const auto first = burst::make_list({'a', 'b', 'c', 'x'});
+        const auto second = std::string("bcdefg");
+
+        std::string united;
+        burst::unite_into(std::tie(first, second), std::back_inserter(united));
+
+        CHECK(united == "abcdefgx");
+    }
+
+    TEST_CASE("Принимает отношение порядка")
+    {
+        const auto first = burst::make_vector({9, 6, 3});
+        const auto second = burst::make_vector({9, 7, 3, 1});
+
+        std::vector<int> united;
+        burst::unite_into(std::tie(first, second), std::greater<>{}, std::back_inserter(united));
+
+        CHECK(united == std::vector<int>{9, 7, 6, 3, 1});
+    }
+
+    TEST_CASE("Совпадает с ленивым объединением для случайных диапазонов")
+    {
+        std::mt19937 engine{};
+        for (auto attempt = 0; attempt < 300; ++attempt)
+        {
+            const auto range_count = std::uniform_int_distribution<std::size_t>(1, 9)(engine);
+            const auto max_size = std::uniform_int_distribution<std::size_t>(0, 300)(engine);
+            const auto max_value = std::uniform_int_distribution<int>(1, 1000)(engine);
+            auto size = std::uniform_int_distribution<std::size_t>(0, max_size);
+            auto value = std::uniform_int_distribution<int>(0, max_value);
+
+            std::vector<std::vector<int>> ranges(range_count);
+            for (auto & range: ranges)
+            {
+                range.resize(size(engine));
+                std::generate(range.begin(), range.end(), [& engine, & value] {return value(engine);});
+                std::sort(range.begin(), range.end());
+            }
+
+            std::vector<int> united;
+            burst::unite_into(ranges, std::back_inserter(united));
+
+            auto lazy_ranges = make_lazy_ranges(ranges);
+            const auto expected = burst::unite(lazy_ranges);
+            REQUIRE(std::equal(united.begin(), united.end(), expected.begin(), expected.end()));
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#include <burst/functional/low_bits.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+TEST_SUITE("low_bits")
+{
+    TEST_CASE("Может быть вычислен на этапе компиляции")
+    {
+        constexpr auto x = burst::low_bits<11>(0xffff);
+        static_assert(x == 0x07ff, "");
+    }
+
+    TEST_CASE("Возвращает наименьший беззнаковый тип, вмещающий нужное количество битов")
+    {
+        CHECK(std::is_same<decltype(burst::low_bits<5>(0)), std::uint8_t>::value);
+        CHECK(std::is_same<decltype(burst::low_bits<8>(0)), std::uint8_t>::value);
+        CHECK(std::is_same<decltype(burst::low_bits<11>(0)), std::uint16_t>::value);
+        CHECK(std::is_same<decltype(burst::low_bits<16>(0)), std::uint16_t>::value);
+    }
+
+    TEST_CASE("Объявляет количество значащих битов")
+    {
+        CHECK(burst::low_bits_fn<11>::bit_count == 11);
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <doctest/doctest.h>
 
+#include <boost/cstdint.hpp>
 #include <boost/mpl/vector.hpp>
 
 #include <limits>
@@ -61,4 +62,17 @@ TEST_SUITE("shift_to_unsigned")
         constexpr auto r = burst::shift_to_unsigned(-1);
         static_assert(r == std::numeric_limits<unsigned>::max () / 2, "");
     }
+
+#if defined(BOOST_HAS_INT128)
+    TEST_CASE("Определена для 128-битных целых")
+    {
+        using signed_type = boost::int128_type;
+        using unsigned_type = boost::uint128_type;
+        CHECK((std::is_same<decltype(burst::shift_to_unsigned(signed_type{0})), unsigned_type>::value));
+        CHECK((burst::shift_to_unsigned(std::numeric_limits<signed_type>::min()) == unsigned_type{0}));
+        CHECK((burst::shift_to_unsigned(std::numeric_limits<signed_type>::max()) == std::numeric_limits<unsigned_type>::max()));
+        CHECK((burst::shift_to_unsigned(signed_type{-1}) < burst::shift_to_unsigned(signed_type{1})));
+        CHECK((burst::shift_to_unsigned(std::numeric_limits<unsigned_type>::max()) == std::numeric_limits<unsigned_type>::max()));
+    }
+#endif
 }
@@ -4,10 +4,12 @@
 
 #include <doctest/doctest.h>
 
+#include <boost/cstdint.hpp>
 #include <boost/mpl/vector.hpp>
 
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
@@ -73,4 +75,55 @@ TEST_SUITE("to_ordered_integral")
         >
         ::value);
     }
+
+#if defined(BOOST_HAS_INT128)
+    TEST_CASE("128-битные целые отображаются сами в себя")
+    {
+        const auto value = -(boost::int128_type{1} << 100);
+        CHECK((std::is_same<decltype(burst::to_ordered_integral(value)), boost::int128_type>::value));
+        CHECK((burst::to_ordered_integral(value) == value));
+    }
+#endif
+
+#if defined(BURST_X87_LONG_DOUBLE)
+    TEST_CASE("80-битные long double x87 отображаются в упорядоченные 128-битные целые")
+    {
+        const auto check =
+            [] (long double x, long double y)
+            {
+                REQUIRE(x < y);
+                CHECK((burst::to_ordered_integral(x) < burst::to_ordered_integral(y)));
+            };
+
+        constexpr auto pos_inf = std::numeric_limits<long double>::infinity();
+        constexpr auto neg_inf = -pos_inf;
+        constexpr auto lowest = std::numeric_limits<long double>::lowest();
+        constexpr auto denorm_min = std::numeric_limits<long double>::denorm_min();
+        constexpr auto max = std::numeric_limits<long double>::max();
+        check(neg_inf, lowest);
+        check(lowest, -1e300L);
+        check(-3.14L, -3.1399999999999999999L);
+        check(-denorm_min, 0.0L);
+        check(0.0L, denorm_min);
+        check(denorm_min, std::numeric_limits<long double>::min());
+        check(1.0L, 1.0L + std::numeric_limits<long double>::epsilon());
+        check(1e300L, max);
+        check(max, pos_inf);
+
+        CHECK((burst::to_ordered_integral(-0.0L) < burst::to_ordered_integral(0.0L)));
+        CHECK((std::is_same<decltype(burst::to_ordered_integral(1.0L)), burst::unsigned_integer_of_size_t<16>>::value));
+    }
+
+    TEST_CASE("Байты выравнивания long double не влияют на результат")
+    {
+        long double values[2];
+        std::memset(values, 0x00, sizeof(values));
+        values[0] = 2.5L;
+        std::memset(values + 1, 0xff, sizeof(long double));
+        values[1] = 2.5L;
+
+        CHECK((burst::to_ordered_integral(values[0]) == burst::to_ordered_integral(values[1])));
+        CHECK((burst::to_ordered_integral(values[0]) >> 80 == 0));
+    }
+#endif
 }
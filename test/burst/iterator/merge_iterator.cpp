@@ -5,8 +5,12 @@
 
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <string>
+#include <vector>
 
 TEST_SUITE("merge_iterator")
 {
@@ -23,4 +27,82 @@ TEST_SUITE("merge_iterator")
         auto expected_collection = {600, 500, 200, 100};
         CHECK(boost::make_iterator_range(merged_begin, merged_end) == expected_collection);
     }
+
+    TEST_CASE("Большое количество диапазонов сливается в упорядоченный диапазон")
+    {
+        auto rows = std::vector<std::vector<int>>(100);
+        for (auto i = 0ul; i < rows.size(); ++i)
+        {
+            for (auto j = 0ul; j < i % 7; ++j)
+            {
+                rows[i].push_back(static_cast<int>((i * 31 + j * 17) % 50));
+            }
+            std::sort(rows[i].begin(), rows[i].end());
+        }
+        auto expected = std::vector<int>{};
+        for (const auto & row: rows)
+        {
+            expected.insert(expected.end(), row.begin(), row.end());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        auto ranges = std::vector<boost::iterator_range<std::vector<int>::const_iterator>>{};
+        for (const auto & row: rows)
+        {
+            ranges.push_back(boost::make_iterator_range(row));
+        }
+        auto merged_begin = burst::make_merge_iterator(ranges);
+        auto merged_end = burst::make_merge_iterator(burst::iterator::end_tag, merged_begin);
+
+        CHECK(std::vector<int>(merged_begin, merged_end) == expected);
+    }
+
+    TEST_CASE("Большое количество диапазонов сливается с предикатом")
+    {
+        auto rows = std::vector<std::vector<std::string>>(20);
+        for (auto i = 0ul; i < rows.size(); ++i)
+        {
+            for (auto j = 0ul; j < 5; ++j)
+            {
+                rows[i].push_back(std::to_string((i * 7 + j * 3) % 10));
+            }
+            std::sort(rows[i].begin(), rows[i].end(), std::greater<>{});
+        }
+        auto expected = std::vector<std::string>{};
+        for (const auto & row: rows)
+        {
+            expected.insert(expected.end(), row.begin(), row.end());
+        }
+        std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+        auto ranges = std::vector<boost::iterator_range<std::vector<std::string>::const_iterator>>{};
+        for (const auto & row: rows)
+        {
+            ranges.push_back(boost::make_iterator_range(row));
+        }
+        auto merged_begin = burst::make_merge_iterator(ranges, std::greater<>{});
+        auto merged_end = burst::make_merge_iterator(burst::iterator::end_tag, merged_begin);
+
+        CHECK(std::vector<std::string>(merged_begin, merged_end) == expected);
+    }
+
+    TEST_CASE("При слиянии большого количества диапазонов можно писать в исходные диапазоны")
+    {
+        auto rows = std::vector<std::vector<std::size_t>>(16);
+        for (auto i = 0ul; i < rows.size(); ++i)
+        {
+            rows[i] = {i, i + rows.size()};
+        }
+
+        auto ranges = std::vector<boost::iterator_range<std::vector<std::size_t>::iterator>>{};
+        for (auto & row: rows)
+        {
+            ranges.push_back(boost::make_iterator_range(row));
+        }
+        auto merged_begin = burst::make_merge_iterator(ranges);
+        auto merged_end = burst::make_merge_iterator(burst::iterator::end_tag, merged_begin);
+        std::for_each(merged_begin, merged_end, [] (auto & value) {value *= 10;});
+
+        CHECK(rows[3] == (std::vector<std::size_t>{30, 190}));
+    }
 }
@@ -5,7 +5,29 @@
 
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    std::vector<std::vector<int>> make_rows (std::size_t row_count)
+    {
+        auto rows = std::vector<std::vector<int>>(row_count);
+        for (auto i = 0ul; i < rows.size(); ++i)
+        {
+            for (auto j = 0ul; j < i % 9; ++j)
+            {
+                rows[i].push_back(static_cast<int>((i * 13 + j * 7) % 20));
+            }
+            std::sort(rows[i].begin(), rows[i].end());
+        }
+        return rows;
+    }
+}
 
 TEST_SUITE("symmetric_difference_iterator")
 {
@@ -50,4 +72,41 @@ TEST_SUITE("symmetric_difference_iterator")
         CHECK(ranges[1] != second);
         CHECK(ranges[2] != third);
     }
+
+    TEST_CASE("Симметрическая разность большого количества диапазонов содержит те элементы, "
+        "которые встречаются в нечётном количестве диапазонов")
+    {
+        const auto rows = make_rows(100);
+
+        // Входные диапазоны — мультимножества, поэтому каждое k-е вхождение элемента в
+        // диапазон учитывается отдельно.
+        auto occurrences = std::map<std::pair<int, std::size_t>, std::size_t>{};
+        for (const auto & row: rows)
+        {
+            for (auto value = row.begin(); value != row.end(); ++value)
+            {
+                const auto index = static_cast<std::size_t>(std::count(row.begin(), value, *value));
+                ++occurrences[std::make_pair(*value, index)];
+            }
+        }
+        auto expected = std::vector<int>{};
+        for (const auto & occurrence: occurrences)
+        {
+            if (occurrence.second % 2 == 1)
+            {
+                expected.push_back(occurrence.first.first);
+            }
+        }
+
+        auto ranges = std::vector<boost::iterator_range<std::vector<int>::const_iterator>>{};
+        for (const auto & row: rows)
+        {
+            ranges.push_back(boost::make_iterator_range(row));
+        }
+        auto difference_begin = burst::make_symmetric_difference_iterator(ranges);
+        auto difference_end =
+            burst::make_symmetric_difference_iterator(burst::iterator::end_tag, difference_begin);
+
+        CHECK(std::vector<int>(difference_begin, difference_end) == expected);
+    }
 }
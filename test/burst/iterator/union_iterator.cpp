@@ -5,8 +5,29 @@
 
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <forward_list>
 #include <iterator>
+#include <map>
+#include <vector>
+
+namespace
+{
+    std::vector<std::vector<int>> make_rows (std::size_t row_count)
+    {
+        auto rows = std::vector<std::vector<int>>(row_count);
+        for (auto i = 0ul; i < rows.size(); ++i)
+        {
+            for (auto j = 0ul; j < i % 9; ++j)
+            {
+                rows[i].push_back(static_cast<int>((i * 13 + j * 7) % 20));
+            }
+            std::sort(rows[i].begin(), rows[i].end());
+        }
+        return rows;
+    }
+}
 
 TEST_SUITE("union_iterator")
 {
@@ -35,4 +56,35 @@ TEST_SUITE("union_iterator")
         auto expected_collection = {1.6, 2.71, 3.14};
         CHECK(boost::make_iterator_range(union_begin, union_end) == expected_collection);
     }
+
+    TEST_CASE("Объединение большого количества диапазонов содержит каждый элемент столько раз, "
+        "сколько он встречается в диапазоне, где его больше всего")
+    {
+        const auto rows = make_rows(100);
+
+        auto max_counts = std::map<int, std::size_t>{};
+        for (const auto & row: rows)
+        {
+            for (auto value: row)
+            {
+                const auto count = static_cast<std::size_t>(std::count(row.begin(), row.end(), value));
+                max_counts[value] = std::max(max_counts[value], count);
+            }
+        }
+        auto expected = std::vector<int>{};
+        for (const auto & value_count: max_counts)
+        {
+            expected.insert(expected.end(), value_count.second, value_count.first);
+        }
+
+        auto ranges = std::vector<boost::iterator_range<std::vector<int>::const_iterator>>{};
+        for (const auto & row: rows)
+        {
+            ranges.push_back(boost::make_iterator_range(row));
+        }
+        auto union_begin = burst::make_union_iterator(ranges);
+        auto   union_end = burst::make_union_iterator(burst::iterator::end_tag, union_begin);
+
+        CHECK(std::vector<int>(union_begin, union_end) == expected);
+    }
 }
@@ -2,12 +2,14 @@
 #include <burst/container/make_set.hpp>
 #include <burst/container/make_vector.hpp>
 #include <burst/range/difference.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <doctest/doctest.h>
 
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/algorithm/set_algorithm.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -114,4 +116,30 @@ TEST_SUITE("difference")
         const auto expected = burst::make_vector({2, 14, 18});
         CHECK(difference == expected);
     }
+
+    TEST_CASE("Можно явно задать способ продвижения вычитаемого")
+    {
+        const auto minuend = burst::make_vector({1, 50, 100});
+        auto subtrahend = std::vector<int>{};
+        for (auto i = 0; i < 100; i += 2)
+        {
+            subtrahend.push_back(i);
+        }
+
+        const auto expected_collection = {1, 100};
+        CHECK(burst::difference(minuend, subtrahend, std::less<>{}, burst::binary_skip) == expected_collection);
+        CHECK(burst::difference(minuend, subtrahend, std::less<>{}, burst::galloping_skip) == expected_collection);
+        CHECK(burst::difference(minuend, subtrahend, std::less<>{}, burst::linear_skip) == expected_collection);
+    }
+
+    TEST_CASE("Допускает диапазоны с элементами разной ширины")
+    {
+        const auto minuend = burst::make_vector<std::uint64_t>({0x100000002});
+        const auto subtrahend = burst::make_vector<std::uint32_t>({1, 2, 3});
+
+        const auto expected_collection = {std::uint64_t{0x100000002}};
+        CHECK(burst::difference(minuend, subtrahend) == expected_collection);
+        CHECK(burst::difference(minuend, subtrahend, std::less<>{}, burst::linear_skip) == expected_collection);
+        CHECK(burst::difference(minuend, subtrahend, std::less<>{}, burst::galloping_skip) == expected_collection);
+    }
 }
@@ -3,6 +3,7 @@
 #include <burst/container/make_vector.hpp>
 #include <burst/range/intersect.hpp>
 #include <burst/range/make_range_vector.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <doctest/doctest.h>
 
@@ -165,4 +166,19 @@ TEST_SUITE("intersect")
         auto expected_collection = {6, 0};
         CHECK(intersected_range == expected_collection);
     }
+
+    TEST_CASE("Можно явно задать способ продвижения диапазонов")
+    {
+        auto short_range = burst::make_vector({3, 500, 999});
+        auto long_range = std::vector<int>{};
+        for (auto i = 0; i < 1000; i += 3)
+        {
+            long_range.push_back(i);
+        }
+
+        const auto expected_collection = {3, 999};
+        CHECK(burst::intersect(std::tie(short_range, long_range), std::less<>{}, burst::binary_skip) == expected_collection);
+        CHECK(burst::intersect(std::tie(short_range, long_range), std::less<>{}, burst::galloping_skip) == expected_collection);
+        CHECK(burst::intersect(std::tie(short_range, long_range), std::less<>{}, burst::linear_skip) == expected_collection);
+    }
 }
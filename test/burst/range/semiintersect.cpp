@@ -3,6 +3,7 @@
 #include <burst/container/make_vector.hpp>
 #include <burst/range/make_range_vector.hpp>
 #include <burst/range/semiintersect.hpp>
+#include <burst/range/skip_policy.hpp>
 
 #include <doctest/doctest.h>
 
@@ -261,4 +262,16 @@ TEST_SUITE("semiintersect")
         auto expected_collection = {6, 0};
         CHECK(semiintersection == expected_collection);
     }
+
+    TEST_CASE("Можно явно задать способ продвижения диапазонов")
+    {
+        auto   one = burst::make_vector({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        auto   two = burst::make_vector({   2,    4,    6,    8   });
+        auto three = burst::make_vector({      3,       6,       9});
+        //                                  ^  ^  ^     ^     ^  ^
+
+        const auto expected_collection = {2, 3, 4, 6, 8, 9};
+        CHECK(burst::semiintersect(std::tie(one, two, three), 2, std::less<>{}, burst::galloping_skip) == expected_collection);
+        CHECK(burst::semiintersect(std::tie(one, two, three), 2, std::less<>{}, burst::linear_skip) == expected_collection);
+    }
 }
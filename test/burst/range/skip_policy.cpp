@@ -0,0 +1,101 @@
+#include <burst/container/make_list.hpp>
+#include <burst/container/make_vector.hpp>
+#include <burst/range/skip_policy.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+TEST_SUITE("skip_policy")
+{
+    TEST_CASE_TEMPLATE("Любой способ продвигает диапазон до первого элемента, который не меньше "
+        "первого элемента целевого диапазона", skip_type,
+        burst::binary_skip_t, burst::galloping_skip_t, burst::linear_skip_t, burst::adaptive_skip_t)
+    {
+        auto values = std::vector<int>(1000);
+        std::iota(values.begin(), values.end(), 0);
+        const auto goals = burst::make_vector({-5, 0, 1, 17, 500, 999, 1000, 100500});
+
+        for (auto goal: goals)
+        {
+            auto range = boost::make_iterator_range(values);
+            const auto goal_range = {goal};
+
+            skip_type{}(range, goal_range, std::less<>{});
+
+            const auto expected_position = static_cast<std::ptrdiff_t>(std::min(std::max(goal, 0), 1000));
+            CHECK(range.begin() == values.begin() + expected_position);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("Любой способ учитывает отношение порядка", skip_type,
+        burst::binary_skip_t, burst::galloping_skip_t, burst::linear_skip_t, burst::adaptive_skip_t)
+    {
+        const auto values = burst::make_vector({9, 7, 7, 5, 3, 1});
+        auto range = boost::make_iterator_range(values);
+        const auto goal_range = {7};
+
+        skip_type{}(range, goal_range, std::greater<>{});
+
+        CHECK(range == boost::make_iterator_range(values).advance_begin(1));
+    }
+
+    TEST_CASE_TEMPLATE("Любой способ продвигает диапазоны, не являющиеся диапазонами "
+        "произвольного доступа", skip_type,
+        burst::binary_skip_t, burst::galloping_skip_t, burst::linear_skip_t, burst::adaptive_skip_t)
+    {
+        const auto values = burst::make_list({1, 3, 5, 7});
+        auto range = boost::make_iterator_range(values);
+        const auto goal_range = burst::make_list({4, 8});
+
+        skip_type{}(range, goal_range, std::less<>{});
+
+        CHECK(range == burst::make_list({5, 7}));
+    }
+
+    TEST_CASE("Адаптивный способ продвигает диапазон, который намного длиннее целевого")
+    {
+        auto values = std::vector<int>(100000);
+        std::iota(values.begin(), values.end(), 0);
+        auto range = boost::make_iterator_range(values);
+        const auto goal_range = {12345};
+
+        burst::adaptive_skip(range, goal_range, std::less<>{});
+
+        CHECK(range.front() == 12345);
+    }
+
+    TEST_CASE_TEMPLATE("Поэлементный способ продвигает диапазоны 32- и 64-битных чисел по всей их "
+        "области значений", integer_type,
+        std::uint32_t, std::int32_t, std::uint64_t, std::int64_t)
+    {
+        const auto min = std::numeric_limits<integer_type>::min();
+        const auto max = std::numeric_limits<integer_type>::max();
+        auto values = std::vector<integer_type>{};
+        for (auto i = integer_type{0}; i < 20; ++i)
+        {
+            values.push_back(static_cast<integer_type>(min + i));
+            values.push_back(static_cast<integer_type>(max / 2 + i));
+            values.push_back(static_cast<integer_type>(max - i));
+        }
+        std::sort(values.begin(), values.end());
+
+        for (auto goal: values)
+        {
+            auto range = boost::make_iterator_range(values);
+            const auto goal_range = {goal};
+
+            burst::linear_skip(range, goal_range, std::less<>{});
+
+            CHECK(range.begin() == std::lower_bound(values.begin(), values.end(), goal));
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#include <burst/type_traits/is_contiguous_iterator.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+TEST_SUITE("Метафункция is_contiguous_iterator")
+{
+    TEST_CASE("Истинна для указателей")
+    {
+        CHECK(burst::is_contiguous_iterator<int *>::value);
+        CHECK(burst::is_contiguous_iterator<const std::uint64_t *>::value);
+    }
+
+    TEST_CASE("Истинна для итераторов вектора и строки")
+    {
+        CHECK(burst::is_contiguous_iterator<std::vector<int>::iterator>::value);
+        CHECK(burst::is_contiguous_iterator<std::vector<std::string>::const_iterator>::value);
+        CHECK(burst::is_contiguous_iterator<std::vector<char>::iterator>::value);
+        CHECK(burst::is_contiguous_iterator<std::string::const_iterator>::value);
+    }
+
+    TEST_CASE("Ложна для итераторов вектора булевых значений")
+    {
+        CHECK(not burst::is_contiguous_iterator<std::vector<bool>::iterator>::value);
+        CHECK(not burst::is_contiguous_iterator<std::vector<bool>::const_iterator>::value);
+    }
+
+    TEST_CASE("Ложна для итераторов прочих контейнеров")
+    {
+        CHECK(not burst::is_contiguous_iterator<std::deque<int>::iterator>::value);
+        CHECK(not burst::is_contiguous_iterator<std::list<int>::const_iterator>::value);
+    }
+}
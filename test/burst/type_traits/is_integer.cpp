@@ -0,0 +1,49 @@
+#include <burst/type_traits/is_integer.hpp>
+
+#include <doctest/doctest.h>
+
+#include <boost/cstdint.hpp>
+
+#include <cstdint>
+#include <string>
+
+TEST_SUITE("Метафункция is_integer")
+{
+    TEST_CASE("Истинна для стандартных целых типов")
+    {
+        CHECK(burst::is_integer<bool>::value);
+        CHECK(burst::is_integer<char>::value);
+        CHECK(burst::is_integer<std::int8_t>::value);
+        CHECK(burst::is_integer<const std::uint16_t>::value);
+        CHECK(burst::is_integer<std::int32_t>::value);
+        CHECK(burst::is_integer<std::uint64_t>::value);
+    }
+
+    TEST_CASE("Истинна для 128-битных целых")
+    {
+#if defined(BOOST_HAS_INT128)
+        CHECK(burst::is_integer<boost::int128_type>::value);
+        CHECK(burst::is_integer<boost::uint128_type>::value);
+#endif
+    }
+
+    TEST_CASE("Ложна для нецелых типов")
+    {
+        CHECK(not burst::is_integer<float>::value);
+        CHECK(not burst::is_integer<long double>::value);
+        CHECK(not burst::is_integer<int *>::value);
+        CHECK(not burst::is_integer<std::string>::value);
+    }
+
+    TEST_CASE("is_unsigned_integer истинна только для беззнаковых целых")
+    {
+        CHECK(burst::is_unsigned_integer<unsigned char>::value);
+        CHECK(burst::is_unsigned_integer<std::uint64_t>::value);
+        CHECK(not burst::is_unsigned_integer<std::int64_t>::value);
+        CHECK(not burst::is_unsigned_integer<double>::value);
+#if defined(BOOST_HAS_INT128)
+        CHECK(burst::is_unsigned_integer<boost::uint128_type>::value);
+        CHECK(not burst::is_unsigned_integer<boost::int128_type>::value);
+#endif
+    }
+}